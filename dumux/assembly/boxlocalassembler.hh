@@ -74,9 +74,10 @@ public:
     /*!
      * \brief Computes the derivatives with respect to the given element and adds them
      *        to the global matrix. The element residual is written into the right hand side.
+     * \note For explicit schemes, the matrix may also be a BlockDiagonalMatrix.
      */
-    template <class PartialReassembler = DefaultPartialReassembler>
-    void assembleJacobianAndResidual(JacobianMatrix& jac, SolutionVector& res, GridVariables& gridVariables,
+    template <class Matrix, class PartialReassembler = DefaultPartialReassembler>
+    void assembleJacobianAndResidual(Matrix& jac, SolutionVector& res, GridVariables& gridVariables,
                                      const PartialReassembler* partialReassembler = nullptr)
     {
         this->asImp_().bindLocalViews();
@@ -115,9 +116,8 @@ public:
                 // set main diagonal entries for the vertex
                 int vIdx = this->assembler().gridGeometry().vertexMapper().index(vertex);
 
-                typedef typename JacobianMatrix::block_type BlockType;
-                BlockType &J = jac[vIdx][vIdx];
-                for (int j = 0; j < BlockType::rows; ++j)
+                auto& J = jac[vIdx][vIdx];
+                for (std::size_t j = 0; j < J.N(); ++j)
                     J[j][j] = 1.0;
 
                 // set residual for the vertex
@@ -132,7 +132,7 @@ public:
         {
             res[scvI.dofIndex()][eqIdx] = this->curElemVolVars()[scvI].priVars()[pvIdx] - dirichletValues[pvIdx];
 
-            auto& row = jac[scvI.dofIndex()];
+            auto&& row = jac[scvI.dofIndex()];
             for (auto col = row.begin(); col != row.end(); ++col)
                 row[col.index()][eqIdx] = 0.0;
 
@@ -387,7 +387,6 @@ class BoxLocalAssembler<TypeTag, Assembler, DiffMethod::numeric, /*implicit=*/fa
     using Scalar = GetPropType<TypeTag, Properties::Scalar>;
     using GridVariables = GetPropType<TypeTag, Properties::GridVariables>;
     using VolumeVariables = GetPropType<TypeTag, Properties::VolumeVariables>;
-    using JacobianMatrix = GetPropType<TypeTag, Properties::JacobianMatrix>;
     using LocalResidual = GetPropType<TypeTag, Properties::LocalResidual>;
     using ElementResidualVector = typename LocalResidual::ElementResidualVector;
 
@@ -404,8 +403,8 @@ public:
      *
      * \return The element residual at the current solution.
      */
-    template <class PartialReassembler = DefaultPartialReassembler>
-    ElementResidualVector assembleJacobianAndResidualImpl(JacobianMatrix& A, GridVariables& gridVariables,
+    template <class Matrix, class PartialReassembler = DefaultPartialReassembler>
+    ElementResidualVector assembleJacobianAndResidualImpl(Matrix& A, GridVariables& gridVariables,
                                                           const PartialReassembler* partialReassembler = nullptr)
     {
         if (partialReassembler)
@@ -616,7 +615,6 @@ class BoxLocalAssembler<TypeTag, Assembler, DiffMethod::analytic, /*implicit=*/f
     using ThisType = BoxLocalAssembler<TypeTag, Assembler, DiffMethod::analytic, false>;
     using ParentType = BoxLocalAssemblerBase<TypeTag, Assembler, ThisType, false>;
     using GridVariables = GetPropType<TypeTag, Properties::GridVariables>;
-    using JacobianMatrix = GetPropType<TypeTag, Properties::JacobianMatrix>;
     using LocalResidual = GetPropType<TypeTag, Properties::LocalResidual>;
     using ElementResidualVector = typename LocalResidual::ElementResidualVector;
 
@@ -630,8 +628,8 @@ public:
      *
      * \return The element residual at the current solution.
      */
-    template <class PartialReassembler = DefaultPartialReassembler>
-    ElementResidualVector assembleJacobianAndResidualImpl(JacobianMatrix& A, GridVariables& gridVariables,
+    template <class Matrix, class PartialReassembler = DefaultPartialReassembler>
+    ElementResidualVector assembleJacobianAndResidualImpl(Matrix& A, GridVariables& gridVariables,
                                                           const PartialReassembler* partialReassembler = nullptr)
     {
         if (partialReassembler)
@@ -70,9 +70,10 @@ public:
     /*!
      * \brief Computes the derivatives with respect to the given element and adds them
      *        to the global matrix. The element residual is written into the right hand side.
+     * \note For explicit schemes, the matrix may also be a BlockDiagonalMatrix.
      */
-    template <class PartialReassembler = DefaultPartialReassembler>
-    void assembleJacobianAndResidual(JacobianMatrix& jac, SolutionVector& res, GridVariables& gridVariables,
+    template <class Matrix, class PartialReassembler = DefaultPartialReassembler>
+    void assembleJacobianAndResidual(Matrix& jac, SolutionVector& res, GridVariables& gridVariables,
                                      const PartialReassembler* partialReassembler)
     {
         this->asImp_().bindLocalViews();
@@ -362,7 +363,6 @@ class CCLocalAssembler<TypeTag, Assembler, DiffMethod::numeric, /*implicit=*/fal
     using NumEqVector = GetPropType<TypeTag, Properties::NumEqVector>;
     using Element = typename GetPropType<TypeTag, Properties::GridGeometry>::GridView::template Codim<0>::Entity;
     using GridVariables = GetPropType<TypeTag, Properties::GridVariables>;
-    using JacobianMatrix = GetPropType<TypeTag, Properties::JacobianMatrix>;
     using Problem = typename GridVariables::GridVolumeVariables::Problem;
 
     enum { numEq = GetPropType<TypeTag, Properties::ModelTraits>::numEq() };
@@ -376,7 +376,8 @@ public:
      *
      * \return The element residual at the current solution.
      */
-    NumEqVector assembleJacobianAndResidualImpl(JacobianMatrix& A, GridVariables& gridVariables)
+    template<class Matrix>
+    NumEqVector assembleJacobianAndResidualImpl(Matrix& A, GridVariables& gridVariables)
     {
         if (this->assembler().isStationaryProblem())
             DUNE_THROW(Dune::InvalidStateException, "Using explicit jacobian assembler with stationary local residual");
@@ -609,7 +610,6 @@ class CCLocalAssembler<TypeTag, Assembler, DiffMethod::analytic, /*implicit=*/fa
     using ThisType = CCLocalAssembler<TypeTag, Assembler, DiffMethod::analytic, false>;
     using ParentType = CCLocalAssemblerBase<TypeTag, Assembler, ThisType, false>;
     using NumEqVector = GetPropType<TypeTag, Properties::NumEqVector>;
-    using JacobianMatrix = GetPropType<TypeTag, Properties::JacobianMatrix>;
     using GridVariables = GetPropType<TypeTag, Properties::GridVariables>;
     using Problem = typename GridVariables::GridVolumeVariables::Problem;
 
@@ -624,7 +624,8 @@ public:
      *
      * \return The element residual at the current solution.
      */
-    NumEqVector assembleJacobianAndResidualImpl(JacobianMatrix& A, const GridVariables& gridVariables)
+    template<class Matrix>
+    NumEqVector assembleJacobianAndResidualImpl(Matrix& A, const GridVariables& gridVariables)
     {
         // treat ghost separately, we always want zero update for ghosts
         if (this->elementIsGhost())
@@ -24,6 +24,8 @@
 #ifndef DUMUX_FV_ASSEMBLER_HH
 #define DUMUX_FV_ASSEMBLER_HH
 
+#include <memory>
+#include <vector>
 #include <type_traits>
 
 #include <dune/istl/matrixindexset.hh>
@@ -32,6 +34,8 @@
 #include <dumux/common/timeloop.hh>
 #include <dumux/discretization/method.hh>
 #include <dumux/linear/parallelhelpers.hh>
+#include <dumux/linear/blockdiagonalmatrix.hh>
+#include <dumux/parallel/threadlocalstorage.hh>
 
 #include "jacobianpattern.hh"
 #include "diffmethod.hh"
@@ -72,6 +76,9 @@ public:
 
     using ResidualType = SolutionVector;
 
+    //! The block diagonal of the Jacobian of explicit schemes (the storage derivatives)
+    using StorageDiagonal = BlockDiagonalMatrix<typename JacobianMatrix::block_type>;
+
     /*!
      * \brief The constructor for stationary problems
      * \note the grid variables might be temporarily changed during assembly (if caching is enabled)
@@ -85,6 +92,7 @@ public:
     , gridVariables_(gridVariables)
     , timeLoop_()
     , isStationaryProblem_(true)
+    , localViews_([gridGeometry, gridVariables]{ return LocalAssembler::makeLocalViews(*gridGeometry, *gridVariables); })
     {
         static_assert(isImplicit, "Explicit assembler for stationary problem doesn't make sense!");
     }
@@ -105,6 +113,7 @@ public:
     , timeLoop_(timeLoop)
     , prevSol_(&prevSol)
     , isStationaryProblem_(!timeLoop)
+    , localViews_([gridGeometry, gridVariables]{ return LocalAssembler::makeLocalViews(*gridGeometry, *gridVariables); })
     {}
 
     /*!
@@ -120,10 +129,11 @@ public:
 
         assemble_([&](const Element& element)
         {
-            LocalAssembler localAssembler(*this, element, curSol);
+            LocalAssembler localAssembler(*this, element, curSol, localViews_.local());
             localAssembler.assembleJacobianAndResidual(*jacobian_, *residual_, *gridVariables_, partialReassembler);
         });
 
+        enforceInactiveElementConstraints_(*jacobian_);
         enforcePeriodicConstraints_(*jacobian_, *residual_, curSol, *gridGeometry_);
     }
 
@@ -137,9 +147,67 @@ public:
 
         assemble_([&](const Element& element)
         {
-            LocalAssembler localAssembler(*this, element, curSol);
+            LocalAssembler localAssembler(*this, element, curSol, localViews_.local());
             localAssembler.assembleJacobianAndResidual(*jacobian_, *gridVariables_);
         });
+
+        enforceInactiveElementConstraints_(*jacobian_);
+    }
+
+    /*!
+     * \brief Assembles the storage derivatives and the residual of an explicit scheme
+     *        without allocating a sparse Jacobian matrix.
+     *
+     * The Jacobian of an explicit time discretization only consists of the derivatives of the
+     * storage terms, which are assembled into a block diagonal matrix (see storageDiagonal()).
+     * The fluxes and sources of the residual are evaluated in the same pass over the elements.
+     */
+    void assembleStorageDiagonalAndResidual(const SolutionVector& curSol)
+    {
+        static_assert(!isImplicit, "The storage diagonal is only assembled for explicit schemes");
+
+        checkAssemblerState_();
+        resetStorageDiagonal_();
+        resetResidual_();
+
+        if constexpr (isBox)
+            if (!gridGeometry().periodicVertexMap().empty())
+                DUNE_THROW(Dune::NotImplemented, "Periodic boundaries for the storage diagonal of explicit schemes");
+
+        const DefaultPartialReassembler* noPartialReassembler = nullptr;
+        assemble_([&](const Element& element)
+        {
+            LocalAssembler localAssembler(*this, element, curSol, localViews_.local());
+            localAssembler.assembleJacobianAndResidual(*storageDiagonal_, *residual_, *gridVariables_, noPartialReassembler);
+        });
+
+        enforceInactiveElementConstraints_(*storageDiagonal_);
+    }
+
+    /*!
+     * \brief Computes the solution of an explicit time step and updates the grid variables
+     *
+     * This is equivalent to a LinearPDESolver step with the ExplicitDiagonalSolver, but neither
+     * a sparse matrix is allocated nor a linear solver is called: the storage diagonal and the
+     * residual are assembled (see assembleStorageDiagonalAndResidual()) and the update is computed
+     * by inverting the diagonal blocks.
+     *
+     * \param curSol the solution of the previous time step, overwritten with the new solution
+     * \note For the box scheme, only sequential runs are supported.
+     */
+    void explicitUpdate(SolutionVector& curSol)
+    {
+        if constexpr (isBox)
+            if (gridView().comm().size() > 1)
+                DUNE_THROW(Dune::NotImplemented, "Parallel explicit update for the box scheme");
+
+        assembleStorageDiagonalAndResidual(curSol);
+
+        SolutionVector deltaU(curSol);
+        storageDiagonal_->solve(deltaU, *residual_);
+        curSol -= deltaU;
+
+        updateGridVariables(curSol);
     }
 
     //! compute the residuals using the internal residual
@@ -156,7 +224,7 @@ public:
 
         assemble_([&](const Element& element)
         {
-            LocalAssembler localAssembler(*this, element, curSol);
+            LocalAssembler localAssembler(*this, element, curSol, localViews_.local());
             localAssembler.assembleResidual(r);
         });
     }
@@ -201,6 +269,31 @@ public:
         return sqrt(result2);
     }
 
+    /*!
+     * \brief Restrict the assembly to a subset of the elements (cell-centered schemes only)
+     *
+     * Only the active elements are assembled. The residual of the inactive elements is zero,
+     * their Jacobian rows are replaced by identity rows, such that a Newton update keeps their
+     * degrees of freedom unchanged. This can be used to skip parts of the domain where the solution
+     * does not change (e.g. dry cells in shallow water simulations).
+     *
+     * \param activeElements a flag for each element index, a nullptr activates all elements
+     */
+    void setActiveElements(std::shared_ptr<const std::vector<bool>> activeElements)
+    {
+        if constexpr (isBox)
+            DUNE_THROW(Dune::NotImplemented, "Restricting the assembly to active elements for the box scheme");
+
+        if (activeElements && activeElements->size() != gridGeometry().gridView().size(0))
+            DUNE_THROW(Dune::InvalidStateException, "The active element flags do not match the number of elements");
+
+        activeElements_ = activeElements;
+    }
+
+    //! The active element flags (nullptr if all elements are active)
+    const std::shared_ptr<const std::vector<bool>>& activeElements() const
+    { return activeElements_; }
+
     /*!
      * \brief Tells the assembler which jacobian and residual to use.
      *        This also resizes the containers to the required sizes and sets the
@@ -288,6 +381,10 @@ public:
     SolutionVector& residual()
     { return *residual_; }
 
+    //! The storage derivatives of explicit schemes (see assembleStorageDiagonalAndResidual())
+    const StorageDiagonal& storageDiagonal() const
+    { return *storageDiagonal_; }
+
     //! The solution of the previous time step
     const SolutionVector& prevSol() const
     { return *prevSol_; }
@@ -364,6 +461,16 @@ private:
             *jacobian_ = 0.0;
     }
 
+    // reset the storage diagonal to 0.0
+    void resetStorageDiagonal_()
+    {
+        if (!storageDiagonal_)
+            storageDiagonal_ = std::make_shared<StorageDiagonal>();
+
+        storageDiagonal_->resize(numDofs());
+        (*storageDiagonal_) = 0.0;
+    }
+
     // check if the assembler is in a correct state for assembly
     void checkAssemblerState_() const
     {
@@ -387,7 +494,8 @@ private:
         {
             // let the local assembler add the element contributions
             for (const auto& element : elements(gridView()))
-                assembleElement(element);
+                if (!activeElements_ || (*activeElements_)[gridGeometry().elementMapper().index(element)])
+                    assembleElement(element);
 
             // if we get here, everything worked well on this process
             succeeded = true;
@@ -410,6 +518,32 @@ private:
             DUNE_THROW(NumericalProblem, "A process did not succeed in linearizing the system");
     }
 
+    // replace the Jacobian rows of inactive elements by identity rows
+    template<class Matrix>
+    void enforceInactiveElementConstraints_(Matrix& jac) const
+    {
+        if constexpr (!isBox)
+        {
+            if (!activeElements_)
+                return;
+
+            for (std::size_t eIdx = 0; eIdx < activeElements_->size(); ++eIdx)
+            {
+                if ((*activeElements_)[eIdx])
+                    continue;
+
+                auto&& row = jac[eIdx];
+                for (auto it = row.begin(); it != row.end(); ++it)
+                {
+                    *it = 0.0;
+                    if (it.index() == eIdx)
+                        for (std::size_t i = 0; i < it->N(); ++i)
+                            (*it)[i][i] = 1.0;
+                }
+            }
+        }
+    }
+
     template<class GG> std::enable_if_t<GG::discMethod == DiscretizationMethod::box, void>
     enforcePeriodicConstraints_(JacobianMatrix& jac, SolutionVector& res, const SolutionVector& curSol, const GG& gridGeometry)
     {
@@ -455,6 +589,17 @@ private:
     //! shared pointers to the jacobian matrix and residual
     std::shared_ptr<JacobianMatrix> jacobian_;
     std::shared_ptr<SolutionVector> residual_;
+
+    //! the storage derivatives of explicit schemes (assembled without a sparse matrix)
+    std::shared_ptr<StorageDiagonal> storageDiagonal_;
+
+    //! the active element flags (all elements are assembled if not set)
+    std::shared_ptr<const std::vector<bool>> activeElements_;
+
+    //! the local views reused for all elements (one set per thread)
+    //! \note the factory only depends on the grid geometry and grid variables, not on the assembler
+    //!       (which is neither copyable nor movable since the storage is not)
+    mutable ThreadLocalStorage<typename LocalAssembler::LocalViews> localViews_;
 };
 
 } // namespace Dumux
@@ -24,6 +24,8 @@
 #ifndef DUMUX_FV_LOCAL_ASSEMBLER_BASE_HH
 #define DUMUX_FV_LOCAL_ASSEMBLER_BASE_HH
 
+#include <optional>
+
 #include <dune/common/reservedvector.hh>
 #include <dune/grid/common/gridenums.hh> // for GhostEntity
 #include <dune/istl/matrixindexset.hh>
@@ -67,6 +69,29 @@ public:
     using LocalResidual = GetPropType<TypeTag, Properties::LocalResidual>;
     using ElementResidualVector = typename LocalResidual::ElementResidualVector;
 
+    /*!
+     * \brief The local views used by the local assembler
+     * \note The local views can be reused for several elements (see the constructor taking LocalViews&),
+     *       such that their memory is only allocated once (e.g. once per thread, see ThreadLocalStorage)
+     */
+    struct LocalViews
+    {
+        FVElementGeometry fvGeometry;
+        ElementVolumeVariables curElemVolVars;
+        ElementVolumeVariables prevElemVolVars;
+        ElementFluxVariablesCache elemFluxVarsCache;
+    };
+
+    //! Create a set of (unbound) local views for the given grid geometry and grid variables
+    static LocalViews makeLocalViews(const typename FVElementGeometry::GridGeometry& gridGeometry,
+                                     const GridVariables& gridVariables)
+    {
+        return { localView(gridGeometry),
+                 localView(gridVariables.curGridVolVars()),
+                 localView(gridVariables.prevGridVolVars()),
+                 localView(gridVariables.gridFluxVarsCache()) };
+    }
+
     /*!
      * \brief The constructor. Delegates to the general constructor.
      */
@@ -84,6 +109,42 @@ public:
                            element.partitionType() == Dune::GhostEntity)
     {}
 
+    /*!
+     * \brief The constructor reusing existing local views (e.g. a per-thread workspace)
+     * \note The local views are rebound to the element, their previous state is overwritten.
+     *       They have to outlive the local assembler and must not be used concurrently elsewhere.
+     */
+    explicit FVLocalAssemblerBase(const Assembler& assembler,
+                                  const Element& element,
+                                  const SolutionVector& curSol,
+                                  LocalViews& localViews)
+    : FVLocalAssemblerBase(assembler,
+                           element,
+                           curSol,
+                           localViews,
+                           assembler.localResidual(),
+                           element.partitionType() == Dune::GhostEntity)
+    {}
+
+    /*!
+     * \brief The constructor reusing existing local views with an explicitly given local residual
+     * \note The local views are rebound to the element, their previous state is overwritten.
+     *       They have to outlive the local assembler and must not be used concurrently elsewhere.
+     */
+    explicit FVLocalAssemblerBase(const Assembler& assembler,
+                                  const Element& element,
+                                  const SolutionVector& curSol,
+                                  LocalViews& localViews,
+                                  const LocalResidual& localResidual,
+                                  const bool elementIsGhost)
+    : assembler_(assembler)
+    , element_(element)
+    , curSol_(curSol)
+    , localViews_(&localViews)
+    , localResidual_(localResidual)
+    , elementIsGhost_(elementIsGhost)
+    {}
+
     /*!
      * \brief The constructor. General version explicitly expecting each argument.
      */
@@ -99,14 +160,16 @@ public:
     : assembler_(assembler)
     , element_(element)
     , curSol_(curSol)
-    , fvGeometry_(fvGeometry)
-    , curElemVolVars_(curElemVolVars)
-    , prevElemVolVars_(prevElemVolVars)
-    , elemFluxVarsCache_(elemFluxVarsCache)
+    , ownedLocalViews_(LocalViews{fvGeometry, curElemVolVars, prevElemVolVars, elemFluxVarsCache})
+    , localViews_(&*ownedLocalViews_)
     , localResidual_(localResidual)
     , elementIsGhost_(elementIsGhost)
     {}
 
+    // the local views might be owned or referenced (not copyable)
+    FVLocalAssemblerBase(const FVLocalAssemblerBase&) = delete;
+    FVLocalAssemblerBase& operator=(const FVLocalAssemblerBase&) = delete;
+
     /*!
      * \brief Returns true if the assembler considers implicit assembly.
      */
@@ -165,7 +228,7 @@ public:
      */
     ElementResidualVector evalLocalFluxAndSourceResidual(const ElementVolumeVariables& elemVolVars) const
     {
-        return localResidual_.evalFluxAndSource(element_, fvGeometry_, elemVolVars, elemFluxVarsCache_, elemBcTypes_);
+        return localResidual_.evalFluxAndSource(element_, fvGeometry(), elemVolVars, elemFluxVarsCache(), elemBcTypes_);
     }
 
     /*!
@@ -175,7 +238,7 @@ public:
      */
     ElementResidualVector evalLocalStorageResidual() const
     {
-        return localResidual_.evalStorage(element_, fvGeometry_, prevElemVolVars_, curElemVolVars_);
+        return localResidual_.evalStorage(element_, fvGeometry(), prevElemVolVars(), curElemVolVars());
     }
 
     /*!
@@ -259,19 +322,19 @@ public:
 
     //! The global finite volume geometry
     FVElementGeometry& fvGeometry()
-    { return fvGeometry_; }
+    { return localViews_->fvGeometry; }
 
     //! The current element volume variables
     ElementVolumeVariables& curElemVolVars()
-    { return curElemVolVars_; }
+    { return localViews_->curElemVolVars; }
 
     //! The element volume variables of the provious time step
     ElementVolumeVariables& prevElemVolVars()
-    { return prevElemVolVars_; }
+    { return localViews_->prevElemVolVars; }
 
     //! The element flux variables cache
     ElementFluxVariablesCache& elemFluxVarsCache()
-    { return elemFluxVarsCache_; }
+    { return localViews_->elemFluxVarsCache; }
 
     //! The local residual for the current element
     LocalResidual& localResidual()
@@ -283,19 +346,19 @@ public:
 
     //! The finite volume geometry
     const FVElementGeometry& fvGeometry() const
-    { return fvGeometry_; }
+    { return localViews_->fvGeometry; }
 
     //! The current element volume variables
     const ElementVolumeVariables& curElemVolVars() const
-    { return curElemVolVars_; }
+    { return localViews_->curElemVolVars; }
 
     //! The element volume variables of the provious time step
     const ElementVolumeVariables& prevElemVolVars() const
-    { return prevElemVolVars_; }
+    { return localViews_->prevElemVolVars; }
 
     //! The element flux variables cache
     const ElementFluxVariablesCache& elemFluxVarsCache() const
-    { return elemFluxVarsCache_; }
+    { return localViews_->elemFluxVarsCache; }
 
     //! The element's boundary types
     const ElementBoundaryTypes& elemBcTypes() const
@@ -326,10 +389,8 @@ private:
     const Element& element_; //!< the element whose residual is assembled
     const SolutionVector& curSol_; //!< the current solution
 
-    FVElementGeometry fvGeometry_;
-    ElementVolumeVariables curElemVolVars_;
-    ElementVolumeVariables prevElemVolVars_;
-    ElementFluxVariablesCache elemFluxVarsCache_;
+    std::optional<LocalViews> ownedLocalViews_; //!< the local views if they are not provided by the caller
+    LocalViews* localViews_; //!< the local views (owned or provided by the caller)
     ElementBoundaryTypes elemBcTypes_;
 
     LocalResidual localResidual_; //!< the local residual evaluating the equations per element
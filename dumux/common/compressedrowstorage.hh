@@ -0,0 +1,121 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*****************************************************************************
+ *   See the file COPYING for full copying permissions.                      *
+ *                                                                           *
+ *   This program is free software: you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by    *
+ *   the Free Software Foundation, either version 3 of the License, or       *
+ *   (at your option) any later version.                                     *
+ *                                                                           *
+ *   This program is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the            *
+ *   GNU General Public License for more details.                            *
+ *                                                                           *
+ *   You should have received a copy of the GNU General Public License       *
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.   *
+ *****************************************************************************/
+/*!
+ * \file
+ * \ingroup Common
+ * \brief A container for rows of variable length stored in a single contiguous array
+ */
+#ifndef DUMUX_COMMON_COMPRESSED_ROW_STORAGE_HH
+#define DUMUX_COMMON_COMPRESSED_ROW_STORAGE_HH
+
+#include <vector>
+#include <utility>
+#include <iterator>
+
+#include <dumux/common/span.hh>
+
+namespace Dumux {
+
+/*!
+ * \ingroup Common
+ * \brief A container for rows of variable length (a "vector of vectors")
+ *        stored in a single contiguous array with an offset table (compressed row storage)
+ *
+ * In contrast to a std::vector<std::vector<T>>, this requires only two heap allocations
+ * and the rows are stored consecutively in memory. Rows are read-only views (Span) and
+ * the container is built once, either by appending rows in order or from (row, value) pairs.
+ */
+template<class T>
+class CompressedRowStorage
+{
+public:
+    using value_type = T;
+    using Row = Span<const T>;
+
+    CompressedRowStorage()
+    : offsets_(1, 0)
+    {}
+
+    //! remove all rows
+    void clear()
+    {
+        offsets_.assign(1, 0);
+        data_.clear();
+    }
+
+    //! reserve memory for a number of rows with (in total) numEntries entries
+    void reserve(std::size_t numRows, std::size_t numEntries = 0)
+    {
+        offsets_.reserve(numRows + 1);
+        data_.reserve(numEntries);
+    }
+
+    //! append a row (the row index is the number of previously appended rows)
+    template<class Range>
+    void push_back(const Range& row)
+    {
+        data_.insert(data_.end(), std::begin(row), std::end(row));
+        offsets_.push_back(data_.size());
+    }
+
+    /*!
+     * \brief Build the storage from (row, value) pairs given in arbitrary row order
+     * \param numRows the number of rows
+     * \param entries a container of (row index, value) pairs
+     * \note the order of the values within a row is the order of the entries (stable)
+     */
+    template<class Index>
+    void assign(std::size_t numRows, std::vector<std::pair<Index, T>>&& entries)
+    {
+        // count the entries per row and compute the offsets
+        offsets_.assign(numRows + 1, 0);
+        for (const auto& entry : entries)
+            ++offsets_[entry.first + 1];
+        for (std::size_t row = 0; row < numRows; ++row)
+            offsets_[row + 1] += offsets_[row];
+
+        // sort the values into their rows
+        std::vector<std::size_t> position(offsets_.begin(), offsets_.end() - 1);
+        std::vector<T> data(entries.size());
+        for (auto& entry : entries)
+            data[position[entry.first]++] = std::move(entry.second);
+
+        data_ = std::move(data);
+    }
+
+    //! the entries of a row
+    Row operator[](std::size_t row) const
+    { return { data_.data() + offsets_[row], data_.data() + offsets_[row + 1] }; }
+
+    //! the number of rows
+    std::size_t size() const
+    { return offsets_.size() - 1; }
+
+    //! the total number of entries in all rows
+    std::size_t numEntries() const
+    { return data_.size(); }
+
+private:
+    std::vector<std::size_t> offsets_;
+    std::vector<T> data_;
+};
+
+} // end namespace Dumux
+
+#endif
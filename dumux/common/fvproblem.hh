@@ -34,6 +34,7 @@
 #include <dumux/common/parameters.hh>
 #include <dumux/common/boundarytypes.hh>
 #include <dumux/discretization/method.hh>
+#include <dumux/common/pointsource.hh>
 #include <dumux/discretization/extrusion.hh>
 
 #include <dumux/assembly/initialsolution.hh>
@@ -69,6 +70,7 @@ class FVProblem
     using PointSourceHelper = GetPropType<TypeTag, Properties::PointSourceHelper>;
     using PointSourceMap = std::map< std::pair<std::size_t, std::size_t>,
                                      std::vector<PointSource> >;
+    using PointSourceIndex = Dumux::PointSourceIndex<PointSource>;
 
     static constexpr bool isBox = GridGeometry::discMethod == DiscretizationMethod::box;
     static constexpr bool isStaggered = GridGeometry::discMethod == DiscretizationMethod::staggered;
@@ -435,16 +437,21 @@ public:
                                 const SubControlVolume &scv) const
     {
         NumEqVector source(0);
-        auto scvIdx = scv.indexInElement();
-        auto key = std::make_pair(gridGeometry_->elementMapper().index(element), scvIdx);
-        if (pointSourceMap_.count(key))
+
+        // fast path for the (usually vast) majority of elements without point sources
+        const auto eIdx = gridGeometry_->elementMapper().index(element);
+        if (!pointSourceIndex_.hasSources(eIdx))
+            return source;
+
+        const auto pointSources = pointSourceIndex_.sources(eIdx, scv.indexInElement());
+        if (pointSources.begin() != pointSources.end())
         {
             // Add the contributions to the dof source values
             // We divide by the volume. In the local residual this will be multiplied with the same
             // factor again. That's because the user specifies absolute values in kg/s.
             const auto volume = Extrusion::volume(scv)*elemVolVars[scv].extrusionFactor();
 
-            for (const auto& ps : pointSourceMap_.at(key))
+            for (const auto& ps : pointSources)
             {
                 // we make a copy of the local point source here
                 auto pointSource = ps;
@@ -474,27 +481,46 @@ public:
     /*!
      * \brief Compute the point source map, i.e. which scvs have point source contributions
      * \note Call this on the problem before assembly if you want to enable point sources set
-     *       via the addPointSources member function.
+     *       via the addPointSources member function. Call it again if the point sources moved.
      */
     void computePointSourceMap()
     {
-        // clear the given point source maps in case it's not empty
-        pointSourceMap_.clear();
-
         // get and apply point sources if any given in the problem
         std::vector<PointSource> sources;
         asImp_().addPointSources(sources);
 
-        // if there are point sources calculate point source locations and save them in a map
+        // if there are point sources calculate point source locations and save them in a (temporary) map
+        PointSourceMap pointSourceMap;
         if (!sources.empty())
-            PointSourceHelper::computePointSourceMap(*gridGeometry_, sources, pointSourceMap_, paramGroup());
+            PointSourceHelper::computePointSourceMap(*gridGeometry_, sources, pointSourceMap, paramGroup());
+
+        // flatten the map into the element-indexed lookup structure used during assembly
+        // which is the only place the point sources are stored
+        if (pointSourceMap.empty())
+            pointSourceIndex_.clear();
+        else
+            pointSourceIndex_.update(gridGeometry_->gridView().size(0), pointSourceMap);
     }
 
     /*!
      * \brief Get the point source map. It stores the point sources per scv
+     * \note The map is reconstructed from the point source index on every call
+     */
+    [[deprecated("Use pointSourceIndex(). Will be removed after 3.4")]]
+    PointSourceMap pointSourceMap() const
+    {
+        PointSourceMap pointSourceMap;
+        pointSourceIndex_.forEachScv([&](std::size_t eIdx, std::size_t scvIdx, const auto& scvSources){
+            pointSourceMap.emplace(std::make_pair(eIdx, scvIdx), std::vector<PointSource>(scvSources.begin(), scvSources.end()));
+        });
+        return pointSourceMap;
+    }
+
+    /*!
+     * \brief Get the element-indexed point source lookup structure
      */
-    const PointSourceMap& pointSourceMap() const
-    { return pointSourceMap_; }
+    const PointSourceIndex& pointSourceIndex() const
+    { return pointSourceIndex_; }
 
     /*!
      * \brief Applies the initial solution for all degrees of freedom of the grid.
@@ -597,8 +623,8 @@ private:
     //! The name of the problem
     std::string problemName_;
 
-    //! A map from an scv to a vector of point sources
-    PointSourceMap pointSourceMap_;
+    //! The point sources in flat element-indexed storage (used during assembly)
+    PointSourceIndex pointSourceIndex_;
 };
 
 } // end namespace Dumux
@@ -27,8 +27,12 @@
 #define DUMUX_POINTSOURCE_HH
 
 #include <functional>
+#include <vector>
+#include <utility>
+#include <algorithm>
 
 #include <dune/common/reservedvector.hh>
+#include <dune/common/iteratorrange.hh>
 #include <dumux/common/properties.hh>
 #include <dumux/common/parameters.hh>
 #include <dumux/geometry/boundingboxtree.hh>
@@ -345,6 +349,119 @@ public:
     }
 };
 
+/*!
+ * \ingroup Common
+ * \brief An element-indexed lookup structure for point sources
+ *
+ * Stores the point sources contained in a (element, scv)-keyed point source map
+ * in a flat compressed row storage indexed by the element index. Elements without
+ * any point source are marked in a bitset such that the lookup for the (usually vast)
+ * majority of source-free elements is a single bit test.
+ */
+template<class PointSource>
+class PointSourceIndex
+{
+    using SourceIterator = typename std::vector<PointSource>::const_iterator;
+
+public:
+    /*!
+     * \brief Rebuild the index from a point source map
+     * \param numElements the number of elements of the grid
+     * \param pointSourceMap a map from (element index, local scv index) to a vector of point sources
+     * \note The map is expected to be ordered by key (e.g. std::map), the cost is linear
+     *       in the number of elements and point sources. The point sources are copied, the
+     *       map is not needed anymore after the update. The index reuses its memory such that
+     *       an update after point sources moved does not reallocate unless the number of sources grows.
+     */
+    template<class PointSourceMap>
+    void update(std::size_t numElements, const PointSourceMap& pointSourceMap)
+    {
+        hasSources_.assign(numElements, false);
+        elementOffsets_.assign(numElements + 1, 0);
+        scvIndices_.clear();
+        sourceOffsets_.assign(1, 0);
+        sources_.clear();
+
+        // count the scv entries per element
+        for (const auto& [key, scvSources] : pointSourceMap)
+        {
+            if (scvSources.empty())
+                continue;
+
+            hasSources_[key.first] = true;
+            ++elementOffsets_[key.first + 1];
+        }
+
+        for (std::size_t eIdx = 0; eIdx < numElements; ++eIdx)
+            elementOffsets_[eIdx + 1] += elementOffsets_[eIdx];
+
+        // the map is ordered by element index (first) and scv index (second)
+        scvIndices_.reserve(elementOffsets_.back());
+        sourceOffsets_.reserve(elementOffsets_.back() + 1);
+        for (const auto& [key, scvSources] : pointSourceMap)
+        {
+            if (scvSources.empty())
+                continue;
+
+            scvIndices_.push_back(key.second);
+            sources_.insert(sources_.end(), scvSources.begin(), scvSources.end());
+            sourceOffsets_.push_back(sources_.size());
+        }
+    }
+
+    //! remove all point sources
+    void clear()
+    {
+        hasSources_.clear();
+        elementOffsets_.clear();
+        scvIndices_.clear();
+        sourceOffsets_.clear();
+        sources_.clear();
+    }
+
+    //! if there are point sources in the element with the given index
+    bool hasSources(std::size_t eIdx) const
+    { return !hasSources_.empty() && hasSources_[eIdx]; }
+
+    //! the point sources in the scv with the given local index in the element with the given index
+    Dune::IteratorRange<SourceIterator> sources(std::size_t eIdx, std::size_t scvIdx) const
+    {
+        if (!hasSources(eIdx))
+            return { sources_.end(), sources_.end() };
+
+        for (std::size_t i = elementOffsets_[eIdx]; i < elementOffsets_[eIdx+1]; ++i)
+            if (scvIndices_[i] == scvIdx)
+                return { sources_.begin() + sourceOffsets_[i], sources_.begin() + sourceOffsets_[i+1] };
+
+        return { sources_.end(), sources_.end() };
+    }
+
+    //! the total number of (possibly split) point sources
+    std::size_t size() const
+    { return sources_.size(); }
+
+    /*!
+     * \brief Call f(eIdx, scvIdx, sources) for every scv containing point sources
+     * \note The scvs are visited ordered by element index and, within an element,
+     *       in the order of the point source map the index was built from
+     */
+    template<class F>
+    void forEachScv(F&& f) const
+    {
+        for (std::size_t eIdx = 0; eIdx + 1 < elementOffsets_.size(); ++eIdx)
+            for (std::size_t i = elementOffsets_[eIdx]; i < elementOffsets_[eIdx+1]; ++i)
+                f(eIdx, scvIndices_[i], Dune::IteratorRange<SourceIterator>(sources_.begin() + sourceOffsets_[i],
+                                                                           sources_.begin() + sourceOffsets_[i+1]));
+    }
+
+private:
+    std::vector<bool> hasSources_;
+    std::vector<std::size_t> elementOffsets_;
+    std::vector<std::size_t> scvIndices_;
+    std::vector<std::size_t> sourceOffsets_;
+    std::vector<PointSource> sources_;
+};
+
 } // end namespace Dumux
 
 #endif
@@ -0,0 +1,341 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*****************************************************************************
+ *   See the file COPYING for full copying permissions.                      *
+ *                                                                           *
+ *   This program is free software: you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by    *
+ *   the Free Software Foundation, either version 3 of the License, or       *
+ *   (at your option) any later version.                                     *
+ *                                                                           *
+ *   This program is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the            *
+ *   GNU General Public License for more details.                            *
+ *                                                                           *
+ *   You should have received a copy of the GNU General Public License       *
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.   *
+ *****************************************************************************/
+/*!
+ * \file
+ * \ingroup Common
+ * \brief Batches of small dense matrices and vectors of fixed size
+ *        with kernels (LU, solve, inverse, matrix-vector product) operating on all of them at once
+ */
+#ifndef DUMUX_COMMON_SMALL_MATRIX_BATCH_HH
+#define DUMUX_COMMON_SMALL_MATRIX_BATCH_HH
+
+#include <cmath>
+#include <vector>
+#include <utility>
+#include <cstddef>
+
+#include <dune/common/exceptions.hh>
+#include <dumux/common/exceptions.hh>
+
+namespace Dumux {
+
+#ifndef DOXYGEN
+namespace Detail {
+
+//! the number of entries of a batch is padded to a multiple of this (SIMD lanes)
+inline constexpr std::size_t smallMatrixBatchPadding = 8;
+
+//! the distance between two consecutive entries of the same matrix/vector
+inline constexpr std::size_t smallMatrixBatchStride(std::size_t size)
+{ return (size + smallMatrixBatchPadding - 1)/smallMatrixBatchPadding*smallMatrixBatchPadding; }
+
+} // end namespace Detail
+#endif // DOXYGEN
+
+/*!
+ * \ingroup Common
+ * \brief A batch of small dense vectors of size n
+ *
+ * The vectors are stored interleaved, i.e. the i-th entries of all vectors are consecutive in memory.
+ * \tparam Scalar the scalar type
+ * \tparam n the size of the vectors
+ */
+template<class Scalar, int n>
+class SmallVectorBatch
+{
+public:
+    explicit SmallVectorBatch(std::size_t size = 0)
+    { resize(size); }
+
+    //! set the number of vectors (all entries are set to zero)
+    void resize(std::size_t size)
+    {
+        size_ = size;
+        stride_ = Detail::smallMatrixBatchStride(size);
+        data_.assign(n*stride_, 0.0);
+    }
+
+    //! the number of vectors
+    std::size_t size() const
+    { return size_; }
+
+    //! entry i of vector k
+    Scalar& operator()(std::size_t k, int i)
+    { return data_[i*stride_ + k]; }
+
+    //! entry i of vector k
+    const Scalar& operator()(std::size_t k, int i) const
+    { return data_[i*stride_ + k]; }
+
+    //! copy a vector (any type with operator[]) into position k
+    template<class Vector>
+    void set(std::size_t k, const Vector& v)
+    {
+        for (int i = 0; i < n; ++i)
+            (*this)(k, i) = v[i];
+    }
+
+    //! copy the vector at position k into v (any type with operator[])
+    template<class Vector>
+    void get(std::size_t k, Vector& v) const
+    {
+        for (int i = 0; i < n; ++i)
+            v[i] = (*this)(k, i);
+    }
+
+    //! pointer to the i-th entries of all vectors
+    Scalar* row(int i)
+    { return data_.data() + i*stride_; }
+
+    //! pointer to the i-th entries of all vectors
+    const Scalar* row(int i) const
+    { return data_.data() + i*stride_; }
+
+private:
+    std::size_t size_;
+    std::size_t stride_;
+    std::vector<Scalar> data_;
+};
+
+/*!
+ * \ingroup Common
+ * \brief A batch of small dense n x n matrices
+ *
+ * The matrices are stored interleaved, i.e. the (i, j)-th entries of all matrices are consecutive
+ * in memory, such that the kernels operate on contiguous arrays in their innermost loop over the
+ * matrices, which can be vectorized by the compiler. This pays off when many matrices of the same
+ * (small) size are to be factorized, inverted or multiplied, e.g. the diagonal blocks of a block matrix.
+ *
+ * \tparam Scalar the scalar type
+ * \tparam n the number of rows and columns of the matrices
+ */
+template<class Scalar, int n>
+class SmallMatrixBatch
+{
+public:
+    using VectorBatch = SmallVectorBatch<Scalar, n>;
+
+    explicit SmallMatrixBatch(std::size_t size = 0)
+    { resize(size); }
+
+    //! set the number of matrices (all entries are set to zero)
+    void resize(std::size_t size)
+    {
+        size_ = size;
+        stride_ = Detail::smallMatrixBatchStride(size);
+        data_.assign(n*n*stride_, 0.0);
+        pivots_.clear();
+    }
+
+    //! the number of matrices
+    std::size_t size() const
+    { return size_; }
+
+    //! entry (i, j) of matrix k
+    Scalar& operator()(std::size_t k, int i, int j)
+    { return data_[(i*n + j)*stride_ + k]; }
+
+    //! entry (i, j) of matrix k
+    const Scalar& operator()(std::size_t k, int i, int j) const
+    { return data_[(i*n + j)*stride_ + k]; }
+
+    //! copy a matrix (any type with m[i][j]) into position k
+    template<class Matrix>
+    void set(std::size_t k, const Matrix& m)
+    {
+        for (int i = 0; i < n; ++i)
+            for (int j = 0; j < n; ++j)
+                (*this)(k, i, j) = m[i][j];
+    }
+
+    //! copy the matrix at position k into m (any type with m[i][j])
+    template<class Matrix>
+    void get(std::size_t k, Matrix& m) const
+    {
+        for (int i = 0; i < n; ++i)
+            for (int j = 0; j < n; ++j)
+                m[i][j] = (*this)(k, i, j);
+    }
+
+    /*!
+     * \brief Compute the LU decompositions (with partial pivoting) of all matrices in place
+     * \throws NumericalProblem if one of the matrices is singular
+     */
+    void factorize()
+    {
+        using std::abs;
+        pivots_.assign(n*stride_, 0);
+        for (int c = 0; c < n; ++c)
+        {
+            // pivot search and row swaps (per matrix)
+            for (std::size_t k = 0; k < size_; ++k)
+            {
+                int p = c;
+                for (int i = c+1; i < n; ++i)
+                    if (abs((*this)(k, i, c)) > abs((*this)(k, p, c)))
+                        p = i;
+
+                if ((*this)(k, p, c) == 0.0)
+                    DUNE_THROW(NumericalProblem, "Matrix " << k << " of the batch is singular");
+
+                pivots_[c*stride_ + k] = p;
+                if (p != c)
+                    for (int j = 0; j < n; ++j)
+                        std::swap((*this)(k, c, j), (*this)(k, p, j));
+            }
+
+            // elimination (vectorizable loops over all matrices)
+            const Scalar* pivotRow = entries_(c, c);
+            for (int i = c+1; i < n; ++i)
+            {
+                Scalar* l = entries_(i, c);
+                for (std::size_t k = 0; k < size_; ++k)
+                    l[k] /= pivotRow[k];
+
+                for (int j = c+1; j < n; ++j)
+                {
+                    Scalar* a = entries_(i, j);
+                    const Scalar* u = entries_(c, j);
+                    for (std::size_t k = 0; k < size_; ++k)
+                        a[k] -= l[k]*u[k];
+                }
+            }
+        }
+    }
+
+    /*!
+     * \brief Solve A_k x_k = b_k for all matrices using the LU decompositions
+     * \param x the right hand sides, overwritten with the solutions
+     * \note factorize() has to be called before
+     */
+    void solve(VectorBatch& x) const
+    {
+        if (pivots_.empty())
+            DUNE_THROW(Dune::InvalidStateException, "The matrices have to be factorized before calling solve");
+
+        // row permutations
+        for (int c = 0; c < n; ++c)
+            for (std::size_t k = 0; k < size_; ++k)
+                if (const int p = pivots_[c*stride_ + k]; p != c)
+                    std::swap(x(k, c), x(k, p));
+
+        // forward substitution (unit lower triangular)
+        for (int i = 1; i < n; ++i)
+        {
+            Scalar* xi = x.row(i);
+            for (int j = 0; j < i; ++j)
+            {
+                const Scalar* l = entries_(i, j);
+                const Scalar* xj = x.row(j);
+                for (std::size_t k = 0; k < size_; ++k)
+                    xi[k] -= l[k]*xj[k];
+            }
+        }
+
+        // backward substitution
+        for (int i = n-1; i >= 0; --i)
+        {
+            Scalar* xi = x.row(i);
+            for (int j = i+1; j < n; ++j)
+            {
+                const Scalar* u = entries_(i, j);
+                const Scalar* xj = x.row(j);
+                for (std::size_t k = 0; k < size_; ++k)
+                    xi[k] -= u[k]*xj[k];
+            }
+
+            const Scalar* d = entries_(i, i);
+            for (std::size_t k = 0; k < size_; ++k)
+                xi[k] /= d[k];
+        }
+    }
+
+    /*!
+     * \brief Replace all matrices by their inverses
+     * \throws NumericalProblem if one of the matrices is singular
+     */
+    void invert()
+    {
+        factorize();
+
+        // solve for the unit vectors, column c of the inverses
+        SmallMatrixBatch inverse(size_);
+        VectorBatch column(size_);
+        for (int c = 0; c < n; ++c)
+        {
+            for (int i = 0; i < n; ++i)
+            {
+                Scalar* ci = column.row(i);
+                for (std::size_t k = 0; k < size_; ++k)
+                    ci[k] = (i == c) ? 1.0 : 0.0;
+            }
+
+            solve(column);
+
+            for (int i = 0; i < n; ++i)
+            {
+                Scalar* inv = inverse.entries_(i, c);
+                const Scalar* ci = column.row(i);
+                for (std::size_t k = 0; k < size_; ++k)
+                    inv[k] = ci[k];
+            }
+        }
+
+        data_ = std::move(inverse.data_);
+        pivots_.clear();
+    }
+
+    /*!
+     * \brief Compute y_k = A_k x_k for all matrices
+     * \note must not be called on factorized matrices
+     */
+    void mv(const VectorBatch& x, VectorBatch& y) const
+    {
+        for (int i = 0; i < n; ++i)
+        {
+            Scalar* yi = y.row(i);
+            for (std::size_t k = 0; k < size_; ++k)
+                yi[k] = 0.0;
+
+            for (int j = 0; j < n; ++j)
+            {
+                const Scalar* a = entries_(i, j);
+                const Scalar* xj = x.row(j);
+                for (std::size_t k = 0; k < size_; ++k)
+                    yi[k] += a[k]*xj[k];
+            }
+        }
+    }
+
+private:
+    Scalar* entries_(int i, int j)
+    { return data_.data() + (i*n + j)*stride_; }
+
+    const Scalar* entries_(int i, int j) const
+    { return data_.data() + (i*n + j)*stride_; }
+
+    std::size_t size_;
+    std::size_t stride_;
+    std::vector<Scalar> data_;
+    std::vector<int> pivots_; //!< the row permutations of the LU decompositions (empty if not factorized)
+};
+
+} // end namespace Dumux
+
+#endif
@@ -0,0 +1,98 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*****************************************************************************
+ *   See the file COPYING for full copying permissions.                      *
+ *                                                                           *
+ *   This program is free software: you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by    *
+ *   the Free Software Foundation, either version 3 of the License, or       *
+ *   (at your option) any later version.                                     *
+ *                                                                           *
+ *   This program is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the            *
+ *   GNU General Public License for more details.                            *
+ *                                                                           *
+ *   You should have received a copy of the GNU General Public License       *
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.   *
+ *****************************************************************************/
+/*!
+ * \file
+ * \ingroup Common
+ * \brief A non-owning view on a contiguous sequence of objects
+ */
+#ifndef DUMUX_COMMON_SPAN_HH
+#define DUMUX_COMMON_SPAN_HH
+
+#include <cstddef>
+#include <cassert>
+#include <type_traits>
+
+namespace Dumux {
+
+/*!
+ * \ingroup Common
+ * \brief A non-owning view on a contiguous sequence of objects
+ *        (a minimal replacement for C++20's std::span)
+ *
+ * This is e.g. used to expose the element-wise parts of data that is
+ * stored in a single flat array with an offset table.
+ */
+template<class T>
+class Span
+{
+public:
+    using element_type = T;
+    using value_type = std::remove_cv_t<T>;
+    using size_type = std::size_t;
+    using pointer = T*;
+    using reference = T&;
+    using iterator = T*;
+    using const_iterator = const T*;
+
+    //! construct an empty span
+    Span() = default;
+
+    //! construct a span from a pointer to the first element and the number of elements
+    Span(pointer data, size_type size)
+    : data_(data), size_(size) {}
+
+    //! construct a span from a range of pointers [begin, end)
+    Span(pointer begin, pointer end)
+    : data_(begin), size_(end - begin) {}
+
+    iterator begin() const
+    { return data_; }
+
+    iterator end() const
+    { return data_ + size_; }
+
+    reference operator[](size_type i) const
+    {
+        assert(i < size_ && "index out of range");
+        return data_[i];
+    }
+
+    reference front() const
+    { return data_[0]; }
+
+    reference back() const
+    { return data_[size_-1]; }
+
+    pointer data() const
+    { return data_; }
+
+    size_type size() const
+    { return size_; }
+
+    bool empty() const
+    { return size_ == 0; }
+
+private:
+    pointer data_ = nullptr;
+    size_type size_ = 0;
+};
+
+} // end namespace Dumux
+
+#endif
@@ -86,9 +86,21 @@ public:
         return ScvfCornerStorage{{geometry.corner(0)}};
     }
 
+    /*!
+     * \brief Create the sub control volume face geometries on the boundary from the element geometry
+     * \param localFacetIndex the local index of the element facet on the boundary
+     * \param indexInFacet the local index of the vertex in the facet the scvf belongs to
+     */
+    ScvfCornerStorage getBoundaryScvfCorners(unsigned int localFacetIndex,
+                                             unsigned int indexInFacet) const
+    {
+        return ScvfCornerStorage{{p_[localFacetIndex+1]}};
+    }
+
     //! get scvf normal vector
+    template<class ScvIndices>
     GlobalPosition normal(const ScvfCornerStorage& scvfCorners,
-                          const std::vector<unsigned int>& scvIndices) const
+                          const ScvIndices& scvIndices) const
     {
         auto normal = p_[2] - p_[1];
         normal /= normal.two_norm();
@@ -259,11 +271,31 @@ public:
             DUNE_THROW(Dune::InvalidStateException, "local index exceeds the number of corners of 2d intersections");
     }
 
+    /*!
+     * \brief Create the sub control volume face geometries on the boundary from the element geometry
+     * \param localFacetIndex the local index of the element facet on the boundary
+     * \param indexInFacet the local index of the vertex in the facet the scvf belongs to
+     */
+    ScvfCornerStorage getBoundaryScvfCorners(unsigned int localFacetIndex,
+                                             unsigned int indexInFacet) const
+    {
+        const auto refElement = referenceElement(elementGeometry_);
+
+        const auto vIdxLocal = refElement.subEntity(localFacetIndex, 1, indexInFacet, dim);
+        const auto& facetCenter = p_[localFacetIndex+corners_+1];
+        if (indexInFacet == 0)
+            return ScvfCornerStorage({p_[vIdxLocal+1], facetCenter});
+        else if (indexInFacet == 1)
+            return ScvfCornerStorage({facetCenter, p_[vIdxLocal+1]});
+        else
+            DUNE_THROW(Dune::InvalidStateException, "local index exceeds the number of corners of 2d intersections");
+    }
+
     //! get scvf normal vector for dim == 2, dimworld == 3
-    template <int w = dimWorld>
+    template <class ScvIndices, int w = dimWorld>
     typename std::enable_if<w == 3, GlobalPosition>::type
     normal(const ScvfCornerStorage& scvfCorners,
-           const std::vector<unsigned int>& scvIndices) const
+           const ScvIndices& scvIndices) const
     {
         const auto v1 = elementGeometry_.corner(1) - elementGeometry_.corner(0);
         const auto v2 = elementGeometry_.corner(2) - elementGeometry_.corner(0);
@@ -282,10 +314,10 @@ public:
     }
 
     //! get scvf normal vector for dim == 2, dimworld == 2
-    template <int w = dimWorld>
+    template <class ScvIndices, int w = dimWorld>
     typename std::enable_if<w == 2, GlobalPosition>::type
     normal(const ScvfCornerStorage& scvfCorners,
-           const std::vector<unsigned int>& scvIndices) const
+           const ScvIndices& scvIndices) const
     {
         //! obtain normal vector by 90° counter-clockwise rotation of t
         const auto t = scvfCorners[1] - scvfCorners[0];
@@ -572,6 +604,74 @@ public:
             pi[i+corners+1] = p_[edgeIdxLocal+corners_+1];
         }
 
+        return boundaryScvfCorners_(pi, corners, indexInIntersection);
+    }
+
+    /*!
+     * \brief Create the sub control volume face geometries on the boundary from the element geometry
+     * \param localFacetIndex the local index of the element facet on the boundary
+     * \param indexInFacet the local index of the vertex in the facet the scvf belongs to
+     */
+    ScvfCornerStorage getBoundaryScvfCorners(unsigned int localFacetIndex,
+                                             unsigned int indexInFacet) const
+    {
+        const auto refElement = referenceElement(elementGeometry_);
+        const auto corners = refElement.size(localFacetIndex, 1, dim);
+        const auto numEdges = refElement.size(dim-1);
+
+        GlobalPosition pi[9];
+
+        // the facet center
+        pi[0] = p_[localFacetIndex+corners_+1+numEdges];
+
+        // corners
+        for (int i = 0; i < corners; ++i)
+            pi[i+1] = p_[refElement.subEntity(localFacetIndex, 1, i, dim)+1];
+
+        // edge midpoints
+        for (int i = 0; i < refElement.size(localFacetIndex, 1, dim-1); ++i)
+            pi[i+corners+1] = p_[refElement.subEntity(localFacetIndex, 1, i, dim-1)+corners_+1];
+
+        return boundaryScvfCorners_(pi, corners, indexInFacet);
+    }
+
+    //! get scvf normal vector
+    template<class ScvIndices>
+    GlobalPosition normal(const ScvfCornerStorage& p,
+                          const ScvIndices& scvIndices) const
+    {
+        auto normal = Dumux::crossProduct(p[1]-p[0], p[2]-p[0]);
+        normal /= normal.two_norm();
+
+        const auto v = elementGeometry_.corner(scvIndices[1]) - elementGeometry_.corner(scvIndices[0]);
+        const auto s = v*normal;
+        if (std::signbit(s))
+            normal *= -1;
+
+        return normal;
+    }
+
+    //! get scv volume
+    Scalar scvVolume(const ScvCornerStorage& p) const
+    {
+        // after Grandy 1997, Efficient computation of volume of hexahedron
+        const auto v = p[7]-p[0];
+        return 1.0/6.0 * ( Dumux::tripleProduct(v, p[1]-p[0], p[3]-p[5])
+                         + Dumux::tripleProduct(v, p[4]-p[0], p[5]-p[6])
+                         + Dumux::tripleProduct(v, p[2]-p[0], p[6]-p[3]));
+    }
+
+    //! get scvf area
+    Scalar scvfArea(const ScvfCornerStorage& p) const
+    {
+        // after Wolfram alpha quadrilateral area
+        return 0.5*Dumux::crossProduct(p[3]-p[0], p[2]-p[1]).two_norm();
+    }
+
+private:
+    //! the boundary scvf corners from the points of the facet (center, corners, edge midpoints)
+    ScvfCornerStorage boundaryScvfCorners_(const GlobalPosition* pi, int corners, unsigned int indexInFacet) const
+    {
         // procees according to number of corners
         switch (corners)
         {
@@ -587,10 +687,10 @@ public:
                 {vo+2, eo+1, eo+2, 0}
             };
 
-            return ScvfCornerStorage{ {pi[map[indexInIntersection][0]],
-                                       pi[map[indexInIntersection][1]],
-                                       pi[map[indexInIntersection][2]],
-                                       pi[map[indexInIntersection][3]]} };
+            return ScvfCornerStorage{ {pi[map[indexInFacet][0]],
+                                       pi[map[indexInFacet][1]],
+                                       pi[map[indexInFacet][2]],
+                                       pi[map[indexInFacet][3]]} };
         }
         case 4: // quadrilateral
         {
@@ -605,10 +705,10 @@ public:
                 {vo+3, eo+3, eo+1, 0}
             };
 
-            return ScvfCornerStorage{ {pi[map[indexInIntersection][0]],
-                                       pi[map[indexInIntersection][1]],
-                                       pi[map[indexInIntersection][2]],
-                                       pi[map[indexInIntersection][3]]} };
+            return ScvfCornerStorage{ {pi[map[indexInFacet][0]],
+                                       pi[map[indexInFacet][1]],
+                                       pi[map[indexInFacet][2]],
+                                       pi[map[indexInFacet][3]]} };
         }
         default:
             DUNE_THROW(Dune::NotImplemented, "Box scvf boundary geometries for dim=" << dim
@@ -617,38 +717,6 @@ public:
         }
     }
 
-    //! get scvf normal vector
-    GlobalPosition normal(const ScvfCornerStorage& p,
-                          const std::vector<unsigned int>& scvIndices) const
-    {
-        auto normal = Dumux::crossProduct(p[1]-p[0], p[2]-p[0]);
-        normal /= normal.two_norm();
-
-        const auto v = elementGeometry_.corner(scvIndices[1]) - elementGeometry_.corner(scvIndices[0]);
-        const auto s = v*normal;
-        if (std::signbit(s))
-            normal *= -1;
-
-        return normal;
-    }
-
-    //! get scv volume
-    Scalar scvVolume(const ScvCornerStorage& p) const
-    {
-        // after Grandy 1997, Efficient computation of volume of hexahedron
-        const auto v = p[7]-p[0];
-        return 1.0/6.0 * ( Dumux::tripleProduct(v, p[1]-p[0], p[3]-p[5])
-                         + Dumux::tripleProduct(v, p[4]-p[0], p[5]-p[6])
-                         + Dumux::tripleProduct(v, p[2]-p[0], p[6]-p[3]));
-    }
-
-    //! get scvf area
-    Scalar scvfArea(const ScvfCornerStorage& p) const
-    {
-        // after Wolfram alpha quadrilateral area
-        return 0.5*Dumux::crossProduct(p[3]-p[0], p[2]-p[1]).two_norm();
-    }
-
 protected:
     const typename Element::Geometry& elementGeometry_; //!< Reference to the element geometry
     std::size_t corners_; // number of element corners
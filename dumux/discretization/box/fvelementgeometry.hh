@@ -26,7 +26,10 @@
 #ifndef DUMUX_DISCRETIZATION_BOX_FV_ELEMENT_GEOMETRY_HH
 #define DUMUX_DISCRETIZATION_BOX_FV_ELEMENT_GEOMETRY_HH
 
+#include <array>
 #include <optional>
+#include <dune/common/std/type_traits.hh>
+#include <dune/common/iteratorrange.hh>
 #include <dune/geometry/type.hh>
 #include <dune/localfunctions/lagrange/pqkfactory.hh>
 
@@ -35,6 +38,38 @@
 #include <dumux/discretization/box/boxgeometryhelper.hh>
 
 namespace Dumux {
+namespace Detail {
+
+//! helper alias to detect sub control volume faces that store their geometry
+template<class SubControlVolumeFace>
+using ScvfGeometryDetector = decltype(std::declval<SubControlVolumeFace>().geometry());
+
+/*!
+ * \ingroup BoxDiscretization
+ * \brief The geometry of a box sub control volume face
+ * \note Faces that do not store their corners (e.g. BoxCompactSubControlVolumeFace)
+ *       are reconstructed from the element geometry
+ */
+template<class GeometryHelper, class Element, class SubControlVolumeFace>
+auto boxScvfGeometry(const Element& element, const SubControlVolumeFace& scvf)
+{
+    if constexpr (Dune::Std::is_detected_v<ScvfGeometryDetector, SubControlVolumeFace>)
+        return scvf.geometry();
+    else
+    {
+        using Geometry = typename SubControlVolumeFace::Geometry;
+        const auto elementGeometry = element.geometry();
+        const GeometryHelper geometryHelper(elementGeometry);
+        if (scvf.boundary())
+            return Geometry(Dune::GeometryTypes::cube(Geometry::mydimension),
+                            geometryHelper.getBoundaryScvfCorners(scvf.facetIndex(), scvf.indexInFacet()));
+        else
+            return Geometry(Dune::GeometryTypes::cube(Geometry::mydimension),
+                            geometryHelper.getScvfCorners(scvf.index()));
+    }
+}
+
+} // end namespace Detail
 
 /*!
  * \ingroup BoxDiscretization
@@ -58,6 +93,10 @@ class BoxFVElementGeometry<GG, true>
     using LocalIndexType = typename IndexTraits<GridView>::LocalIndex;
     using CoordScalar = typename GridView::ctype;
     using FeLocalBasis = typename GG::FeCache::FiniteElementType::Traits::LocalBasisType;
+
+    using GeometryHelper = BoxGeometryHelper<GridView, dim,
+                                             typename GG::SubControlVolume,
+                                             typename GG::SubControlVolumeFace>;
 public:
     //! export the element type
     using Element = typename GridView::template Codim<0>::Entity;
@@ -91,12 +130,11 @@ public:
     //! This is a free function found by means of ADL
     //! To iterate over all sub control volumes of this FVElementGeometry use
     //! for (auto&& scv : scvs(fvGeometry))
-    friend inline Dune::IteratorRange<typename std::vector<SubControlVolume>::const_iterator>
+    friend inline Dune::IteratorRange<const SubControlVolume*>
     scvs(const BoxFVElementGeometry& fvGeometry)
     {
-        const auto& g = fvGeometry.gridGeometry();
-        using Iter = typename std::vector<SubControlVolume>::const_iterator;
-        return Dune::IteratorRange<Iter>(g.scvs(fvGeometry.eIdx_).begin(), g.scvs(fvGeometry.eIdx_).end());
+        const auto elementScvs = fvGeometry.gridGeometry().scvs(fvGeometry.eIdx_);
+        return Dune::IteratorRange<const SubControlVolume*>(elementScvs.begin(), elementScvs.end());
     }
 
     //! iterator range for sub control volumes faces. Iterates over
@@ -104,14 +142,18 @@ public:
     //! This is a free function found by means of ADL
     //! To iterate over all sub control volume faces of this FVElementGeometry use
     //! for (auto&& scvf : scvfs(fvGeometry))
-    friend inline Dune::IteratorRange<typename std::vector<SubControlVolumeFace>::const_iterator>
+    friend inline Dune::IteratorRange<const SubControlVolumeFace*>
     scvfs(const BoxFVElementGeometry& fvGeometry)
     {
-        const auto& g = fvGeometry.gridGeometry();
-        using Iter = typename std::vector<SubControlVolumeFace>::const_iterator;
-        return Dune::IteratorRange<Iter>(g.scvfs(fvGeometry.eIdx_).begin(), g.scvfs(fvGeometry.eIdx_).end());
+        const auto elementScvfs = fvGeometry.gridGeometry().scvfs(fvGeometry.eIdx_);
+        return Dune::IteratorRange<const SubControlVolumeFace*>(elementScvfs.begin(), elementScvfs.end());
     }
 
+    //! The geometry of a sub control volume face of the bound element
+    //! (also available for sub control volume faces that do not store their corners)
+    auto geometry(const SubControlVolumeFace& scvf) const
+    { return Detail::boxScvfGeometry<GeometryHelper>(*element_, scvf); }
+
     //! Get a local finite element basis
     const FeLocalBasis& feLocalBasis() const
     {
@@ -238,6 +280,11 @@ public:
         return Dune::IteratorRange<Iter>(fvGeometry.scvfs_.begin(), fvGeometry.scvfs_.end());
     }
 
+    //! The geometry of a sub control volume face of the bound element
+    //! (also available for sub control volume faces that do not store their corners)
+    auto geometry(const SubControlVolumeFace& scvf) const
+    { return Detail::boxScvfGeometry<GeometryHelper>(*element_, scvf); }
+
     //! Get a local finite element basis
     const FeLocalBasis& feLocalBasis() const
     {
@@ -326,14 +373,16 @@ private:
         for (; scvfLocalIdx < numInnerScvf; ++scvfLocalIdx)
         {
             // find the local scv indices this scvf is connected to
-            std::vector<LocalIndexType> localScvIndices({static_cast<LocalIndexType>(refElement.subEntity(scvfLocalIdx, dim-1, 0, dim)),
-                                                         static_cast<LocalIndexType>(refElement.subEntity(scvfLocalIdx, dim-1, 1, dim))});
+            const std::array<LocalIndexType, 2> localScvIndices{{
+                static_cast<LocalIndexType>(refElement.subEntity(scvfLocalIdx, dim-1, 0, dim)),
+                static_cast<LocalIndexType>(refElement.subEntity(scvfLocalIdx, dim-1, 1, dim))
+            }};
 
             scvfs_[scvfLocalIdx] = SubControlVolumeFace(geometryHelper,
                                                         element,
                                                         elementGeometry,
                                                         scvfLocalIdx,
-                                                        std::move(localScvIndices),
+                                                        localScvIndices,
                                                         false);
         }
 
@@ -349,14 +398,14 @@ private:
                 {
                     // find the scv this scvf is connected to
                     const LocalIndexType insideScvIdx = static_cast<LocalIndexType>(refElement.subEntity(intersection.indexInInside(), 1, isScvfLocalIdx, dim));
-                    std::vector<LocalIndexType> localScvIndices = {insideScvIdx, insideScvIdx};
+                    const std::array<LocalIndexType, 2> localScvIndices{{insideScvIdx, insideScvIdx}};
 
                     scvfs_.emplace_back(geometryHelper,
                                         intersection,
                                         isGeometry,
                                         isScvfLocalIdx,
                                         scvfLocalIdx,
-                                        std::move(localScvIndices),
+                                        localScvIndices,
                                         true);
 
                     // increment local counter
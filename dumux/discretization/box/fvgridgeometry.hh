@@ -26,11 +26,13 @@
 #ifndef DUMUX_DISCRETIZATION_BOX_GRID_FVGEOMETRY_HH
 #define DUMUX_DISCRETIZATION_BOX_GRID_FVGEOMETRY_HH
 
+#include <array>
 #include <unordered_map>
 
 #include <dune/localfunctions/lagrange/pqkfactory.hh>
 
 #include <dumux/discretization/method.hh>
+#include <dumux/common/span.hh>
 #include <dumux/common/indextraits.hh>
 #include <dumux/common/defaultmappertraits.hh>
 #include <dumux/discretization/basegridgeometry.hh>
@@ -59,6 +61,20 @@ struct BoxDefaultGridGeometryTraits
     using LocalView = BoxFVElementGeometry<GridGeometry, enableCache>;
 };
 
+/*!
+ * \ingroup BoxDiscretization
+ * \brief Grid geometry traits for the box scheme with compact sub control volume faces
+ *        that do not store their corners (reduces the memory footprint with caching enabled)
+ * \note The scvf geometries are available via BoxFVElementGeometry::geometry(scvf)
+ * \tparam the grid view type
+ */
+template<class GridView, class MapperTraits = DefaultMapperTraits<GridView>>
+struct BoxCompactGridGeometryTraits
+: public BoxDefaultGridGeometryTraits<GridView, MapperTraits>
+{
+    using SubControlVolumeFace = BoxCompactSubControlVolumeFace<GridView>;
+};
+
 /*!
  * \ingroup BoxDiscretization
  * \brief Base class for the finite volume geometry vector for box schemes
@@ -150,15 +166,37 @@ public:
         scvfs_.clear();
 
         auto numElements = this->gridView().size(0);
-        scvs_.resize(numElements);
-        scvfs_.resize(numElements);
-        hasBoundaryScvf_.resize(numElements, false);
+        scvOffsets_.assign(numElements + 1, 0);
+        scvfOffsets_.assign(numElements + 1, 0);
+        hasBoundaryScvf_.assign(numElements, false);
 
         boundaryDofIndices_.assign(numDofs(), false);
 
+        // count the number of scvs and scvfs per element such that all
+        // of them can be stored contiguously in element index order
         numScv_ = 0;
         numScvf_ = 0;
         numBoundaryScvf_ = 0;
+        for (const auto& element : elements(this->gridView()))
+        {
+            const auto eIdx = this->elementMapper().index(element);
+            scvOffsets_[eIdx+1] = element.subEntities(dim);
+            scvfOffsets_[eIdx+1] = element.subEntities(dim-1);
+
+            for (const auto& intersection : intersections(this->gridView(), element))
+                if (intersection.boundary() && !intersection.neighbor())
+                    scvfOffsets_[eIdx+1] += intersection.geometry().corners();
+        }
+
+        for (std::size_t eIdx = 0; eIdx < numElements; ++eIdx)
+        {
+            scvOffsets_[eIdx+1] += scvOffsets_[eIdx];
+            scvfOffsets_[eIdx+1] += scvfOffsets_[eIdx];
+        }
+
+        scvs_.resize(scvOffsets_.back());
+        scvfs_.resize(scvfOffsets_.back());
+
         // Build the SCV and SCV faces
         for (const auto& element : elements(this->gridView()))
         {
@@ -177,31 +215,33 @@ public:
             GeometryHelper geometryHelper(elementGeometry);
 
             // construct the sub control volumes
-            scvs_[eIdx].resize(elementGeometry.corners());
+            auto* elementScvs = scvs_.data() + scvOffsets_[eIdx];
             for (LocalIndexType scvLocalIdx = 0; scvLocalIdx < elementGeometry.corners(); ++scvLocalIdx)
             {
                 const auto dofIdxGlobal = this->vertexMapper().subIndex(element, scvLocalIdx, dim);
 
-                scvs_[eIdx][scvLocalIdx] = SubControlVolume(geometryHelper,
+                elementScvs[scvLocalIdx] = SubControlVolume(geometryHelper,
                                                             scvLocalIdx,
                                                             eIdx,
                                                             dofIdxGlobal);
             }
 
             // construct the sub control volume faces
+            auto* elementScvfs = scvfs_.data() + scvfOffsets_[eIdx];
             LocalIndexType scvfLocalIdx = 0;
-            scvfs_[eIdx].resize(element.subEntities(dim-1));
             for (; scvfLocalIdx < element.subEntities(dim-1); ++scvfLocalIdx)
             {
                 // find the global and local scv indices this scvf is belonging to
-                std::vector<LocalIndexType> localScvIndices({static_cast<LocalIndexType>(refElement.subEntity(scvfLocalIdx, dim-1, 0, dim)),
-                                                             static_cast<LocalIndexType>(refElement.subEntity(scvfLocalIdx, dim-1, 1, dim))});
+                const std::array<LocalIndexType, 2> localScvIndices{{
+                    static_cast<LocalIndexType>(refElement.subEntity(scvfLocalIdx, dim-1, 0, dim)),
+                    static_cast<LocalIndexType>(refElement.subEntity(scvfLocalIdx, dim-1, 1, dim))
+                }};
 
-                scvfs_[eIdx][scvfLocalIdx] = SubControlVolumeFace(geometryHelper,
+                elementScvfs[scvfLocalIdx] = SubControlVolumeFace(geometryHelper,
                                                                   element,
                                                                   elementGeometry,
                                                                   scvfLocalIdx,
-                                                                  std::move(localScvIndices),
+                                                                  localScvIndices,
                                                                   false);
             }
 
@@ -221,15 +261,15 @@ public:
                     {
                         // find the scvs this scvf is belonging to
                         const LocalIndexType insideScvIdx = static_cast<LocalIndexType>(refElement.subEntity(intersection.indexInInside(), 1, isScvfLocalIdx, dim));
-                        std::vector<LocalIndexType> localScvIndices = {insideScvIdx, insideScvIdx};
+                        const std::array<LocalIndexType, 2> localScvIndices{{insideScvIdx, insideScvIdx}};
 
-                        scvfs_[eIdx].emplace_back(geometryHelper,
-                                                  intersection,
-                                                  isGeometry,
-                                                  isScvfLocalIdx,
-                                                  scvfLocalIdx,
-                                                  std::move(localScvIndices),
-                                                  true);
+                        elementScvfs[scvfLocalIdx] = SubControlVolumeFace(geometryHelper,
+                                                                          intersection,
+                                                                          isGeometry,
+                                                                          isScvfLocalIdx,
+                                                                          scvfLocalIdx,
+                                                                          localScvIndices,
+                                                                          true);
 
                         // increment local counter
                         scvfLocalIdx++;
@@ -296,12 +336,12 @@ public:
     { return feCache_; }
 
     //! Get the local scvs for an element
-    const std::vector<SubControlVolume>& scvs(GridIndexType eIdx) const
-    { return scvs_[eIdx]; }
+    Span<const SubControlVolume> scvs(GridIndexType eIdx) const
+    { return { scvs_.data() + scvOffsets_[eIdx], scvs_.data() + scvOffsets_[eIdx+1] }; }
 
     //! Get the local scvfs for an element
-    const std::vector<SubControlVolumeFace>& scvfs(GridIndexType eIdx) const
-    { return scvfs_[eIdx]; }
+    Span<const SubControlVolumeFace> scvfs(GridIndexType eIdx) const
+    { return { scvfs_.data() + scvfOffsets_[eIdx], scvfs_.data() + scvfOffsets_[eIdx+1] }; }
 
     //! If a vertex / d.o.f. is on the boundary
     bool dofOnBoundary(GridIndexType dofIdx) const
@@ -327,8 +367,12 @@ private:
 
     const FeCache feCache_;
 
-    std::vector<std::vector<SubControlVolume>> scvs_;
-    std::vector<std::vector<SubControlVolumeFace>> scvfs_;
+    // the scvs and scvfs of all elements stored contiguously in element index order
+    // the scvs (scvfs) of element eIdx are in the range [offsets_[eIdx], offsets_[eIdx+1])
+    std::vector<SubControlVolume> scvs_;
+    std::vector<SubControlVolumeFace> scvfs_;
+    std::vector<std::size_t> scvOffsets_;
+    std::vector<std::size_t> scvfOffsets_;
     // TODO do we need those?
     std::size_t numScv_;
     std::size_t numScvf_;
@@ -25,6 +25,7 @@
 #define DUMUX_DISCRETIZATION_BOX_GRID_FLUXVARSCACHE_HH
 
 // make the local view function available whenever we use this class
+#include <dumux/parallel/parallel_for.hh>
 #include <dumux/discretization/localview.hh>
 #include <dumux/discretization/box/elementfluxvariablescache.hh>
 
@@ -88,9 +89,12 @@ public:
         if (forceUpdate)
         {
             fluxVarsCache_.resize(gridGeometry.gridView().size(0));
-            for (const auto& element : elements(gridGeometry.gridView()))
+
+            // the elements write to disjoint caches (multithreaded if enabled)
+            gridGeometry.elementMap(); // make sure the element map is built before the threaded loop
+            Dumux::parallelFor(gridGeometry.gridView().size(0), [&](const std::size_t eIdx)
             {
-                auto eIdx = gridGeometry.elementMapper().index(element);
+                const auto element = gridGeometry.element(eIdx);
                 // bind the geometries and volume variables to the element (all the elements in stencil)
                 auto fvGeometry = localView(gridGeometry);
                 fvGeometry.bind(element);
@@ -101,7 +105,7 @@ public:
                 fluxVarsCache_[eIdx].resize(fvGeometry.numScvf());
                 for (auto&& scvf : scvfs(fvGeometry))
                     cache(eIdx, scvf.index()).update(problem(), element, fvGeometry, elemVolVars, scvf);
-            }
+            });
         }
     }
 
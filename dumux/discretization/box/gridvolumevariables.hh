@@ -24,9 +24,12 @@
 #ifndef DUMUX_DISCRETIZATION_BOX_GRID_VOLUMEVARIABLES_HH
 #define DUMUX_DISCRETIZATION_BOX_GRID_VOLUMEVARIABLES_HH
 
+#include <vector>
+#include <algorithm>
 #include <type_traits>
 
 // make the local view function available whenever we use this class
+#include <dumux/parallel/parallel_for.hh>
 #include <dumux/discretization/localview.hh>
 #include <dumux/discretization/box/elementvolumevariables.hh>
 #include <dumux/discretization/box/elementsolution.hh>
@@ -78,10 +81,12 @@ public:
     void update(const GridGeometry& gridGeometry, const SolutionVector& sol)
     {
         volumeVariables_.resize(gridGeometry.gridView().size(0));
-        for (const auto& element : elements(gridGeometry.gridView()))
-        {
-            auto eIdx = gridGeometry.elementMapper().index(element);
 
+        // the elements write to disjoint volume variables (multithreaded if enabled)
+        gridGeometry.elementMap(); // make sure the element map is built before the threaded loop
+        Dumux::parallelFor(gridGeometry.gridView().size(0), [&](const std::size_t eIdx)
+        {
+            const auto element = gridGeometry.element(eIdx);
             auto fvGeometry = localView(gridGeometry);
             fvGeometry.bindElement(element);
 
@@ -92,7 +97,34 @@ public:
             volumeVariables_[eIdx].resize(fvGeometry.numScv());
             for (auto&& scv : scvs(fvGeometry))
                 volumeVariables_[eIdx][scv.indexInElement()].update(elemSol, problem(), element, scv);
-        }
+        });
+    }
+
+    /*!
+     * \brief Update the volume variables of the elements containing one of the given dofs only
+     * \param gridGeometry the grid geometry
+     * \param sol the solution vector
+     * \param dofIsChanged for each dof, whether the volume variables have to be updated
+     * \note The volume variables of all scvs of an element are updated as they may depend on the element solution
+     */
+    template<class GridGeometry, class SolutionVector>
+    void updateChangedDofs(const GridGeometry& gridGeometry, const SolutionVector& sol, const std::vector<bool>& dofIsChanged)
+    {
+        gridGeometry.elementMap(); // make sure the element map is built before the threaded loop
+        Dumux::parallelFor(gridGeometry.gridView().size(0), [&](const std::size_t eIdx)
+        {
+            const auto element = gridGeometry.element(eIdx);
+            auto fvGeometry = localView(gridGeometry);
+            fvGeometry.bindElement(element);
+
+            const auto& scvRange = scvs(fvGeometry);
+            if (std::none_of(scvRange.begin(), scvRange.end(), [&](const auto& scv){ return dofIsChanged[scv.dofIndex()]; }))
+                return;
+
+            const auto elemSol = elementSolution(element, sol, gridGeometry);
+            for (auto&& scv : scvs(fvGeometry))
+                volumeVariables_[eIdx][scv.indexInElement()].update(elemSol, problem(), element, scv);
+        });
     }
 
     template<class SubControlVolume, typename std::enable_if_t<!std::is_integral<SubControlVolume>::value, int> = 0>
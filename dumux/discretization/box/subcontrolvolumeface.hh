@@ -24,6 +24,8 @@
 #ifndef DUMUX_DISCRETIZATION_BOX_SUBCONTROLVOLUMEFACE_HH
 #define DUMUX_DISCRETIZATION_BOX_SUBCONTROLVOLUMEFACE_HH
 
+#include <array>
+#include <cstdint>
 #include <utility>
 
 #include <dune/geometry/type.hh>
@@ -110,19 +112,19 @@ public:
     BoxSubControlVolumeFace() = default;
 
     //! Constructor for inner scvfs
-    template<class GeometryHelper, class Element>
+    template<class GeometryHelper, class Element, class ScvIndices>
     BoxSubControlVolumeFace(const GeometryHelper& geometryHelper,
                             const Element& element,
                             const typename Element::Geometry& elemGeometry,
                             GridIndexType scvfIndex,
-                            std::vector<LocalIndexType>&& scvIndices,
+                            const ScvIndices& scvIndices,
                             bool boundary = false)
     : corners_(geometryHelper.getScvfCorners(scvfIndex)),
       center_(0.0),
       unitOuterNormal_(geometryHelper.normal(corners_, scvIndices)),
       area_(geometryHelper.scvfArea(corners_)),
       scvfIndex_(scvfIndex),
-      scvIndices_(std::move(scvIndices)),
+      scvIndices_{{static_cast<LocalIndexType>(scvIndices[0]), static_cast<LocalIndexType>(scvIndices[1])}},
       boundary_(boundary)
     , boundaryFlag_{}
     {
@@ -132,20 +134,20 @@ public:
     }
 
     //! Constructor for boundary scvfs
-    template<class GeometryHelper, class Intersection>
+    template<class GeometryHelper, class Intersection, class ScvIndices>
     BoxSubControlVolumeFace(const GeometryHelper& geometryHelper,
                             const Intersection& intersection,
                             const typename Intersection::Geometry& isGeometry,
                             LocalIndexType indexInIntersection,
                             GridIndexType scvfIndex,
-                            std::vector<LocalIndexType>&& scvIndices,
+                            const ScvIndices& scvIndices,
                             bool boundary = false)
     : corners_(geometryHelper.getBoundaryScvfCorners(intersection, isGeometry, indexInIntersection)),
       center_(0.0),
       unitOuterNormal_(intersection.centerUnitOuterNormal()),
       area_(geometryHelper.scvfArea(corners_)),
       scvfIndex_(scvfIndex),
-      scvIndices_(std:: move(scvIndices)),
+      scvIndices_{{static_cast<LocalIndexType>(scvIndices[0]), static_cast<LocalIndexType>(scvIndices[1])}},
       boundary_(boundary)
     , boundaryFlag_{intersection}
     {
@@ -233,7 +235,159 @@ private:
     GlobalPosition unitOuterNormal_;
     Scalar area_;
     GridIndexType scvfIndex_;
-    std::vector<LocalIndexType> scvIndices_;
+    std::array<LocalIndexType, 2> scvIndices_;
+    bool boundary_;
+    BoundaryFlag boundaryFlag_;
+};
+
+/*!
+ * \ingroup BoxDiscretization
+ * \brief Memory-efficient sub control volume face for the box method
+ *
+ * In contrast to BoxSubControlVolumeFace, the corners of the face are not stored but
+ * computed on demand from the element geometry, see BoxFVElementGeometry::geometry(scvf).
+ * Instead, the face stores the local facet index and the local vertex index in the facet
+ * (for boundary faces) that are necessary to reconstruct the corners. This reduces the memory
+ * footprint of a cached grid geometry considerably (e.g. for 3D hexahedral grids by more than half).
+ *
+ * \tparam GV the type of the grid view
+ * \tparam T the scvf geometry traits
+ */
+template<class GV,
+         class T = BoxDefaultScvfGeometryTraits<GV> >
+class BoxCompactSubControlVolumeFace
+: public SubControlVolumeFaceBase<BoxCompactSubControlVolumeFace<GV, T>, T>
+{
+    using ThisType = BoxCompactSubControlVolumeFace<GV, T>;
+    using ParentType = SubControlVolumeFaceBase<ThisType, T>;
+    using GridIndexType = typename T::GridIndexType;
+    using LocalIndexType = typename T::LocalIndexType;
+    using Scalar = typename T::Scalar;
+    using BoundaryFlag = typename T::BoundaryFlag;
+
+public:
+    //! export the type used for global coordinates
+    using GlobalPosition = typename T::GlobalPosition;
+    //! state the traits public and thus export all types
+    using Traits = T;
+    //! the type of the face geometry (constructed by the element geometry on demand)
+    using Geometry = typename T::Geometry;
+
+    //! The default constructor
+    BoxCompactSubControlVolumeFace() = default;
+
+    //! Constructor for inner scvfs
+    template<class GeometryHelper, class Element, class ScvIndices>
+    BoxCompactSubControlVolumeFace(const GeometryHelper& geometryHelper,
+                                   const Element& element,
+                                   const typename Element::Geometry& elemGeometry,
+                                   GridIndexType scvfIndex,
+                                   const ScvIndices& scvIndices,
+                                   bool boundary = false)
+    : scvfIndex_(scvfIndex)
+    , scvIndices_{{static_cast<LocalIndexType>(scvIndices[0]), static_cast<LocalIndexType>(scvIndices[1])}}
+    , facetIndex_(0)
+    , indexInFacet_(0)
+    , boundary_(boundary)
+    , boundaryFlag_{}
+    {
+        const auto corners = geometryHelper.getScvfCorners(scvfIndex);
+        unitOuterNormal_ = geometryHelper.normal(corners, scvIndices);
+        area_ = geometryHelper.scvfArea(corners);
+        center_ = computeCenter_(corners);
+    }
+
+    //! Constructor for boundary scvfs
+    template<class GeometryHelper, class Intersection, class ScvIndices>
+    BoxCompactSubControlVolumeFace(const GeometryHelper& geometryHelper,
+                                   const Intersection& intersection,
+                                   const typename Intersection::Geometry& isGeometry,
+                                   LocalIndexType indexInIntersection,
+                                   GridIndexType scvfIndex,
+                                   const ScvIndices& scvIndices,
+                                   bool boundary = false)
+    : unitOuterNormal_(intersection.centerUnitOuterNormal())
+    , scvfIndex_(scvfIndex)
+    , scvIndices_{{static_cast<LocalIndexType>(scvIndices[0]), static_cast<LocalIndexType>(scvIndices[1])}}
+    , facetIndex_(static_cast<std::uint8_t>(intersection.indexInInside()))
+    , indexInFacet_(static_cast<std::uint8_t>(indexInIntersection))
+    , boundary_(boundary)
+    , boundaryFlag_{intersection}
+    {
+        const auto corners = geometryHelper.getBoundaryScvfCorners(intersection, isGeometry, indexInIntersection);
+        area_ = geometryHelper.scvfArea(corners);
+        center_ = computeCenter_(corners);
+    }
+
+    //! The center of the sub control volume face
+    const GlobalPosition& center() const
+    { return center_; }
+
+    //! The integration point for flux evaluations in global coordinates
+    const GlobalPosition& ipGlobal() const
+    { return center_; }
+
+    //! The area of the sub control volume face
+    Scalar area() const
+    { return area_; }
+
+    //! returns true if the sub control volume face is on the boundary
+    bool boundary() const
+    { return boundary_; }
+
+    const GlobalPosition& unitOuterNormal() const
+    { return unitOuterNormal_; }
+
+    //! index of the inside sub control volume
+    LocalIndexType insideScvIdx() const
+    { return scvIndices_[0]; }
+
+    //! Index of the i-th outside sub control volume or boundary scv index.
+    // Results in undefined behaviour if i >= numOutsideScvs()
+    LocalIndexType outsideScvIdx(int i = 0) const
+    {
+        assert(!boundary());
+        return scvIndices_[1];
+    }
+
+    //! The number of scvs on the outside of this face
+    std::size_t numOutsideScvs() const
+    { return static_cast<std::size_t>(!boundary()); }
+
+    //! The local index of this sub control volume face
+    GridIndexType index() const
+    { return scvfIndex_; }
+
+    //! The local index of the element facet a boundary scvf lies on
+    LocalIndexType facetIndex() const
+    { return facetIndex_; }
+
+    //! The local index of the vertex within the element facet a boundary scvf belongs to
+    LocalIndexType indexInFacet() const
+    { return indexInFacet_; }
+
+    //! Return the boundary flag
+    typename BoundaryFlag::value_type boundaryFlag() const
+    { return boundaryFlag_.get(); }
+
+private:
+    template<class CornerStorage>
+    static GlobalPosition computeCenter_(const CornerStorage& corners)
+    {
+        GlobalPosition center(0.0);
+        for (const auto& corner : corners)
+            center += corner;
+        center /= corners.size();
+        return center;
+    }
+
+    GlobalPosition center_;
+    GlobalPosition unitOuterNormal_;
+    Scalar area_;
+    GridIndexType scvfIndex_;
+    std::array<LocalIndexType, 2> scvIndices_;
+    std::uint8_t facetIndex_;
+    std::uint8_t indexInFacet_;
     bool boundary_;
     BoundaryFlag boundaryFlag_;
 };
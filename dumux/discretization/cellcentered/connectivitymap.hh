@@ -34,6 +34,7 @@
 #include <dune/common/reservedvector.hh>
 
 #include <dumux/common/indextraits.hh>
+#include <dumux/common/compressedrowstorage.hh>
 #include <dumux/discretization/fluxstencil.hh>
 
 namespace Dumux {
@@ -66,7 +67,8 @@ class CCSimpleConnectivityMap
         typename FluxStencil::ScvfStencilIForJ additionalScvfs;
     };
 
-    using Map = std::vector<std::vector<DataJ>>;
+    // the data of all elements J for an element I is stored contiguously (compressed row storage)
+    using Map = CompressedRowStorage<DataJ>;
 
 public:
 
@@ -78,7 +80,10 @@ public:
     void update(const GridGeometry& gridGeometry)
     {
         map_.clear();
-        map_.resize(gridGeometry.gridView().size(0));
+
+        // the data of all pairs (I, J), sorted by I after the loop over all elements J
+        std::vector<std::pair<GridIndexType, DataJ>> dataJ;
+        dataJ.reserve(gridGeometry.gridView().size(0)*2*GridView::dimension);
 
         // container to store for each element J the elements I which have J in their flux stencil
         Dune::ReservedVector<std::pair<GridIndexType, DataJ>, maxElemStencilSize> dataJForI;
@@ -123,11 +128,14 @@ public:
             }
 
             for (auto&& pair : dataJForI)
-                map_[pair.first].emplace_back(std::move(pair.second));
+                dataJ.emplace_back(std::move(pair));
         }
+
+        map_.assign(gridGeometry.gridView().size(0), std::move(dataJ));
     }
 
-    const std::vector<DataJ>& operator[] (const GridIndexType globalI) const
+    //! the data of all elements J in whose flux stencil the element I appears
+    typename Map::Row operator[] (const GridIndexType globalI) const
     { return map_[globalI]; }
 
 private:
@@ -28,6 +28,7 @@
 #include <type_traits>
 
 // make the local view function available whenever we use this class
+#include <dumux/parallel/parallel_for.hh>
 #include <dumux/discretization/localview.hh>
 #include <dumux/discretization/cellcentered/elementsolution.hh>
 
@@ -70,8 +71,11 @@ public:
         const auto numScv = gridGeometry.numScv();
         volumeVariables_.resize(numScv);
 
-        for (const auto& element : elements(gridGeometry.gridView()))
+        // the elements write to disjoint volume variables (multithreaded if enabled)
+        gridGeometry.elementMap(); // make sure the element map is built before the threaded loop
+        Dumux::parallelFor(gridGeometry.gridView().size(0), [&](const std::size_t eIdx)
         {
+            const auto element = gridGeometry.element(eIdx);
             auto fvGeometry = localView(gridGeometry);
             fvGeometry.bindElement(element);
 
@@ -80,7 +84,35 @@ public:
                 const auto elemSol = elementSolution(element, sol, gridGeometry);
                 volumeVariables_[scv.dofIndex()].update(elemSol, problem(), element, scv);
             }
-        }
+        });
+    }
+
+    /*!
+     * \brief Update the volume variables of the given dofs only
+     * \param gridGeometry the grid geometry
+     * \param sol the solution vector
+     * \param dofIsChanged for each dof, whether the volume variables have to be updated
+     */
+    template<class GridGeometry, class SolutionVector>
+    void updateChangedDofs(const GridGeometry& gridGeometry, const SolutionVector& sol, const std::vector<bool>& dofIsChanged)
+    {
+        gridGeometry.elementMap(); // make sure the element map is built before the threaded loop
+        Dumux::parallelFor(gridGeometry.gridView().size(0), [&](const std::size_t eIdx)
+        {
+            // the element index coincides with the dof index
+            if (!dofIsChanged[eIdx])
+                return;
+
+            const auto element = gridGeometry.element(eIdx);
+            auto fvGeometry = localView(gridGeometry);
+            fvGeometry.bindElement(element);
+
+            for (auto&& scv : scvs(fvGeometry))
+            {
+                const auto elemSol = elementSolution(element, sol, gridGeometry);
+                volumeVariables_[scv.dofIndex()].update(elemSol, problem(), element, scv);
+            }
+        });
     }
 
     const VolumeVariables& volVars(const std::size_t scvIdx) const
@@ -27,6 +27,8 @@
 // make the local view function available whenever we use this class
 #include <dumux/discretization/localview.hh>
 #include <dumux/discretization/cellcentered/mpfa/elementfluxvariablescache.hh>
+#include <dumux/parallel/coloring.hh>
+#include <dumux/parallel/parallel_for.hh>
 
 namespace Dumux {
 
@@ -149,28 +151,52 @@ public:
 
                 // reserve memory estimate for caches, interaction volumes and corresponding data
                 fluxVarsCache_.resize(gridGeometry.numScvf());
-            }
 
-            // instantiate helper class to fill the caches
-            FluxVariablesCacheFiller filler(problem());
+                // create the interaction volumes (serially), their data is computed below
+                createInteractionVolumes_(gridGeometry);
+                elementColoring_ = computeVertexColoring(gridGeometry);
+                gridGeometry.elementMap(); // make sure the element map is built before the threaded loop
+            }
+            else if (elementColoring_.colors.size() != gridGeometry.gridView().size(0))
+            {
+                elementColoring_ = computeVertexColoring(gridGeometry);
+                gridGeometry.elementMap();
+            }
 
             // set all the caches to "outdated"
             for (auto& cache : fluxVarsCache_)
                 cache.setUpdateStatus(false);
 
-            for (const auto& element : elements(gridGeometry.gridView()))
+            // The interaction volumes are shared by the elements around a vertex. Elements of the same
+            // color share no vertex and thus fill disjoint interaction volumes (multithreaded if enabled).
+            for (const auto& elementSet : elementColoring_.sets)
             {
-                auto fvGeometry = localView(gridGeometry);
-                fvGeometry.bind(element);
-
-                auto elemVolVars = localView(gridVolVars);
-                elemVolVars.bind(element, fvGeometry, sol);
-
-                // Prepare all caches of the scvfs inside the corresponding interaction volume. Skip
-                // those ivs that are touching a boundary, we only store the data on interior ivs here.
-                for (const auto& scvf : scvfs(fvGeometry))
-                    if (!isEmbeddedInBoundaryIV_(scvf, gridGeometry) && !fluxVarsCache_[scvf.index()].isUpdated())
-                        filler.fill(*this, fluxVarsCache_[scvf.index()], ivDataStorage_, element, fvGeometry, elemVolVars, scvf, forceUpdate);
+                Dumux::parallelFor(elementSet.size(), [&](const std::size_t i)
+                {
+                    const auto element = gridGeometry.element(elementSet[i]);
+                    auto fvGeometry = localView(gridGeometry);
+                    fvGeometry.bind(element);
+
+                    auto elemVolVars = localView(gridVolVars);
+                    elemVolVars.bind(element, fvGeometry, sol);
+
+                    // instantiate helper class to fill the caches
+                    FluxVariablesCacheFiller filler(problem());
+
+                    // Prepare all caches of the scvfs inside the corresponding interaction volume. Skip
+                    // those ivs that are touching a boundary, we only store the data on interior ivs here.
+                    for (const auto& scvf : scvfs(fvGeometry))
+                    {
+                        auto& scvfCache = fluxVarsCache_[scvf.index()];
+                        if (isEmbeddedInBoundaryIV_(scvf, gridGeometry) || scvfCache.isUpdated())
+                            continue;
+
+                        if (forceUpdate)
+                            filler.fillCreated(*this, scvfCache, ivDataStorage_, element, fvGeometry, elemVolVars, scvf);
+                        else
+                            filler.fill(*this, scvfCache, ivDataStorage_, element, fvGeometry, elemVolVars, scvf);
+                    }
+                });
             }
         }
     }
@@ -264,6 +290,53 @@ private:
             return gridIvIndexSets.primaryIndexSet(scvf).nodalIndexSet().numBoundaryScvfs() > 0;
     }
 
+    /*!
+     * \brief Create the (unbound) interior interaction volumes and data handles and
+     *        store their indices in the container in the caches of their scvfs.
+     * \note The interaction volumes are bound and their data is computed afterwards in
+     *       FluxVariablesCacheFiller::fillCreated, which can be done concurrently.
+     */
+    template<class GridGeometry>
+    void createInteractionVolumes_(const GridGeometry& gridGeometry)
+    {
+        const auto& gridIvIndexSets = gridGeometry.gridInteractionVolumeIndexSets();
+        const auto assignIndex = [&](const auto& indexSet, std::size_t ivIndexInContainer)
+        {
+            for (const auto scvfIdx : indexSet.gridScvfIndices())
+            {
+                fluxVarsCache_[scvfIdx].setIvIndexInContainer(ivIndexInContainer);
+                fluxVarsCache_[scvfIdx].setUpdateStatus(true);
+            }
+        };
+
+        for (auto& cache : fluxVarsCache_)
+            cache.setUpdateStatus(false);
+
+        auto fvGeometry = localView(gridGeometry);
+        for (const auto& element : elements(gridGeometry.gridView()))
+        {
+            fvGeometry.bindElement(element);
+            for (const auto& scvf : scvfs(fvGeometry))
+            {
+                if (isEmbeddedInBoundaryIV_(scvf, gridGeometry) || fluxVarsCache_[scvf.index()].isUpdated())
+                    continue;
+
+                if (gridGeometry.vertexUsesSecondaryInteractionVolume(scvf.vertexIndex()))
+                {
+                    assignIndex(gridIvIndexSets.secondaryIndexSet(scvf), ivDataStorage_.secondaryInteractionVolumes.size());
+                    ivDataStorage_.secondaryInteractionVolumes.emplace_back();
+                    ivDataStorage_.secondaryDataHandles.emplace_back();
+                }
+                else
+                {
+                    assignIndex(gridIvIndexSets.primaryIndexSet(scvf), ivDataStorage_.primaryInteractionVolumes.size());
+                    ivDataStorage_.primaryInteractionVolumes.emplace_back();
+                    ivDataStorage_.primaryDataHandles.emplace_back();
+                }
+            }
+        }
+    }
+
     //! clear all containers
     void clear_()
     {
@@ -283,6 +356,9 @@ private:
                                                        SecondaryInteractionVolume,
                                                        SecondaryIvDataHandle>;
     IVDataStorage ivDataStorage_;
+
+    // partition of the elements for the (multithreaded) update of the interaction volumes
+    ElementColoring elementColoring_;
 };
 
 /*!
@@ -30,6 +30,8 @@
 #include <algorithm>
 #include <array>
 #include <vector>
+#include <utility>
+#include <type_traits>
 
 #include <dune/common/exceptions.hh>
 #include <dumux/common/indextraits.hh>
@@ -62,6 +64,7 @@ class CCTpfaFVElementGeometry<GG, true>
     using ThisType = CCTpfaFVElementGeometry<GG, true>;
     using GridView = typename GG::GridView;
     using GridIndexType = typename IndexTraits<GridView>::GridIndex;
+    using ScvfIndexContainer = std::decay_t<decltype(std::declval<const GG&>().scvfIndicesOfScv(GridIndexType{}))>;
 
 public:
     //! export type of the element
@@ -121,14 +124,13 @@ public:
     //! This is a free function found by means of ADL
     //! To iterate over all sub control volume faces of this FVElementGeometry use
     //! for (auto&& scvf : scvfs(fvGeometry))
-    friend inline Dune::IteratorRange< ScvfIterator<SubControlVolumeFace, std::vector<GridIndexType>, ThisType> >
+    friend inline Dune::IteratorRange< ScvfIterator<SubControlVolumeFace, ScvfIndexContainer, ThisType> >
     scvfs(const CCTpfaFVElementGeometry& fvGeometry)
     {
-        const auto& g = fvGeometry.gridGeometry();
-        const auto scvIdx = fvGeometry.scvIndices_[0];
-        using ScvfIterator = Dumux::ScvfIterator<SubControlVolumeFace, std::vector<GridIndexType>, ThisType>;
-        return Dune::IteratorRange<ScvfIterator>(ScvfIterator(g.scvfIndicesOfScv(scvIdx).begin(), fvGeometry),
-                                                 ScvfIterator(g.scvfIndicesOfScv(scvIdx).end(), fvGeometry));
+        const auto& scvfIndices = fvGeometry.gridGeometry().scvfIndicesOfScv(fvGeometry.scvIndices_[0]);
+        using ScvfIterator = Dumux::ScvfIterator<SubControlVolumeFace, ScvfIndexContainer, ThisType>;
+        return Dune::IteratorRange<ScvfIterator>(ScvfIterator(scvfIndices.begin(), fvGeometry),
+                                                 ScvfIterator(scvfIndices.end(), fvGeometry));
     }
 
     //! number of sub control volumes in this fv element geometry
@@ -27,8 +27,13 @@
 #define DUMUX_DISCRETIZATION_CCTPFA_FV_GRID_GEOMETRY_HH
 
 #include <algorithm>
+#include <utility>
+#include <vector>
+
+#include <dune/common/reservedvector.hh>
 
 #include <dumux/common/indextraits.hh>
+#include <dumux/common/compressedrowstorage.hh>
 #include <dumux/common/defaultmappertraits.hh>
 
 #include <dumux/discretization/method.hh>
@@ -176,8 +181,11 @@ public:
         // reserve memory
         scvs_.resize(numScvs);
         scvfs_.reserve(numScvf);
-        scvfIndicesOfScv_.resize(numScvs);
-        hasBoundaryScvf_.resize(numScvs, false);
+        hasBoundaryScvf_.assign(numScvs, false);
+
+        // the scvf indices of all elements as (element index, scvf index) pairs
+        std::vector<std::pair<GridIndexType, GridIndexType>> scvfIndicesOfScv;
+        scvfIndicesOfScv.reserve(numScvf);
 
         // Build the scvs and scv faces
         GridIndexType scvfIdx = 0;
@@ -188,8 +196,7 @@ public:
             scvs_[eIdx] = SubControlVolume(element.geometry(), eIdx);
 
             // the element-wise index sets for finite volume geometry
-            std::vector<GridIndexType> scvfsIndexSet;
-            scvfsIndexSet.reserve(element.subEntities(1));
+            const auto addScvfIndex = [&](GridIndexType idx){ scvfIndicesOfScv.emplace_back(eIdx, idx); };
 
             // for network grids there might be multiple intersection with the same geometryInInside
             // we indentify those by the indexInInside for now (assumes conforming grids at branching facets)
@@ -229,7 +236,7 @@ public:
                                             scvfIdx,
                                             ScvfGridIndexStorage({eIdx, nIdx}),
                                             false);
-                        scvfsIndexSet.push_back(scvfIdx++);
+                        addScvfIndex(scvfIdx++);
                     }
                     // this is for network grids
                     // (will be optimized away of dim == dimWorld)
@@ -246,7 +253,7 @@ public:
                                                 scvfIdx,
                                                 outsideIndices[indexInInside],
                                                 false);
-                            scvfsIndexSet.push_back(scvfIdx++);
+                            addScvfIndex(scvfIdx++);
                             outsideIndices[indexInInside].clear();
                         }
                     }
@@ -259,30 +266,34 @@ public:
                                         scvfIdx,
                                         ScvfGridIndexStorage({eIdx, static_cast<GridIndexType>(this->gridView().size(0) + numBoundaryScvf_++)}),
                                         true);
-                    scvfsIndexSet.push_back(scvfIdx++);
+                    addScvfIndex(scvfIdx++);
 
                     hasBoundaryScvf_[eIdx] = true;
                 }
             }
-
-            // Save the scvf indices belonging to this scv to build up fv element geometries fast
-            scvfIndicesOfScv_[eIdx] = scvfsIndexSet;
         }
 
+        // Save the scvf indices belonging to each scv to build up fv element geometries fast
+        scvfIndicesOfScv_.assign(numScvs, std::move(scvfIndicesOfScv));
+
         // Make the flip index set for network, surface, and periodic grids
+        // (the scvfs are stored in the order of their indices)
         if (dim < dimWorld || this->isPeriodic())
         {
-            flipScvfIndices_.resize(scvfs_.size());
+            flipScvfIndices_.reserve(scvfs_.size(), scvfs_.size());
+            Dune::ReservedVector<GridIndexType, Traits::maxNumScvfNeighbors> flipIndices;
             for (auto&& scvf : scvfs_)
             {
-                if (scvf.boundary())
-                    continue;
-
-                flipScvfIndices_[scvf.index()].resize(scvf.numOutsideScvs());
-                const auto insideScvIdx = scvf.insideScvIdx();
-                // check which outside scvf has the insideScvIdx index in its outsideScvIndices
-                for (unsigned int i = 0; i < scvf.numOutsideScvs(); ++i)
-                    flipScvfIndices_[scvf.index()][i] = findFlippedScvfIndex_(insideScvIdx, scvf.outsideScvIdx(i));
+                flipIndices.clear();
+                if (!scvf.boundary())
+                {
+                    const auto insideScvIdx = scvf.insideScvIdx();
+                    // check which outside scvf has the insideScvIdx index in its outsideScvIndices
+                    for (unsigned int i = 0; i < scvf.numOutsideScvs(); ++i)
+                        flipIndices.push_back(findFlippedScvfIndex_(insideScvIdx, scvf.outsideScvIdx(i)));
+                }
+
+                flipScvfIndices_.push_back(flipIndices);
             }
         }
 
@@ -310,7 +321,7 @@ public:
     }
 
     //! Get the sub control volume face indices of an scv by global index
-    const std::vector<GridIndexType>& scvfIndicesOfScv(GridIndexType scvIdx) const
+    Span<const GridIndexType> scvfIndicesOfScv(GridIndexType scvIdx) const
     {
         return scvfIndicesOfScv_[scvIdx];
     }
@@ -348,12 +359,12 @@ private:
     //! containers storing the global data
     std::vector<SubControlVolume> scvs_;
     std::vector<SubControlVolumeFace> scvfs_;
-    std::vector<std::vector<GridIndexType>> scvfIndicesOfScv_;
+    CompressedRowStorage<GridIndexType> scvfIndicesOfScv_;
     std::size_t numBoundaryScvf_;
     std::vector<bool> hasBoundaryScvf_;
 
     //! needed for embedded surface and network grids (dim < dimWorld)
-    std::vector<std::vector<GridIndexType>> flipScvfIndices_;
+    CompressedRowStorage<GridIndexType> flipScvfIndices_;
 };
 
 /*!
@@ -453,8 +464,12 @@ public:
         numScvs_ = numDofs();
         numScvf_ = 0;
         numBoundaryScvf_ = 0;
-        scvfIndicesOfScv_.resize(numScvs_);
-        neighborVolVarIndices_.resize(numScvs_);
+
+        // the index sets of all elements as (element index, value) pairs
+        std::vector<std::pair<GridIndexType, GridIndexType>> scvfIndicesOfScv;
+        std::vector<std::pair<GridIndexType, NeighborVolVarIndices>> neighborVolVarIndices;
+        scvfIndicesOfScv.reserve(numScvs_*(2*dim));
+        neighborVolVarIndices.reserve(numScvs_*(2*dim));
 
         // Build the SCV and SCV face
         for (const auto& element : elements(this->gridView()))
@@ -463,10 +478,11 @@ public:
 
             // the element-wise index sets for finite volume geometry
             auto numLocalFaces = element.subEntities(1);
-            std::vector<GridIndexType> scvfsIndexSet;
-            std::vector<NeighborVolVarIndices> neighborVolVarIndexSet;
-            scvfsIndexSet.reserve(numLocalFaces);
-            neighborVolVarIndexSet.reserve(numLocalFaces);
+            const auto addScvf = [&](NeighborVolVarIndices&& nIndices)
+            {
+                scvfIndicesOfScv.emplace_back(eIdx, numScvf_++);
+                neighborVolVarIndices.emplace_back(eIdx, std::move(nIndices));
+            };
 
             // for network grids there might be multiple intersection with the same geometryInInside
             // we indentify those by the indexInInside for now (assumes conforming grids at branching facets)
@@ -495,9 +511,8 @@ public:
 
                     if (dim == dimWorld)
                     {
-                        scvfsIndexSet.push_back(numScvf_++);
                         const auto nIdx = this->elementMapper().index(intersection.outside());
-                        neighborVolVarIndexSet.emplace_back(NeighborVolVarIndices({nIdx}));
+                        addScvf(NeighborVolVarIndices({nIdx}));
                     }
                     // this is for network grids
                     // (will be optimized away of dim == dimWorld)
@@ -509,34 +524,31 @@ public:
                             continue;
                         else
                         {
-                            scvfsIndexSet.push_back(numScvf_++);
-                            neighborVolVarIndexSet.emplace_back(std::move(outsideIndices[indexInInside]));
+                            addScvf(std::move(outsideIndices[indexInInside]));
                             outsideIndices[indexInInside].clear();
                         }
                     }
                 }
                 // boundary sub control volume faces
                 else if (intersection.boundary())
-                {
-                    scvfsIndexSet.push_back(numScvf_++);
-                    neighborVolVarIndexSet.emplace_back(NeighborVolVarIndices({static_cast<GridIndexType>(numScvs_ + numBoundaryScvf_++)}));
-                }
+                    addScvf(NeighborVolVarIndices({static_cast<GridIndexType>(numScvs_ + numBoundaryScvf_++)}));
             }
-
-            // store the sets of indices in the data container
-            scvfIndicesOfScv_[eIdx] = scvfsIndexSet;
-            neighborVolVarIndices_[eIdx] = neighborVolVarIndexSet;
         }
 
+        // store the sets of indices in the data containers
+        scvfIndicesOfScv_.assign(numScvs_, std::move(scvfIndicesOfScv));
+        neighborVolVarIndices_.assign(numScvs_, std::move(neighborVolVarIndices));
+
         // build the connectivity map for an effecient assembly
         connectivityMap_.update(*this);
     }
 
-    const std::vector<GridIndexType>& scvfIndicesOfScv(GridIndexType scvIdx) const
+    //! Get the sub control volume face indices of an scv by global index
+    Span<const GridIndexType> scvfIndicesOfScv(GridIndexType scvIdx) const
     { return scvfIndicesOfScv_[scvIdx]; }
 
     //! Return the neighbor volVar indices for all scvfs in the scv with index scvIdx
-    const std::vector<NeighborVolVarIndices>& neighborVolVarIndices(GridIndexType scvIdx) const
+    Span<const NeighborVolVarIndices> neighborVolVarIndices(GridIndexType scvIdx) const
     { return neighborVolVarIndices_[scvIdx]; }
 
     /*!
@@ -557,8 +569,8 @@ private:
     ConnectivityMap connectivityMap_;
 
     //! vectors that store the global data
-    std::vector<std::vector<GridIndexType>> scvfIndicesOfScv_;
-    std::vector<std::vector<NeighborVolVarIndices>> neighborVolVarIndices_;
+    CompressedRowStorage<GridIndexType> scvfIndicesOfScv_;
+    CompressedRowStorage<NeighborVolVarIndices> neighborVolVarIndices_;
 };
 
 } // end namespace Dumux
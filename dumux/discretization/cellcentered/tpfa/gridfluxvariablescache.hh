@@ -24,7 +24,11 @@
 #ifndef DUMUX_DISCRETIZATION_CCTPFA_GRID_FLUXVARSCACHE_HH
 #define DUMUX_DISCRETIZATION_CCTPFA_GRID_FLUXVARSCACHE_HH
 
+#include <vector>
+#include <algorithm>
+
 // make the local view function available whenever we use this class
+#include <dumux/parallel/parallel_for.hh>
 #include <dumux/discretization/localview.hh>
 #include <dumux/discretization/cellcentered/tpfa/elementfluxvariablescache.hh>
 
@@ -96,12 +100,14 @@ public:
         // only do the update if fluxes are solution dependent or if update is forced
         if (FluxVariablesCacheFiller::isSolDependent || forceUpdate)
         {
-            // instantiate helper class to fill the caches
-            FluxVariablesCacheFiller filler(problem());
-
             fluxVarsCache_.resize(gridGeometry.numScvf());
-            for (const auto& element : elements(gridGeometry.gridView()))
+
+            // the elements write to the disjoint caches of their scvfs (multithreaded if enabled)
+            gridGeometry.elementMap(); // make sure the element map is built before the threaded loop
+            Dumux::parallelFor(gridGeometry.gridView().size(0), [&](const std::size_t eIdx)
             {
+                const auto element = gridGeometry.element(eIdx);
+
                 // Prepare the geometries within the elements of the stencil
                 auto fvGeometry = localView(gridGeometry);
                 fvGeometry.bind(element);
@@ -109,11 +115,63 @@ public:
                 auto elemVolVars = localView(gridVolVars);
                 elemVolVars.bind(element, fvGeometry, sol);
 
+                // instantiate helper class to fill the caches
+                FluxVariablesCacheFiller filler(problem());
                 for (auto&& scvf : scvfs(fvGeometry))
                 {
                     filler.fill(*this, fluxVarsCache_[scvf.index()], element, fvGeometry, elemVolVars, scvf, forceUpdate);
                 }
-            }
+            });
+        }
+    }
+
+    /*!
+     * \brief Update the caches of the scvfs connected to one of the given dofs only
+     * \param gridGeometry the grid geometry
+     * \param gridVolVars the (updated) grid volume variables
+     * \param sol the solution vector
+     * \param dofIsChanged for each dof, whether its volume variables changed
+     */
+    template<class GridGeometry, class GridVolumeVariables, class SolutionVector>
+    void updateChangedDofs(const GridGeometry& gridGeometry,
+                           const GridVolumeVariables& gridVolVars,
+                           const SolutionVector& sol,
+                           const std::vector<bool>& dofIsChanged)
+    {
+        if (FluxVariablesCacheFiller::isSolDependent)
+        {
+            // the cache of an scvf depends on the volume variables of the inside and outside scvs
+            // (the outside index of boundary scvfs does not correspond to a dof)
+            const auto isChanged = [&](const auto& scvf)
+            {
+                if (dofIsChanged[scvf.insideScvIdx()])
+                    return true;
+                for (std::size_t i = 0; i < scvf.numOutsideScvs(); ++i)
+                    if (scvf.outsideScvIdx(i) < dofIsChanged.size() && dofIsChanged[scvf.outsideScvIdx(i)])
+                        return true;
+                return false;
+            };
+
+            gridGeometry.elementMap(); // make sure the element map is built before the threaded loop
+            Dumux::parallelFor(gridGeometry.gridView().size(0), [&](const std::size_t eIdx)
+            {
+                const auto element = gridGeometry.element(eIdx);
+                auto fvGeometry = localView(gridGeometry);
+                fvGeometry.bindElement(element);
+
+                const auto& scvfRange = scvfs(fvGeometry);
+                if (std::none_of(scvfRange.begin(), scvfRange.end(), isChanged))
+                    return;
+
+                fvGeometry.bind(element);
+                auto elemVolVars = localView(gridVolVars);
+                elemVolVars.bind(element, fvGeometry, sol);
+
+                FluxVariablesCacheFiller filler(problem());
+                for (auto&& scvf : scvfs(fvGeometry))
+                    if (isChanged(scvf))
+                        filler.fill(*this, fluxVarsCache_[scvf.index()], element, fvGeometry, elemVolVars, scvf);
+            });
         }
     }
 
@@ -0,0 +1,416 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*****************************************************************************
+ *   See the file COPYING for full copying permissions.                      *
+ *                                                                           *
+ *   This program is free software: you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by    *
+ *   the Free Software Foundation, either version 3 of the License, or       *
+ *   (at your option) any later version.                                     *
+ *                                                                           *
+ *   This program is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the            *
+ *   GNU General Public License for more details.                            *
+ *                                                                           *
+ *   You should have received a copy of the GNU General Public License       *
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.   *
+ *****************************************************************************/
+/*!
+ * \file
+ * \ingroup CCTpfaDiscretization
+ * \brief The finite volume geometry for cell-centered TPFA models on structured
+ *        (Cartesian, e.g. Dune::YaspGrid) grids computing all index information arithmetically
+ */
+#ifndef DUMUX_DISCRETIZATION_CCTPFA_STRUCTURED_FV_GRID_GEOMETRY_HH
+#define DUMUX_DISCRETIZATION_CCTPFA_STRUCTURED_FV_GRID_GEOMETRY_HH
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <utility>
+
+#include <dune/common/exceptions.hh>
+#include <dune/common/reservedvector.hh>
+
+#include <dumux/common/indextraits.hh>
+
+#include <dumux/discretization/method.hh>
+#include <dumux/discretization/basegridgeometry.hh>
+#include <dumux/discretization/checkoverlapsize.hh>
+#include <dumux/discretization/cellcentered/tpfa/fvgridgeometry.hh>
+#include <dumux/discretization/extrusion.hh>
+
+namespace Dumux {
+
+/*!
+ * \ingroup CCTpfaDiscretization
+ * \brief The finite volume geometry (scvs and scvfs) for cell-centered TPFA models on structured grids
+ *
+ * On a structured grid with lexicographic element numbering (the x-index running fastest, as for Dune::YaspGrid),
+ * all connectivity information follows from the element multi-index (i,j,k) and the number of elements per direction.
+ * In contrast to CCTpfaFVGridGeometry, this grid geometry does not store any per-element data: the scvf indices,
+ * the neighbor indices and the connectivity map (the elements J in whose flux stencil an element I appears,
+ * and the scvfs of J facing I) are computed from the element index and the strides, the scvs and scvfs are
+ * constructed on demand by the local view (like CCTpfaFVGridGeometry without caching). The memory footprint
+ * is thus independent of the grid size.
+ *
+ * The scvf with local (facet) index f of the element with index eIdx has the index 2*dim*eIdx + f.
+ * The structure of the grid is determined and verified in update(), an exception is thrown
+ * if the grid view is not structured or not numbered lexicographically.
+ *
+ * \note Periodic boundaries and overlapping (parallel) grids are supported.
+ *       Surface and network grids (dim < dimWorld) are not supported.
+ * \tparam GV the grid view type
+ * \tparam Traits the grid geometry traits (scv, scvf, and local view types)
+ */
+template<class GV, class Traits = CCTpfaDefaultGridGeometryTraits<GV>>
+class CCTpfaStructuredFVGridGeometry
+: public BaseGridGeometry<GV, Traits>
+{
+    using ThisType = CCTpfaStructuredFVGridGeometry<GV, Traits>;
+    using ParentType = BaseGridGeometry<GV, Traits>;
+
+    using GridIndexType = typename IndexTraits<GV>::GridIndex;
+    using Element = typename GV::template Codim<0>::Entity;
+
+    static constexpr int dim = GV::dimension;
+    static constexpr int dimWorld = GV::dimensionworld;
+    static constexpr int numFacets = 2*dim;
+
+    static_assert(dim == dimWorld, "Structured grid geometry is only implemented for dim == dimWorld");
+
+    using NeighborVolVarIndices = Dune::ReservedVector<GridIndexType, 1>;
+
+    //! the type of the element sides of the (process-local) structured grid
+    enum class SideType : std::uint8_t { undetermined, boundary, periodic, processorBoundary };
+
+    //! The data of an element J in whose flux stencil the element I appears (see CCSimpleConnectivityMap)
+    struct DataJ
+    {
+        GridIndexType globalJ;
+        //! the scvfs of J facing I (two if J is the neighbor on both sides in a periodic direction with two elements)
+        Dune::ReservedVector<GridIndexType, 2> scvfsJ;
+        //! compatibility with more complex connectivity maps (see mpfa), always empty
+        Dune::ReservedVector<GridIndexType, 2> additionalScvfs;
+    };
+
+    /*!
+     * \brief The data of all elements J in whose flux stencil the element I appears
+     * \note Computed on construction, the entries are returned by value such that
+     *       expressions like connectivityMap[globalI][k].scvfsJ are safe on temporaries
+     */
+    class ConnectivityMapRow
+    {
+        using Storage = Dune::ReservedVector<DataJ, numFacets>;
+    public:
+        using const_iterator = typename Storage::const_iterator;
+
+        ConnectivityMapRow(Storage&& data) : data_(std::move(data)) {}
+
+        std::size_t size() const { return data_.size(); }
+        DataJ operator[] (std::size_t k) const { return data_[k]; }
+        const_iterator begin() const { return data_.begin(); }
+        const_iterator end() const { return data_.end(); }
+
+    private:
+        Storage data_;
+    };
+
+    /*!
+     * \brief The connectivity map of the structured grid computed from the element multi-index and the strides
+     * \note A light-weight view on the grid geometry (nothing is stored)
+     */
+    class ConnectivityMap
+    {
+    public:
+        ConnectivityMap(const ThisType& gridGeometry) : gridGeometry_(&gridGeometry) {}
+
+        //! the data of all elements J in whose flux stencil the element I appears
+        ConnectivityMapRow operator[] (const GridIndexType globalI) const
+        { return gridGeometry_->connectivityMapRow_(globalI); }
+
+    private:
+        const ThisType* gridGeometry_;
+    };
+
+public:
+    //! export the type of the fv element geometry (the local view type)
+    using LocalView = typename Traits::template LocalView<ThisType, false>;
+    //! export the type of sub control volume
+    using SubControlVolume = typename Traits::SubControlVolume;
+    //! export the type of sub control volume
+    using SubControlVolumeFace = typename Traits::SubControlVolumeFace;
+    //! export the type of extrusion
+    using Extrusion = Extrusion_t<Traits>;
+    //! export dof mapper type
+    using DofMapper = typename Traits::ElementMapper;
+
+    //! Export the discretization method this geometry belongs to
+    static constexpr DiscretizationMethod discMethod = DiscretizationMethod::cctpfa;
+
+    //! The maximum admissible stencil size (used for static memory allocation during assembly)
+    static constexpr int maxElementStencilSize = numFacets + 1;
+
+    //! Export the type of the grid view
+    using GridView = GV;
+
+    //! Constructor
+    CCTpfaStructuredFVGridGeometry(const GridView& gridView)
+    : ParentType(gridView)
+    {
+        // Check if the overlap size is what we expect
+        if (!CheckOverlapSize<DiscretizationMethod::cctpfa>::isValid(gridView))
+            DUNE_THROW(Dune::InvalidStateException, "The cctpfa discretization method needs at least an overlap of 1 for parallel computations. "
+                                                     << " Set the parameter \"Grid.Overlap\" in the input file.");
+    }
+
+    //! the element mapper is the dofMapper
+    //! this is convenience to have better chance to have the same main files for box/tpfa/mpfa...
+    const DofMapper& dofMapper() const
+    { return this->elementMapper(); }
+
+    //! The total number of sub control volumes
+    std::size_t numScv() const
+    { return numScvs_; }
+
+    //! The total number of sub control volume faces
+    //! \note This is the size of the scvf index space (including faces on processor boundaries)
+    std::size_t numScvf() const
+    { return numFacets*numScvs_; }
+
+    //! The total number of boundary sub control volume faces
+    std::size_t numBoundaryScvf() const
+    { return numBoundaryScvf_; }
+
+    //! The total number of degrees of freedom
+    std::size_t numDofs() const
+    { return numScvs_; }
+
+    //! update all fvElementGeometries (do this again after grid adaption)
+    void update()
+    {
+        ParentType::update();
+
+        numScvs_ = this->gridView().size(0);
+        determineStructure_();
+        verifyStructure_();
+    }
+
+    //! The number of elements of the (process-local) grid in direction dir
+    std::size_t numElements(int dir) const
+    { return numElements_[dir]; }
+
+    //! The multi-index (i,j,k) of the element with index eIdx
+    std::array<GridIndexType, dim> multiIndex(GridIndexType eIdx) const
+    {
+        std::array<GridIndexType, dim> idx;
+        for (int dir = dim-1; dir >= 0; --dir)
+        {
+            idx[dir] = eIdx/strides_[dir];
+            eIdx -= idx[dir]*strides_[dir];
+        }
+        return idx;
+    }
+
+    //! The index of the scvf on the element facet with local index localFacetIdx
+    GridIndexType scvfIndex(GridIndexType eIdx, int localFacetIdx) const
+    { return numFacets*eIdx + localFacetIdx; }
+
+    //! The sub control volume face indices of the scv with index scvIdx (in the order of the intersections)
+    Dune::ReservedVector<GridIndexType, numFacets> scvfIndicesOfScv(GridIndexType scvIdx) const
+    {
+        Dune::ReservedVector<GridIndexType, numFacets> scvfIndices;
+        const auto idx = multiIndex(scvIdx);
+        for (int facetIdx = 0; facetIdx < numFacets; ++facetIdx)
+            if (hasScvf_(idx, facetIdx))
+                scvfIndices.push_back(scvfIndex(scvIdx, facetIdx));
+        return scvfIndices;
+    }
+
+    //! Return the neighbor volVar indices for all scvfs in the scv with index scvIdx
+    //! \note For boundary scvfs, the index is numDofs() + scvfIdx
+    Dune::ReservedVector<NeighborVolVarIndices, numFacets> neighborVolVarIndices(GridIndexType scvIdx) const
+    {
+        Dune::ReservedVector<NeighborVolVarIndices, numFacets> neighborIndices;
+        const auto idx = multiIndex(scvIdx);
+        for (int facetIdx = 0; facetIdx < numFacets; ++facetIdx)
+        {
+            if (!hasScvf_(idx, facetIdx))
+                continue;
+
+            NeighborVolVarIndices nIndices;
+            if (isOnSide_(idx, facetIdx) && sideType_[facetIdx] == SideType::boundary)
+                nIndices.push_back(static_cast<GridIndexType>(numScvs_ + scvfIndex(scvIdx, facetIdx)));
+            else
+                nIndices.push_back(neighborIndex_(scvIdx, idx, facetIdx));
+            neighborIndices.push_back(nIndices);
+        }
+        return neighborIndices;
+    }
+
+    /*!
+     * \brief Returns the connectivity map of which dofs have derivatives with respect
+     *        to a given dof.
+     * \note The map is a light-weight view computing the connectivity on demand
+     */
+    ConnectivityMap connectivityMap() const
+    { return ConnectivityMap(*this); }
+
+private:
+    //! the elements J in whose flux stencil the element I appears and the scvfs of J facing I
+    ConnectivityMapRow connectivityMapRow_(GridIndexType globalI) const
+    {
+        Dune::ReservedVector<DataJ, numFacets> data;
+        const auto idx = multiIndex(globalI);
+        for (int facetIdx = 0; facetIdx < numFacets; ++facetIdx)
+        {
+            if (!hasScvf_(idx, facetIdx) || (isOnSide_(idx, facetIdx) && sideType_[facetIdx] == SideType::boundary))
+                continue;
+
+            // a single element in a periodic direction is its own neighbor
+            const auto globalJ = neighborIndex_(globalI, idx, facetIdx);
+            if (globalJ == globalI)
+                continue;
+
+            // the scvf of J facing I lies on the opposite facet of J
+            const auto scvfIdxJ = scvfIndex(globalJ, facetIdx^1);
+            auto it = std::find_if(data.begin(), data.end(), [&](const auto& d){ return d.globalJ == globalJ; });
+            if (it != data.end())
+                it->scvfsJ.push_back(scvfIdxJ);
+            else
+                data.push_back(DataJ{globalJ, {scvfIdxJ}, {}});
+        }
+
+        return ConnectivityMapRow(std::move(data));
+    }
+
+    //! determine the number of elements per direction by walking from the first element along the axes
+    void determineStructure_()
+    {
+        numElements_.fill(1);
+        sideType_.fill(SideType::undetermined);
+
+        if (numScvs_ == 0)
+        {
+            computeStrides_();
+            return;
+        }
+
+        const auto& firstElement = *elements(this->gridView()).begin();
+        if (this->elementMapper().index(firstElement) != 0)
+            DUNE_THROW(Dune::InvalidStateException, "Structured grid geometry requires lexicographic element numbering");
+
+        for (int dir = 0; dir < dim; ++dir)
+        {
+            auto element = firstElement;
+            bool hasNext = true;
+            while (hasNext)
+            {
+                hasNext = false;
+                for (const auto& intersection : intersections(this->gridView(), element))
+                {
+                    if (intersection.indexInInside() == 2*dir+1 && intersection.neighbor() && !intersection.boundary())
+                    {
+                        element = intersection.outside();
+                        ++numElements_[dir];
+                        hasNext = true;
+                        break;
+                    }
+                }
+            }
+        }
+
+        computeStrides_();
+        if (strides_[dim-1]*numElements_[dim-1] != numScvs_)
+            DUNE_THROW(Dune::InvalidStateException, "Structured grid geometry requires a structured grid (grid view size doesn't match)");
+    }
+
+    void computeStrides_()
+    {
+        strides_[0] = 1;
+        for (int dir = 1; dir < dim; ++dir)
+            strides_[dir] = strides_[dir-1]*numElements_[dir-1];
+    }
+
+    //! check the assumed connectivity and determine the type of the sides of the grid
+    void verifyStructure_()
+    {
+        numBoundaryScvf_ = 0;
+        for (const auto& element : elements(this->gridView()))
+        {
+            const auto eIdx = this->elementMapper().index(element);
+            const auto idx = multiIndex(eIdx);
+
+            int facetIdx = 0;
+            for (const auto& intersection : intersections(this->gridView(), element))
+            {
+                if (intersection.indexInInside() != facetIdx)
+                    DUNE_THROW(Dune::InvalidStateException, "Structured grid geometry requires one intersection per element facet, in facet order");
+
+                if (isOnSide_(idx, facetIdx))
+                {
+                    const auto sideType = intersection.neighbor() ? SideType::periodic
+                                          : intersection.boundary() ? SideType::boundary
+                                          : SideType::processorBoundary;
+
+                    if (sideType_[facetIdx] == SideType::undetermined)
+                        sideType_[facetIdx] = sideType;
+                    else if (sideType_[facetIdx] != sideType)
+                        DUNE_THROW(Dune::InvalidStateException, "Structured grid geometry requires the same boundary type on the entire grid side " << facetIdx);
+
+                    if (sideType == SideType::boundary)
+                        ++numBoundaryScvf_;
+                    else if (sideType == SideType::periodic)
+                        this->setPeriodic();
+                }
+                else if (!intersection.neighbor())
+                    DUNE_THROW(Dune::InvalidStateException, "Structured grid geometry: unexpected boundary in the grid interior");
+
+                if (intersection.neighbor() && this->elementMapper().index(intersection.outside()) != neighborIndex_(eIdx, idx, facetIdx))
+                    DUNE_THROW(Dune::InvalidStateException, "Structured grid geometry requires lexicographic element numbering");
+
+                ++facetIdx;
+            }
+
+            if (facetIdx != numFacets)
+                DUNE_THROW(Dune::InvalidStateException, "Structured grid geometry requires one intersection per element facet");
+        }
+    }
+
+    //! if the element facet lies on the side of the (process-local) grid
+    bool isOnSide_(const std::array<GridIndexType, dim>& idx, int facetIdx) const
+    {
+        const int dir = facetIdx/2;
+        return (facetIdx % 2) ? idx[dir] + 1 == numElements_[dir] : idx[dir] == 0;
+    }
+
+    //! if there is an scvf on the element facet (there is none on processor boundaries)
+    bool hasScvf_(const std::array<GridIndexType, dim>& idx, int facetIdx) const
+    { return !isOnSide_(idx, facetIdx) || sideType_[facetIdx] != SideType::processorBoundary; }
+
+    //! the index of the neighbor element across the facet (with wrap-around for periodic sides)
+    GridIndexType neighborIndex_(GridIndexType eIdx, const std::array<GridIndexType, dim>& idx, int facetIdx) const
+    {
+        const int dir = facetIdx/2;
+        const GridIndexType stride = strides_[dir];
+        const GridIndexType wrap = (numElements_[dir]-1)*stride;
+        if (facetIdx % 2)
+            return isOnSide_(idx, facetIdx) ? eIdx - wrap : eIdx + stride;
+        else
+            return isOnSide_(idx, facetIdx) ? eIdx + wrap : eIdx - stride;
+    }
+
+    //! Information on the global number of geometries
+    std::size_t numScvs_ = 0;
+    std::size_t numBoundaryScvf_ = 0;
+
+    //! the structure of the process-local grid
+    std::array<GridIndexType, dim> numElements_;
+    std::array<GridIndexType, dim> strides_;
+    std::array<SideType, numFacets> sideType_;
+};
+
+} // end namespace Dumux
+
+#endif
@@ -25,14 +25,55 @@
 #ifndef DUMUX_FV_GRID_VARIABLES_HH
 #define DUMUX_FV_GRID_VARIABLES_HH
 
-#include <type_traits>
+#include <cmath>
+#include <vector>
 #include <memory>
+#include <type_traits>
+
+#include <dune/common/std/type_traits.hh>
+
+#include <dumux/common/parameters.hh>
 
 namespace Dumux {
 
+#ifndef DOXYGEN
+namespace Detail {
+
+// helper alias to detect grid volume variables supporting an update of selected dofs
+template<class GridVolumeVariables, class GridGeometry, class SolutionVector>
+using ChangedDofsVolVarsUpdateDetector = decltype(std::declval<GridVolumeVariables&>().updateChangedDofs(
+    std::declval<const GridGeometry&>(), std::declval<const SolutionVector&>(), std::declval<const std::vector<bool>&>()
+));
+
+// helper alias to detect grid flux variables caches supporting an update of selected dofs
+template<class GridFluxVariablesCache, class GridGeometry, class GridVolumeVariables, class SolutionVector>
+using ChangedDofsFluxCacheUpdateDetector = decltype(std::declval<GridFluxVariablesCache&>().updateChangedDofs(
+    std::declval<const GridGeometry&>(), std::declval<const GridVolumeVariables&>(),
+    std::declval<const SolutionVector&>(), std::declval<const std::vector<bool>&>()
+));
+
+// helper alias to detect primary variables with a phase state (primary variable switch)
+template<class PrimaryVariables>
+using PriVarsStateDetector = decltype(std::declval<PrimaryVariables>().state());
+
+} // end namespace Detail
+#endif // DOXYGEN
+
 /*!
  * \ingroup Discretization
  * \brief The grid variable class for finite volume schemes storing variables on scv and scvf (volume and flux variables)
+ *
+ * If `GridVariables.IncrementalUpdate = true` is set, update() only recomputes the volume variables
+ * (and the flux variables caches depending on them) of the dofs whose primary variables changed since
+ * they were last updated. A dof is considered changed if its phase state changed or if the relative shift
+ * of one of its primary variables exceeds `GridVariables.IncrementalUpdateTolerance` (default: 0.0,
+ * i.e. any change of the values). Skipped dofs keep the primary variables of their last update, i.e. the variables
+ * coincide with a full update with these primary variables, and their shift accumulates until it exceeds the tolerance.
+ * This requires volume variables that only depend on the primary variables
+ * (e.g. not on the time or on coupling data) and that the volume variables are not modified elsewhere.
+ * The incremental update is only used if the grid volume variables are cached and support it
+ * (cell-centered and box schemes), otherwise all variables are updated.
+ *
  * \tparam the type of the grid geometry
  * \tparam the type of the grid volume variables
  * \tparam the type of the grid flux variables cache
@@ -66,7 +107,10 @@ public:
     , curGridVolVars_(*problem)
     , prevGridVolVars_(*problem)
     , gridFluxVarsCache_(*problem)
-    {}
+    {
+        incrementalUpdate_ = getParamFromGroup<bool>(problem->paramGroup(), "GridVariables.IncrementalUpdate", false);
+        incrementalUpdateTolerance_ = getParamFromGroup<Scalar>(problem->paramGroup(), "GridVariables.IncrementalUpdateTolerance", 0.0);
+    }
 
     //! initialize all variables (stationary case)
     template<class SolutionVector>
@@ -78,6 +122,9 @@ public:
         // update the flux variables caches (always force flux cache update on initialization)
         gridFluxVarsCache_.update(*gridGeometry_, curGridVolVars_, curSol, true);
 
+        // the state to compare to in incremental updates
+        storeUpdatedSolution_(curSol);
+
         // set the volvars of the previous time step in case we have an instationary problem
         // note that this means some memory overhead in the case of enabled caching, however
         // this it outweighted by the advantage of having a single grid variables object for
@@ -89,11 +136,23 @@ public:
     template<class SolutionVector>
     void update(const SolutionVector& curSol, bool forceFluxCacheUpdate = false)
     {
+        if constexpr (Dune::Std::is_detected_v<Detail::ChangedDofsVolVarsUpdateDetector, GridVolumeVariables, GridGeometry, UpdatedSolution>)
+        {
+            if (incrementalUpdate_ && !forceFluxCacheUpdate && updatedSol_.size() == curSol.size())
+            {
+                updateIncrementally_(curSol);
+                return;
+            }
+        }
+
         // resize and update the volVars with the initial solution
         curGridVolVars_.update(*gridGeometry_, curSol);
 
         // update the flux variables caches
         gridFluxVarsCache_.update(*gridGeometry_, curGridVolVars_, curSol, forceFluxCacheUpdate);
+
+        // the state to compare to in incremental updates
+        storeUpdatedSolution_(curSol);
     }
 
     //! update all variables after grid adaption
@@ -126,6 +185,9 @@ public:
 
         // update the flux variables caches
         gridFluxVarsCache_.update(*gridGeometry_, curGridVolVars_, solution);
+
+        // the state to compare to in incremental updates
+        storeUpdatedSolution_(solution);
     }
 
     //! return the flux variables cache
@@ -161,10 +223,85 @@ protected:
     std::shared_ptr<const GridGeometry> gridGeometry_; //!< pointer to the constant grid geometry
 
 private:
+    using UpdatedSolution = std::vector<PrimaryVariables>;
+
+    //! update the variables of the dofs that changed since their last update
+    template<class SolutionVector>
+    void updateIncrementally_(const SolutionVector& curSol)
+    {
+        dofIsChanged_.assign(curSol.size(), false);
+        bool anyChanged = false;
+        for (std::size_t dofIdx = 0; dofIdx < curSol.size(); ++dofIdx)
+        {
+            if (isChanged_(curSol[dofIdx], updatedSol_[dofIdx]))
+            {
+                dofIsChanged_[dofIdx] = true;
+                updatedSol_[dofIdx] = curSol[dofIdx];
+                anyChanged = true;
+            }
+        }
+
+        if (!anyChanged)
+            return;
+
+        // use the solution of the last update of each dof, such that the variables of skipped dofs
+        // (shift below the tolerance) sharing an element with changed dofs (box) are consistent
+        curGridVolVars_.updateChangedDofs(*gridGeometry_, updatedSol_, dofIsChanged_);
+
+        if constexpr (Dune::Std::is_detected_v<Detail::ChangedDofsFluxCacheUpdateDetector, GridFluxVariablesCache, GridGeometry, GridVolumeVariables, UpdatedSolution>)
+            gridFluxVarsCache_.updateChangedDofs(*gridGeometry_, curGridVolVars_, updatedSol_, dofIsChanged_);
+        else
+            gridFluxVarsCache_.update(*gridGeometry_, curGridVolVars_, updatedSol_);
+    }
+
+    //! whether the primary variables of a dof changed with respect to the state of the last update
+    bool isChanged_(const PrimaryVariables& priVars, const PrimaryVariables& updatedPriVars) const
+    {
+        if constexpr (Dune::Std::is_detected_v<Detail::PriVarsStateDetector, PrimaryVariables>)
+            if (priVars.state() != updatedPriVars.state())
+                return true;
+
+        using std::abs; using std::max;
+        for (std::size_t pvIdx = 0; pvIdx < priVars.size(); ++pvIdx)
+        {
+            if (incrementalUpdateTolerance_ <= 0.0)
+            {
+                if (priVars[pvIdx] != updatedPriVars[pvIdx])
+                    return true;
+            }
+            else
+            {
+                const auto shift = abs(priVars[pvIdx] - updatedPriVars[pvIdx])
+                                   / max<Scalar>(1.0, abs(priVars[pvIdx] + updatedPriVars[pvIdx])*0.5);
+                if (shift > incrementalUpdateTolerance_)
+                    return true;
+            }
+        }
+
+        return false;
+    }
+
+    //! store the solution all variables have been updated with
+    template<class SolutionVector>
+    void storeUpdatedSolution_(const SolutionVector& sol)
+    {
+        if (!incrementalUpdate_)
+            return;
+
+        updatedSol_.resize(sol.size());
+        for (std::size_t dofIdx = 0; dofIdx < sol.size(); ++dofIdx)
+            updatedSol_[dofIdx] = sol[dofIdx];
+    }
+
     GridVolumeVariables curGridVolVars_; //!< the current volume variables (primary and secondary variables)
     GridVolumeVariables prevGridVolVars_; //!< the previous time step's volume variables (primary and secondary variables)
 
     GridFluxVariablesCache gridFluxVarsCache_; //!< the flux variables cache
+
+    bool incrementalUpdate_; //!< whether only the variables of changed dofs are updated
+    Scalar incrementalUpdateTolerance_; //!< the relative shift above which a dof is considered changed
+    UpdatedSolution updatedSol_; //!< the primary variables the volume variables were last updated with
+    std::vector<bool> dofIsChanged_; //!< the dofs that changed in the current update
 };
 
 } // end namespace Dumux
@@ -155,7 +155,7 @@ public:
     FreeFlowStaggeredSubControlVolumeFace(const Intersection& is,
                                           const typename Intersection::Geometry& isGeometry,
                                           GridIndexType scvfIndex,
-                                          const std::vector<GridIndexType>& scvIndices,
+                                          const std::array<GridIndexType, 2>& scvIndices,
                                           const typename T::GeometryHelper& geometryHelper)
     : ParentType(),
       geomType_(isGeometry.type()),
@@ -466,7 +466,7 @@ private:
     GlobalPosition center_;
     GlobalPosition unitOuterNormal_;
     GridIndexType scvfIndex_;
-    std::vector<GridIndexType> scvIndices_;
+    std::array<GridIndexType, 2> scvIndices_;
     bool boundary_;
 
     Scalar selfToOppositeDistance_;
@@ -24,6 +24,7 @@
 #ifndef DUMUX_DISCRETIZATION_STAGGERED_FV_ELEMENT_GEOMETRY_HH
 #define DUMUX_DISCRETIZATION_STAGGERED_FV_ELEMENT_GEOMETRY_HH
 
+#include <array>
 #include <optional>
 #include <dumux/common/indextraits.hh>
 #include <dumux/discretization/cellcentered/tpfa/fvelementgeometry.hh>
@@ -251,7 +252,7 @@ private:
             if (intersection.neighbor() || intersection.boundary())
             {
                 geometryHelper.updateLocalFace(gridGeometry().intersectionMapper(), intersection);
-                std::vector<GridIndexType> scvIndices{eIdx, scvfNeighborVolVarIndex};
+                const std::array<GridIndexType, 2> scvIndices{{eIdx, scvfNeighborVolVarIndex}};
                 scvfs_.emplace_back(intersection,
                                     intersection.geometry(),
                                     scvFaceIndices[scvfCounter],
@@ -291,7 +292,7 @@ private:
                 // only create subcontrol faces where the outside element is the bound element
                 if (intersection.outside() == *element_)
                 {
-                    std::vector<GridIndexType> scvIndices{eIdx, scvfNeighborVolVarIndex};
+                    const std::array<GridIndexType, 2> scvIndices{{eIdx, scvfNeighborVolVarIndex}};
                     neighborScvfs_.emplace_back(intersection,
                                                 intersection.geometry(),
                                                 scvFaceIndices[scvfCounter],
@@ -24,6 +24,7 @@
 #ifndef DUMUX_DISCRETIZATION_STAGGERED_SUBCONTROLVOLUMEFACE_HH
 #define DUMUX_DISCRETIZATION_STAGGERED_SUBCONTROLVOLUMEFACE_HH
 
+#include <array>
 #include <utility>
 
 #include <dune/common/fvector.hh>
@@ -138,7 +139,7 @@ public:
     StaggeredSubControlVolumeFace(const Intersection& is,
                                   const typename Intersection::Geometry& isGeometry,
                                   GridIndexType scvfIndex,
-                                  const std::vector<GridIndexType>& scvIndices,
+                                  const std::array<GridIndexType, 2>& scvIndices,
                                   const GeometryHelper& geometryHelper)
     : ParentType()
     , geomType_(isGeometry.type())
@@ -244,7 +245,7 @@ private:
     GlobalPosition center_;
     GlobalPosition unitOuterNormal_;
     GridIndexType scvfIndex_;
-    std::vector<GridIndexType> scvIndices_;
+    std::array<GridIndexType, 2> scvIndices_;
     bool boundary_;
 
     GridIndexType dofIdx_;
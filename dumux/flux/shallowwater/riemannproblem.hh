@@ -25,6 +25,8 @@
 #ifndef DUMUX_FLUX_SHALLOW_WATER_RIEMANN_PROBLEM_HH
 #define DUMUX_FLUX_SHALLOW_WATER_RIEMANN_PROBLEM_HH
 
+#include <array>
+
 #include <dumux/common/parameters.hh>
 #include <dumux/flux/shallowwater/fluxlimiterlet.hh>
 #include <dumux/flux/shallowwater/exactriemann.hh>
@@ -34,50 +36,38 @@ namespace ShallowWater {
 
 /*!
  * \ingroup ShallowWaterFlux
- * \brief Construct a Riemann problem and solve it
- *
- *
- * Riemann problem applies the hydrostatic reconstruction, uses the
- * Riemann invariants to transform the two-dimensional problem to a
- * one-dimensional problem, solves this new problem, and rotates
- * the problem back. Further it applies a flux limiter for the water
- * flux to handle drying elements.
- * The correction of the bed slope source term leads to a
- * non-symmetric flux term at the interface for the momentum equations.
- * Since DuMuX computes the fluxes twice from each side this does not
- * matter.
- *
- * So far this implements the exact Riemann solver (with reconstruction
- * after Audusse).
- *
- * The computed water flux (localFlux[0]) is given in m^2/s, the
- * momentum fluxes (localFlux[1], localFlux[2]) are given in m^3/s^2.
- * Later this flux will be multiplied by the scvf.area() (given in m
- * for a 2D problem) to get the flux over a face.
+ * \brief The fluxes of a Riemann problem seen from both sides of the interface
  *
- * \param waterDepthLeft water depth on the left side
- * \param waterDepthRight water depth on the right side
- * \param velocityXLeft veloctiyX on the left side
- * \param velocityXRight velocityX on the right side
- * \param velocityYLeft velocityY on the left side
- * \param velocityYRight velocityY on the right side
- * \param bedSurfaceLeft surface of the bed on the left side
- * \param bedSurfaceRight surface of the bed on the right side
- * \param gravity gravity constant
- * \param nxy the normal vector
+ * The water flux and the Riemann momentum flux of the right side are the negated fluxes
+ * of the left side, only the bed slope correction of the reconstruction differs.
+ */
+template<class Scalar>
+struct TwoSidedRiemannFlux
+{
+    std::array<Scalar, 3> left; //!< the flux in direction of the normal (leaving the left side)
+    std::array<Scalar, 3> right; //!< the flux in opposite direction of the normal (leaving the right side)
+};
+
+/*!
+ * \ingroup ShallowWaterFlux
+ * \brief Construct a Riemann problem and solve it, returning the fluxes of both sides
  *
+ * The fluxes leaving the left and the right side of the interface are computed with a single
+ * solution of the Riemann problem. The flux of the left side is the one of riemannProblem, the
+ * flux of the right side equals (up to rounding) the one of riemannProblem with the left and right
+ * states swapped and the normal reversed. See riemannProblem for a description of the parameters.
  */
 template<class Scalar, class GlobalPosition>
-std::array<Scalar,3> riemannProblem(const Scalar waterDepthLeft,
-                                    const Scalar waterDepthRight,
-                                    Scalar velocityXLeft,
-                                    Scalar velocityXRight,
-                                    Scalar velocityYLeft,
-                                    Scalar velocityYRight,
-                                    const Scalar bedSurfaceLeft,
-                                    const Scalar bedSurfaceRight,
-                                    const Scalar gravity,
-                                    const GlobalPosition& nxy)
+TwoSidedRiemannFlux<Scalar> twoSidedRiemannProblem(const Scalar waterDepthLeft,
+                                                   const Scalar waterDepthRight,
+                                                   Scalar velocityXLeft,
+                                                   Scalar velocityXRight,
+                                                   Scalar velocityYLeft,
+                                                   Scalar velocityYRight,
+                                                   const Scalar bedSurfaceLeft,
+                                                   const Scalar bedSurfaceRight,
+                                                   const Scalar gravity,
+                                                   const GlobalPosition& nxy)
 {
     using std::max;
 
@@ -114,13 +104,10 @@ std::array<Scalar,3> riemannProblem(const Scalar waterDepthLeft,
     const Scalar hdxzl = gravity * nxy[0] * hgzl;
     const Scalar hdyzl = gravity * nxy[1] * hgzl;
 
-    /*Right side is computed from the other side otherwise the
-      following "non-symetric" fluxes are needed:
-
-      Scalar hgzr = 0.5 * (waterDepthRightReconstructed + waterDepthRight) * (waterDepthRightReconstructed - waterDepthRight);
-      Scalar hdxzr = gravity * nxy[0] * hgzr;
-      Scalar hdyzrhdyzr = gravity * nxy[1] * hgzr;
-    */
+    // the reconstruction flux of the right side (with the reversed normal)
+    const Scalar hgzr = 0.5 * (waterDepthRightReconstructed + waterDepthRight) * (waterDepthRightReconstructed - waterDepthRight);
+    const Scalar hdxzr = -gravity * nxy[0] * hgzr;
+    const Scalar hdyzr = -gravity * nxy[1] * hgzr;
 
     // compute the mobility of the flux with the fluxlimiter
     static const Scalar upperWaterDepthFluxLimiting = getParam<Scalar>("FluxLimiterLET.UpperWaterDepth", 1e-3);
@@ -145,14 +132,71 @@ std::array<Scalar,3> riemannProblem(const Scalar waterDepthLeft,
                                                          limitingDepth,
                                                          upperWaterDepthFluxLimiting,
                                                          lowerWaterDepthFluxLimiting);
-    std::array<Scalar, 3> localFlux;
-    localFlux[0] = riemannResult.flux[0] * mobility;
-    localFlux[1] = (riemannResult.flux[1] - hdxzl);
-    localFlux[2] = (riemannResult.flux[2] - hdyzl);
+    TwoSidedRiemannFlux<Scalar> localFlux;
+    localFlux.left[0] = riemannResult.flux[0] * mobility;
+    localFlux.left[1] = (riemannResult.flux[1] - hdxzl);
+    localFlux.left[2] = (riemannResult.flux[2] - hdyzl);
+    localFlux.right[0] = -localFlux.left[0];
+    localFlux.right[1] = (-riemannResult.flux[1] - hdxzr);
+    localFlux.right[2] = (-riemannResult.flux[2] - hdyzr);
 
     return localFlux;
 }
 
+/*!
+ * \ingroup ShallowWaterFlux
+ * \brief Construct a Riemann problem and solve it
+ *
+ *
+ * Riemann problem applies the hydrostatic reconstruction, uses the
+ * Riemann invariants to transform the two-dimensional problem to a
+ * one-dimensional problem, solves this new problem, and rotates
+ * the problem back. Further it applies a flux limiter for the water
+ * flux to handle drying elements.
+ * The correction of the bed slope source term leads to a
+ * non-symmetric flux term at the interface for the momentum equations.
+ * Since DuMuX computes the fluxes twice from each side this does not
+ * matter.
+ *
+ * So far this implements the exact Riemann solver (with reconstruction
+ * after Audusse).
+ *
+ * The computed water flux (localFlux[0]) is given in m^2/s, the
+ * momentum fluxes (localFlux[1], localFlux[2]) are given in m^3/s^2.
+ * Later this flux will be multiplied by the scvf.area() (given in m
+ * for a 2D problem) to get the flux over a face.
+ *
+ * \param waterDepthLeft water depth on the left side
+ * \param waterDepthRight water depth on the right side
+ * \param velocityXLeft veloctiyX on the left side
+ * \param velocityXRight velocityX on the right side
+ * \param velocityYLeft velocityY on the left side
+ * \param velocityYRight velocityY on the right side
+ * \param bedSurfaceLeft surface of the bed on the left side
+ * \param bedSurfaceRight surface of the bed on the right side
+ * \param gravity gravity constant
+ * \param nxy the normal vector
+ *
+ */
+template<class Scalar, class GlobalPosition>
+std::array<Scalar,3> riemannProblem(const Scalar waterDepthLeft,
+                                    const Scalar waterDepthRight,
+                                    Scalar velocityXLeft,
+                                    Scalar velocityXRight,
+                                    Scalar velocityYLeft,
+                                    Scalar velocityYRight,
+                                    const Scalar bedSurfaceLeft,
+                                    const Scalar bedSurfaceRight,
+                                    const Scalar gravity,
+                                    const GlobalPosition& nxy)
+{
+    return twoSidedRiemannProblem(waterDepthLeft, waterDepthRight,
+                                  velocityXLeft, velocityXRight,
+                                  velocityYLeft, velocityYRight,
+                                  bedSurfaceLeft, bedSurfaceRight,
+                                  gravity, nxy).left;
+}
+
 } // end namespace ShallowWater
 } // end namespace Dumux
 
@@ -0,0 +1,392 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*****************************************************************************
+ *   See the file COPYING for full copying permissions.                      *
+ *                                                                           *
+ *   This program is free software: you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by    *
+ *   the Free Software Foundation, either version 3 of the License, or       *
+ *   (at your option) any later version.                                     *
+ *                                                                           *
+ *   This program is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the            *
+ *   GNU General Public License for more details.                            *
+ *                                                                           *
+ *   You should have received a copy of the GNU General Public License       *
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.   *
+ *****************************************************************************/
+/*!
+ * \file
+ * \ingroup ShallowWaterModel
+ * \brief A face-based kernel evaluating the spatial operator of the shallow water model
+ *        for explicit time integration with cell-centered finite volumes
+ */
+#ifndef DUMUX_FREEFLOW_SHALLOW_WATER_EXPLICIT_KERNEL_HH
+#define DUMUX_FREEFLOW_SHALLOW_WATER_EXPLICIT_KERNEL_HH
+
+#include <cmath>
+#include <array>
+#include <vector>
+#include <memory>
+#include <limits>
+#include <numeric>
+#include <algorithm>
+
+#include <dune/common/exceptions.hh>
+
+#include <dumux/common/properties.hh>
+#include <dumux/common/parameters.hh>
+#include <dumux/discretization/method.hh>
+#include <dumux/discretization/extrusion.hh>
+#include <dumux/parallel/parallel_for.hh>
+#include <dumux/parallel/threadlocalstorage.hh>
+#include <dumux/flux/shallowwater/riemannproblem.hh>
+
+namespace Dumux {
+
+/*!
+ * \ingroup ShallowWaterModel
+ * \brief A face-based kernel evaluating the spatial operator of the shallow water model
+ *        for explicit time integration with cell-centered finite volumes
+ *
+ * The generic assembly evaluates the Riemann problem of each interior face twice (once from each
+ * side) and binds local views of the geometry and the volume variables for each element. This kernel
+ * stores the water depth, the velocities and the bed surface of all cells in separate arrays
+ * (structure of arrays) and the geometry of the interior faces in a flat face list. Each interior
+ * face is processed once (in parallel) with ShallowWater::twoSidedRiemannProblem, which yields the
+ * fluxes of both adjacent cells. The face fluxes are then gathered per cell (in parallel), such that
+ * no two threads write to the same cell. Only for the sources and the boundary faces (Neumann fluxes)
+ * the problem interface is evaluated, using local views bound to the single element.
+ *
+ * The resulting residual (fluxes minus sources, storage excluded) is the one of the shallow water
+ * local residual up to round-off, since the same Riemann solver is used.
+ *
+ * \note Only the advective flux is supported, the viscous flux (ShallowWater.EnableViscousFlux) is not.
+ * \note If the grid volume variables are cached, they have to be updated with the solution before
+ *       evaluating the kernel (they are only used for the sources and the boundary fluxes).
+ * \note Point sources are not considered.
+ */
+template<class TypeTag>
+class ShallowWaterExplicitKernel
+{
+    using Scalar = GetPropType<TypeTag, Properties::Scalar>;
+    using Problem = GetPropType<TypeTag, Properties::Problem>;
+    using GridGeometry = GetPropType<TypeTag, Properties::GridGeometry>;
+    using GridVariables = GetPropType<TypeTag, Properties::GridVariables>;
+    using SolutionVector = GetPropType<TypeTag, Properties::SolutionVector>;
+    using NumEqVector = GetPropType<TypeTag, Properties::NumEqVector>;
+    using Indices = typename GetPropType<TypeTag, Properties::ModelTraits>::Indices;
+    using FVElementGeometry = typename GridGeometry::LocalView;
+    using ElementVolumeVariables = typename GridVariables::GridVolumeVariables::LocalView;
+    using ElementFluxVariablesCache = typename GridVariables::GridFluxVariablesCache::LocalView;
+    using Extrusion = Extrusion_t<GridGeometry>;
+
+    static_assert(GridGeometry::discMethod == DiscretizationMethod::cctpfa,
+                  "The explicit shallow water kernel is implemented for the cell-centered tpfa scheme");
+
+    static constexpr int numEq = GetPropType<TypeTag, Properties::ModelTraits>::numEq();
+    static constexpr int massIdx = Indices::massBalanceIdx;
+    static constexpr int momentumXIdx = Indices::momentumXBalanceIdx;
+    static constexpr int momentumYIdx = Indices::momentumYBalanceIdx;
+
+    struct LocalViews
+    {
+        FVElementGeometry fvGeometry;
+        ElementVolumeVariables elemVolVars;
+        ElementFluxVariablesCache elemFluxVarsCache;
+    };
+
+public:
+    /*!
+     * \brief The constructor
+     * \param problem the shallow water problem
+     * \param gridGeometry the grid geometry
+     * \param gridVariables the grid variables (the volume variables are used for sources and boundary fluxes)
+     */
+    ShallowWaterExplicitKernel(std::shared_ptr<const Problem> problem,
+                               std::shared_ptr<const GridGeometry> gridGeometry,
+                               std::shared_ptr<GridVariables> gridVariables)
+    : problem_(problem)
+    , gridGeometry_(gridGeometry)
+    , gridVariables_(gridVariables)
+    , localViews_([this]{
+        return LocalViews{ localView(*gridGeometry_),
+                           localView(gridVariables_->curGridVolVars()),
+                           localView(gridVariables_->gridFluxVarsCache()) };
+    })
+    {
+        if (getParamFromGroup<bool>(problem_->paramGroup(), "ShallowWater.EnableViscousFlux", false))
+            DUNE_THROW(Dune::NotImplemented, "The explicit shallow water kernel does not support the viscous flux");
+
+        update();
+    }
+
+    /*!
+     * \brief Update the cell and face data (has to be called after the grid geometry changed)
+     */
+    void update()
+    {
+        const auto& gridGeometry = *gridGeometry_;
+        const auto numCells = gridGeometry.numDofs();
+        gridGeometry.elementMap(); // make sure the element map is built before the threaded loops
+
+        volume_.assign(numCells, 0.0);
+        bedSurface_.assign(numCells, 0.0);
+        hasBoundaryFaces_.assign(numCells, false);
+        waterDepth_.resize(numCells);
+        velocityX_.resize(numCells);
+        velocityY_.resize(numCells);
+        inside_.clear(); outside_.clear();
+        normalX_.clear(); normalY_.clear();
+        area_.clear(); gravity_.clear();
+
+        auto fvGeometry = localView(gridGeometry);
+        for (const auto& element : elements(gridGeometry.gridView()))
+        {
+            fvGeometry.bindElement(element);
+            for (const auto& scv : scvs(fvGeometry))
+            {
+                const auto eIdx = scv.dofIndex();
+                volume_[eIdx] = Extrusion::volume(scv);
+                bedSurface_[eIdx] = problem_->spatialParams().bedSurface(element, scv);
+            }
+
+            for (const auto& scvf : scvfs(fvGeometry))
+            {
+                if (scvf.boundary())
+                {
+                    hasBoundaryFaces_[scvf.insideScvIdx()] = true;
+                    const auto bcTypes = problem_->boundaryTypes(element, scvf);
+                    if (!bcTypes.hasOnlyNeumann())
+                        DUNE_THROW(Dune::NotImplemented, "The explicit shallow water kernel only supports Neumann boundaries");
+                    continue;
+                }
+
+                if (scvf.numOutsideScvs() > 1)
+                    DUNE_THROW(Dune::NotImplemented, "The explicit shallow water kernel does not support non-conforming grids");
+
+                // each interior face is stored once (from the cell with the smaller index)
+                if (scvf.insideScvIdx() < scvf.outsideScvIdx())
+                {
+                    inside_.push_back(scvf.insideScvIdx());
+                    outside_.push_back(scvf.outsideScvIdx());
+                    normalX_.push_back(scvf.unitOuterNormal()[0]);
+                    normalY_.push_back(scvf.unitOuterNormal()[1]);
+                    area_.push_back(Extrusion::area(scvf));
+                    gravity_.push_back(problem_->spatialParams().gravity(scvf.center()));
+                }
+            }
+        }
+
+        const auto numFaces = inside_.size();
+        for (auto& f : fluxInside_)
+            f.resize(numFaces);
+        for (auto& f : fluxOutside_)
+            f.resize(numFaces);
+        waveSpeedArea_.resize(numFaces);
+
+        // the faces of each cell (compressed row storage), faces are encoded as 2*faceIdx + side
+        cellFacesOffset_.assign(numCells+1, 0);
+        for (std::size_t k = 0; k < numFaces; ++k)
+        {
+            ++cellFacesOffset_[inside_[k]+1];
+            ++cellFacesOffset_[outside_[k]+1];
+        }
+        std::partial_sum(cellFacesOffset_.begin(), cellFacesOffset_.end(), cellFacesOffset_.begin());
+
+        cellFaces_.resize(cellFacesOffset_.back());
+        auto pos = cellFacesOffset_;
+        for (std::size_t k = 0; k < numFaces; ++k)
+        {
+            cellFaces_[pos[inside_[k]]++] = 2*k;
+            cellFaces_[pos[outside_[k]]++] = 2*k + 1;
+        }
+    }
+
+    /*!
+     * \brief Evaluate the residual of the spatial operator (the fluxes leaving the cells minus the sources)
+     * \param x the solution (water depth and velocities)
+     * \param residual the residual (resized if necessary), equal to the residual of the local residual without storage term
+     */
+    void evalResidual(const SolutionVector& x, SolutionVector& residual)
+    {
+        residual.resize(x.size());
+        loadCellStates_(x);
+        computeFaceFluxes_();
+        accumulate_(x, residual);
+    }
+
+    /*!
+     * \brief The largest stable time step size of the explicit Euler method
+     *
+     * For each cell, the time step size is estimated as
+     * \f$ \mathrm{Cr} \, V / \sum_f A_f (|\mathbf{u} \cdot \mathbf{n}_f| + \sqrt{g h}) \f$
+     * with the maximum wave speed of the two cells adjacent to the face.
+     *
+     * \param x the solution
+     * \param courantNumber the Courant number (should be smaller than 1)
+     */
+    Scalar maxTimeStepSize(const SolutionVector& x, const Scalar courantNumber)
+    {
+        loadCellStates_(x);
+        const auto numFaces = inside_.size();
+        parallelFor(numFaces, [&](const std::size_t k)
+        {
+            using std::abs; using std::sqrt; using std::max;
+            const auto i = inside_[k]; const auto j = outside_[k];
+            const Scalar un = velocityX_[i]*normalX_[k] + velocityY_[i]*normalY_[k];
+            const Scalar vn = velocityX_[j]*normalX_[k] + velocityY_[j]*normalY_[k];
+            const Scalar waveSpeed = max(abs(un) + sqrt(gravity_[k]*max(waterDepth_[i], 0.0)),
+                                         abs(vn) + sqrt(gravity_[k]*max(waterDepth_[j], 0.0)));
+            waveSpeedArea_[k] = waveSpeed*area_[k];
+        });
+
+        std::vector<Scalar> dt(volume_.size());
+        parallelFor(volume_.size(), [&](const std::size_t eIdx)
+        {
+            Scalar sum = 0.0;
+            for (auto f = cellFacesOffset_[eIdx]; f < cellFacesOffset_[eIdx+1]; ++f)
+                sum += waveSpeedArea_[cellFaces_[f]/2];
+            dt[eIdx] = sum > 0.0 ? courantNumber*volume_[eIdx]/sum : std::numeric_limits<Scalar>::max();
+        });
+
+        return dt.empty() ? std::numeric_limits<Scalar>::max() : *std::min_element(dt.begin(), dt.end());
+    }
+
+    /*!
+     * \brief Advance the solution by one explicit Euler step
+     *
+     * The conserved quantities \f$ (h, hu, hv) \f$ are updated with the residual of the spatial operator.
+     * In cells with a water depth below FluxLimiterLET.LowerWaterDepth the velocities are set to zero.
+     *
+     * \param x the solution at the old time level, overwritten with the solution at the new time level
+     * \param dt the time step size
+     */
+    void explicitEulerStep(SolutionVector& x, const Scalar dt)
+    {
+        evalResidual(x, residual_);
+
+        static const Scalar dryWaterDepth = getParamFromGroup<Scalar>(problem_->paramGroup(), "FluxLimiterLET.LowerWaterDepth", 1e-5);
+        parallelFor(x.size(), [&](const std::size_t eIdx)
+        {
+            const Scalar factor = dt/volume_[eIdx];
+            const Scalar h = waterDepth_[eIdx] - factor*residual_[eIdx][massIdx];
+            const Scalar hu = waterDepth_[eIdx]*velocityX_[eIdx] - factor*residual_[eIdx][momentumXIdx];
+            const Scalar hv = waterDepth_[eIdx]*velocityY_[eIdx] - factor*residual_[eIdx][momentumYIdx];
+
+            auto& priVars = x[eIdx];
+            priVars[Indices::waterdepthIdx] = h;
+            priVars[Indices::velocityXIdx] = h > dryWaterDepth ? hu/h : 0.0;
+            priVars[Indices::velocityYIdx] = h > dryWaterDepth ? hv/h : 0.0;
+        });
+    }
+
+    //! The number of interior faces
+    std::size_t numInteriorFaces() const
+    { return inside_.size(); }
+
+private:
+    //! copy the primary variables into the cell arrays
+    void loadCellStates_(const SolutionVector& x)
+    {
+        parallelFor(x.size(), [&](const std::size_t eIdx)
+        {
+            waterDepth_[eIdx] = x[eIdx][Indices::waterdepthIdx];
+            velocityX_[eIdx] = x[eIdx][Indices::velocityXIdx];
+            velocityY_[eIdx] = x[eIdx][Indices::velocityYIdx];
+        });
+    }
+
+    //! solve the Riemann problem of all interior faces
+    void computeFaceFluxes_()
+    {
+        parallelFor(inside_.size(), [&](const std::size_t k)
+        {
+            const auto i = inside_[k]; const auto j = outside_[k];
+            const std::array<Scalar, 2> normal{{ normalX_[k], normalY_[k] }};
+            const auto flux = ShallowWater::twoSidedRiemannProblem(
+                waterDepth_[i], waterDepth_[j],
+                velocityX_[i], velocityX_[j],
+                velocityY_[i], velocityY_[j],
+                bedSurface_[i], bedSurface_[j],
+                gravity_[k], normal
+            );
+
+            for (int eqIdx = 0; eqIdx < numEq; ++eqIdx)
+            {
+                fluxInside_[eqIdx][k] = flux.left[eqIdx]*area_[k];
+                fluxOutside_[eqIdx][k] = flux.right[eqIdx]*area_[k];
+            }
+        });
+    }
+
+    //! gather the face fluxes per cell and add sources and boundary fluxes
+    void accumulate_(const SolutionVector& x, SolutionVector& residual)
+    {
+        parallelFor(residual.size(), [&](const std::size_t eIdx)
+        {
+            NumEqVector r(0.0);
+            for (auto f = cellFacesOffset_[eIdx]; f < cellFacesOffset_[eIdx+1]; ++f)
+            {
+                const auto k = cellFaces_[f]/2;
+                const auto& flux = (cellFaces_[f] % 2 == 0) ? fluxInside_ : fluxOutside_;
+                for (int eqIdx = 0; eqIdx < numEq; ++eqIdx)
+                    r[eqIdx] += flux[eqIdx][k];
+            }
+
+            auto& views = localViews_.local();
+            const auto element = gridGeometry_->element(eIdx);
+            views.fvGeometry.bindElement(element);
+            views.elemVolVars.bindElement(element, views.fvGeometry, x);
+
+            for (const auto& scv : scvs(views.fvGeometry))
+            {
+                auto source = problem_->source(element, views.fvGeometry, views.elemVolVars, scv);
+                source *= Extrusion::volume(scv)*views.elemVolVars[scv].extrusionFactor();
+                r -= source;
+            }
+
+            if (hasBoundaryFaces_[eIdx])
+            {
+                views.elemFluxVarsCache.bindElement(element, views.fvGeometry, views.elemVolVars);
+                for (const auto& scvf : scvfs(views.fvGeometry))
+                {
+                    if (!scvf.boundary())
+                        continue;
+
+                    const auto& insideScv = views.fvGeometry.scv(scvf.insideScvIdx());
+                    auto neumannFlux = problem_->neumann(element, views.fvGeometry, views.elemVolVars, views.elemFluxVarsCache, scvf);
+                    neumannFlux *= Extrusion::area(scvf)*views.elemVolVars[insideScv].extrusionFactor();
+                    r += neumannFlux;
+                }
+            }
+
+            residual[eIdx] = r;
+        });
+    }
+
+    std::shared_ptr<const Problem> problem_;
+    std::shared_ptr<const GridGeometry> gridGeometry_;
+    std::shared_ptr<GridVariables> gridVariables_;
+    ThreadLocalStorage<LocalViews> localViews_;
+
+    // cell data
+    std::vector<Scalar> waterDepth_, velocityX_, velocityY_, bedSurface_, volume_;
+    std::vector<bool> hasBoundaryFaces_;
+
+    // interior face data
+    std::vector<std::size_t> inside_, outside_;
+    std::vector<Scalar> normalX_, normalY_, area_, gravity_;
+    std::array<std::vector<Scalar>, numEq> fluxInside_, fluxOutside_;
+    std::vector<Scalar> waveSpeedArea_;
+
+    // the interior faces of each cell
+    std::vector<std::size_t> cellFacesOffset_, cellFaces_;
+
+    SolutionVector residual_;
+};
+
+} // end namespace Dumux
+
+#endif
@@ -0,0 +1,251 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*****************************************************************************
+ *   See the file COPYING for full copying permissions.                      *
+ *                                                                           *
+ *   This program is free software: you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by    *
+ *   the Free Software Foundation, either version 3 of the License, or       *
+ *   (at your option) any later version.                                     *
+ *                                                                           *
+ *   This program is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the            *
+ *   GNU General Public License for more details.                            *
+ *                                                                           *
+ *   You should have received a copy of the GNU General Public License       *
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.   *
+ *****************************************************************************/
+/*!
+ * \file
+ * \ingroup ShallowWaterModel
+ * \brief The set of wet cells (plus a halo of dry cells) of a shallow water simulation
+ */
+#ifndef DUMUX_FREEFLOW_SHALLOW_WATER_WET_DRY_ACTIVE_SET_HH
+#define DUMUX_FREEFLOW_SHALLOW_WATER_WET_DRY_ACTIVE_SET_HH
+
+#include <vector>
+#include <memory>
+#include <string>
+#include <limits>
+#include <algorithm>
+#include <utility>
+
+#include <dune/common/exceptions.hh>
+
+#include <dumux/common/parameters.hh>
+#include <dumux/discretization/method.hh>
+#include <dumux/freeflow/shallowwater/indices.hh>
+
+namespace Dumux {
+
+/*!
+ * \ingroup ShallowWaterModel
+ * \brief The set of wet cells (plus a halo of dry cells) of a shallow water simulation
+ *
+ * In dry cells without wet neighbors, the water depth is below the threshold of the flux limiter
+ * (FluxLimiterLET.LowerWaterDepth), such that there is no flux and the solution does not change
+ * (unless there is a source, see below).
+ * The active set consists of the wet cells and ShallowWater.ActiveSetHaloLayers layers of neighboring
+ * dry cells (default 2), into which the wetting front can propagate during a time step.
+ * The active element flags can be passed to FVAssembler::setActiveElements and ActiveSetLinearSolver
+ * (they are updated in place by update()), such that assembly and linear solve are restricted to
+ * the active set.
+ *
+ * After solving a time step, frontContained() tells whether the front reached the outermost halo layer.
+ * In that case the active set might have been too small and the time step should be repeated
+ * after extending the active set by the wet cells of the new solution (see extend()).
+ *
+ * Cells with a nonzero source term (e.g. rainfall or an inflow) can become wet without a wet neighbor.
+ * They have to be marked with setSourceElements() and are then always active (like wet cells).
+ * Sources in unmarked cells outside of the active set are not assembled and thus ignored.
+ *
+ * \tparam GridGeometry the grid geometry of a cell-centered scheme
+ */
+template<class GridGeometry>
+class ShallowWaterWetDryActiveSet
+{
+    static_assert(GridGeometry::discMethod != DiscretizationMethod::box,
+                  "The wet/dry active set is implemented for cell-centered schemes");
+
+public:
+    /*!
+     * \brief The constructor (all cells are active until update() is called)
+     * \param gridGeometry the grid geometry
+     * \param paramGroup the parameter group for the threshold and the number of halo layers
+     */
+    ShallowWaterWetDryActiveSet(std::shared_ptr<const GridGeometry> gridGeometry,
+                                const std::string& paramGroup = "")
+    : gridGeometry_(gridGeometry)
+    , active_(std::make_shared<std::vector<bool>>())
+    {
+        wetWaterDepth_ = getParamFromGroup<double>(paramGroup, "FluxLimiterLET.LowerWaterDepth", 1e-5);
+        numHaloLayers_ = getParamFromGroup<int>(paramGroup, "ShallowWater.ActiveSetHaloLayers", 2);
+        if (numHaloLayers_ < 1)
+            DUNE_THROW(Dune::InvalidStateException, "The active set needs at least one halo layer");
+
+        updateConnectivity();
+    }
+
+    /*!
+     * \brief Update the cell neighbors (has to be called after the grid geometry changed)
+     */
+    void updateConnectivity()
+    {
+        const auto& gridGeometry = *gridGeometry_;
+        const auto numCells = gridGeometry.gridView().size(0);
+
+        std::vector<std::vector<std::size_t>> neighbors(numCells);
+        auto fvGeometry = localView(gridGeometry);
+        for (const auto& element : elements(gridGeometry.gridView()))
+        {
+            fvGeometry.bindElement(element);
+            const auto eIdx = gridGeometry.elementMapper().index(element);
+            for (const auto& scvf : scvfs(fvGeometry))
+                if (!scvf.boundary())
+                    for (std::size_t i = 0; i < scvf.numOutsideScvs(); ++i)
+                        neighbors[eIdx].push_back(scvf.outsideScvIdx(i));
+        }
+
+        neighborsOffset_.assign(numCells+1, 0);
+        for (std::size_t eIdx = 0; eIdx < numCells; ++eIdx)
+            neighborsOffset_[eIdx+1] = neighborsOffset_[eIdx] + neighbors[eIdx].size();
+
+        neighbors_.clear();
+        neighbors_.reserve(neighborsOffset_.back());
+        for (const auto& n : neighbors)
+            neighbors_.insert(neighbors_.end(), n.begin(), n.end());
+
+        layer_.assign(numCells, 0);
+        active_->assign(numCells, true);
+        numActive_ = numCells;
+        hasSource_.clear();
+    }
+
+    /*!
+     * \brief Mark the cells with a nonzero source term, which are kept active even if they are dry
+     * \param hasSource flags for all cells (indexed by the element index)
+     * \note Takes effect in the next call to update() or extend().
+     *       The flags are reset by updateConnectivity() and have to be set again after the grid changed.
+     */
+    void setSourceElements(std::vector<bool> hasSource)
+    {
+        if (hasSource.size() != layer_.size())
+            DUNE_THROW(Dune::InvalidStateException, "Expected source flags for " << layer_.size()
+                                                    << " cells, got " << hasSource.size());
+        hasSource_ = std::move(hasSource);
+    }
+
+    /*!
+     * \brief Update the active set for the given solution
+     * \return the number of active cells
+     */
+    template<class SolutionVector>
+    std::size_t update(const SolutionVector& x)
+    {
+        layer_.assign(layer_.size(), inactiveLayer_);
+        return addWetCells_(x);
+    }
+
+    /*!
+     * \brief Extend the active set by the wet cells of the given solution (and their halo)
+     *
+     * Cells which are wet in the current active set stay active. This is used to repeat a time step
+     * with an active set containing both the wet cells of the old and of the new solution.
+     * \return the number of active cells
+     */
+    template<class SolutionVector>
+    std::size_t extend(const SolutionVector& x)
+    {
+        std::replace_if(layer_.begin(), layer_.end(), [](int l){ return l > 0; }, inactiveLayer_);
+        return addWetCells_(x);
+    }
+
+    /*!
+     * \brief Whether the wetting front of the given solution is contained in the active set,
+     *        i.e. no cell of the outermost halo layer (or outside of the active set) is wet
+     */
+    template<class SolutionVector>
+    bool frontContained(const SolutionVector& x) const
+    {
+        for (std::size_t eIdx = 0; eIdx < layer_.size(); ++eIdx)
+            if (layer_[eIdx] >= numHaloLayers_ && isWet_(x, eIdx))
+                return false;
+        return true;
+    }
+
+    //! The active element flags (updated in place by update())
+    std::shared_ptr<const std::vector<bool>> activeElements() const
+    { return active_; }
+
+    //! Whether an element is active
+    bool isActive(std::size_t eIdx) const
+    { return (*active_)[eIdx]; }
+
+    //! The number of active elements
+    std::size_t numActiveElements() const
+    { return numActive_; }
+
+private:
+    // mark the wet cells of x (and the cells with a source) as layer 0 and compute the halo layers by a breadth-first search
+    template<class SolutionVector>
+    std::size_t addWetCells_(const SolutionVector& x)
+    {
+        const auto numCells = layer_.size();
+
+        std::vector<std::size_t> front;
+        for (std::size_t eIdx = 0; eIdx < numCells; ++eIdx)
+        {
+            if (layer_[eIdx] == 0 || isWet_(x, eIdx) || (!hasSource_.empty() && hasSource_[eIdx]))
+            {
+                layer_[eIdx] = 0;
+                front.push_back(eIdx);
+            }
+        }
+
+        std::vector<std::size_t> nextFront;
+        for (int layer = 1; layer <= numHaloLayers_; ++layer)
+        {
+            nextFront.clear();
+            for (const auto eIdx : front)
+            {
+                for (auto n = neighborsOffset_[eIdx]; n < neighborsOffset_[eIdx+1]; ++n)
+                {
+                    const auto nIdx = neighbors_[n];
+                    if (layer_[nIdx] == inactiveLayer_)
+                    {
+                        layer_[nIdx] = layer;
+                        nextFront.push_back(nIdx);
+                    }
+                }
+            }
+            std::swap(front, nextFront);
+        }
+
+        for (std::size_t eIdx = 0; eIdx < numCells; ++eIdx)
+            (*active_)[eIdx] = layer_[eIdx] != inactiveLayer_;
+
+        numActive_ = std::count(active_->begin(), active_->end(), true);
+        return numActive_;
+    }
+
+    template<class SolutionVector>
+    bool isWet_(const SolutionVector& x, std::size_t eIdx) const
+    { return x[eIdx][ShallowWaterIndices::waterdepthIdx] > wetWaterDepth_; }
+
+    static constexpr int inactiveLayer_ = std::numeric_limits<int>::max();
+
+    std::shared_ptr<const GridGeometry> gridGeometry_;
+    double wetWaterDepth_;
+    int numHaloLayers_;
+
+    std::vector<std::size_t> neighborsOffset_, neighbors_;
+    std::vector<int> layer_; //!< 0 for wet cells, the halo layer for dry active cells
+    std::vector<bool> hasSource_; //!< cells with a source (always active), empty if not set
+    std::shared_ptr<std::vector<bool>> active_;
+    std::size_t numActive_ = 0;
+};
+
+} // end namespace Dumux
+
+#endif
@@ -0,0 +1,506 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*****************************************************************************
+ *   See the file COPYING for full copying permissions.                      *
+ *                                                                           *
+ *   This program is free software: you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by    *
+ *   the Free Software Foundation, either version 3 of the License, or       *
+ *   (at your option) any later version.                                     *
+ *                                                                           *
+ *   This program is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the            *
+ *   GNU General Public License for more details.                            *
+ *                                                                           *
+ *   You should have received a copy of the GNU General Public License       *
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.   *
+ *****************************************************************************/
+/*!
+ * \file
+ * \ingroup PoroElastic
+ * \brief Fixed-stress split solvers for porous medium flow problems coupled to a poro-mechanical problem
+ */
+#ifndef DUMUX_POROELASTIC_FIXED_STRESS_SOLVER_HH
+#define DUMUX_POROELASTIC_FIXED_STRESS_SOLVER_HH
+
+#include <cmath>
+#include <memory>
+#include <string>
+#include <iostream>
+#include <algorithm>
+#include <type_traits>
+
+#include <dune/common/exceptions.hh>
+#include <dune/common/indices.hh>
+#include <dune/istl/operators.hh>
+#include <dune/istl/preconditioners.hh>
+#include <dune/istl/solvers.hh>
+#include <dune/istl/paamg/amg.hh>
+
+#include <dumux/common/properties.hh>
+#include <dumux/common/parameters.hh>
+#include <dumux/common/exceptions.hh>
+#include <dumux/common/typetraits/matrix.hh>
+#include <dumux/discretization/extrusion.hh>
+#include <dumux/linear/solver.hh>
+#include <dumux/nonlinear/newtonsolver.hh>
+
+namespace Dumux {
+
+/*!
+ * \ingroup PoroElastic
+ * \brief Computes the fixed-stress stabilization of the porous medium flow domain
+ *
+ * The fixed-stress split adds the term \f$ \beta (p - p^k)/\Delta t \f$ to the mass balance of the
+ * flow domain, where \f$ p^k \f$ is the pressure of the previous split iteration. For linear poroelasticity,
+ * \f$ \beta = \alpha^2/K_\mathrm{dr} \f$ with the Biot coefficient \f$ \alpha \f$ and the drained bulk modulus
+ * \f$ K_\mathrm{dr} = \lambda + 2\mu/d \f$ (multiplied by the fluid density for mass balances) is a good choice.
+ * This returns the diagonal entries \f$ \beta V_i/\Delta t \f$ of the stabilization matrix
+ * (\f$ \Delta t = 1 \f$ for stationary problems), in the mass balance equation of the pressure degree of freedom.
+ *
+ * \param assembler the multidomain assembler of the poromechanics problem
+ * \param beta the stabilization parameter \f$ \beta \f$
+ */
+template<class Assembler>
+auto computeFixedStressStabilization(const Assembler& assembler, typename Assembler::Scalar beta)
+{
+    static constexpr auto flowId = Assembler::CouplingManager::pmFlowId;
+    using FlowTypeTag = typename Assembler::Traits::template SubDomain<flowId>::TypeTag;
+    using Indices = typename GetPropType<FlowTypeTag, Properties::ModelTraits>::Indices;
+    static_assert(Indices::pressureIdx == Indices::conti0EqIdx,
+                  "The fixed-stress stabilization expects the pressure and the mass balance to have the same index");
+
+    using FlowResidual = std::decay_t<decltype(std::declval<typename Assembler::ResidualType>()[flowId])>;
+    FlowResidual stabilization(assembler.numDofs(flowId));
+    stabilization = 0.0;
+
+    const auto dt = assembler.isStationaryProblem() ? 1.0 : assembler.localResidual(flowId).timeLoop().timeStepSize();
+    const auto& gridGeometry = assembler.gridGeometry(flowId);
+    using Extrusion = Extrusion_t<std::decay_t<decltype(gridGeometry)>>;
+    auto fvGeometry = localView(gridGeometry);
+    for (const auto& element : elements(gridGeometry.gridView()))
+    {
+        fvGeometry.bindElement(element);
+        for (const auto& scv : scvs(fvGeometry))
+            stabilization[scv.dofIndex()][Indices::conti0EqIdx] += beta*Extrusion::volume(scv)/dt;
+    }
+
+    return stabilization;
+}
+
+/*!
+ * \ingroup PoroElastic
+ * \brief A fixed-stress split solver for porous medium flow problems coupled to a poro-mechanical problem
+ *
+ * Instead of solving the monolithic system, the split iterations alternate between the flow domain (with the
+ * mechanical deformation of the last iteration and the fixed-stress stabilization, see computeFixedStressStabilization)
+ * and the poro-mechanical domain (with the new pressure). Each subdomain is solved by Newton's method on its diagonal
+ * Jacobian block only (the coupling blocks are never assembled), such that each subdomain can use its own linear
+ * solver (e.g. AMGBiCGSTABBackend). The iterations stop if the maximum relative shift of the primary variables
+ * between two split iterations is below FixedStress.MaxRelativeShift and (if FixedStress.ResidualReduction is positive)
+ * the flow residual was reduced by FixedStress.ResidualReduction. They fail if the Newton solver of a subdomain
+ * does not converge within FixedStress.SubDomainMaxSteps steps.
+ *
+ * \note Only sequential runs are supported.
+ * \tparam Assembler the multidomain assembler (MultiDomainFVAssembler)
+ * \tparam FlowLinearSolver the linear solver for the flow domain
+ * \tparam PoroMechLinearSolver the linear solver for the poro-mechanical domain
+ * \tparam CouplingManager the coupling manager (PoroMechanicsCouplingManager)
+ */
+template<class Assembler, class FlowLinearSolver, class PoroMechLinearSolver, class CouplingManager>
+class FixedStressSplitSolver
+{
+    using Scalar = typename Assembler::Scalar;
+    using SolutionVector = typename Assembler::SolutionVector;
+    using JacobianMatrix = typename Assembler::JacobianMatrix;
+
+    static constexpr auto flowId = CouplingManager::pmFlowId;
+    static constexpr auto poroMechId = CouplingManager::poroMechId;
+
+    template<std::size_t i>
+    using JacobianBlock = std::decay_t<decltype(std::declval<JacobianMatrix>()[Dune::index_constant<i>()][Dune::index_constant<i>()])>;
+
+    template<std::size_t i>
+    using SubSolutionVector = std::decay_t<decltype(std::declval<SolutionVector>()[Dune::index_constant<i>()])>;
+
+public:
+    /*!
+     * \brief The constructor
+     * \param assembler the multidomain assembler
+     * \param flowLinearSolver the linear solver for the flow domain
+     * \param poroMechLinearSolver the linear solver for the poro-mechanical domain
+     * \param couplingManager the coupling manager
+     * \param paramGroup the parameter group
+     */
+    FixedStressSplitSolver(std::shared_ptr<Assembler> assembler,
+                           std::shared_ptr<FlowLinearSolver> flowLinearSolver,
+                           std::shared_ptr<PoroMechLinearSolver> poroMechLinearSolver,
+                           std::shared_ptr<CouplingManager> couplingManager,
+                           const std::string& paramGroup = "")
+    : assembler_(assembler)
+    , flowLinearSolver_(flowLinearSolver)
+    , poroMechLinearSolver_(poroMechLinearSolver)
+    , couplingManager_(couplingManager)
+    {
+        beta_ = getParamFromGroup<Scalar>(paramGroup, "FixedStress.StabilizationParameter");
+        maxIterations_ = getParamFromGroup<int>(paramGroup, "FixedStress.MaxIterations", 50);
+        maxRelativeShift_ = getParamFromGroup<Scalar>(paramGroup, "FixedStress.MaxRelativeShift", 1e-8);
+        residualReduction_ = getParamFromGroup<Scalar>(paramGroup, "FixedStress.ResidualReduction", -1.0);
+        subDomainMaxSteps_ = getParamFromGroup<int>(paramGroup, "FixedStress.SubDomainMaxSteps", 10);
+        subDomainMaxRelativeShift_ = getParamFromGroup<Scalar>(paramGroup, "FixedStress.SubDomainMaxRelativeShift", 1e-10);
+        verbosity_ = getParamFromGroup<int>(paramGroup, "FixedStress.Verbosity", 1);
+
+        assembler_->setJacobianPattern(flowId, flowJacobian_);
+        assembler_->setJacobianPattern(poroMechId, poroMechJacobian_);
+    }
+
+    /*!
+     * \brief Solve the coupled problem with fixed-stress split iterations
+     * \throws NumericalProblem if the split iterations or the Newton solver of a subdomain did not converge
+     */
+    void solve(SolutionVector& x)
+    {
+        if (!apply(x))
+            DUNE_THROW(NumericalProblem, "The fixed-stress split did not converge in " << numIterations_ << " iterations");
+    }
+
+    /*!
+     * \brief Solve the coupled problem with fixed-stress split iterations
+     * \return whether the split iterations converged (false if the Newton solver of a subdomain did not converge)
+     */
+    bool apply(SolutionVector& x)
+    {
+        const auto stabilization = computeFixedStressStabilization(*assembler_, beta_);
+
+        Scalar initialResidualNorm = 0.0;
+        if (residualReduction_ > 0.0)
+            initialResidualNorm = flowResidualNorm_(x);
+
+        for (numIterations_ = 0; numIterations_ < maxIterations_;)
+        {
+            const auto flowSolLastIter = x[flowId];
+            const auto poroMechSolLastIter = x[poroMechId];
+
+            // the flow domain with the deformation of the last iteration and the fixed-stress stabilization
+            const bool flowConverged = solveSubDomain_(flowId, x, *flowLinearSolver_, flowJacobian_, [&](auto& jac, auto& res)
+            {
+                for (std::size_t i = 0; i < res.size(); ++i)
+                {
+                    for (std::size_t eqIdx = 0; eqIdx < res[i].size(); ++eqIdx)
+                    {
+                        res[i][eqIdx] += stabilization[i][eqIdx]*(x[flowId][i][eqIdx] - flowSolLastIter[i][eqIdx]);
+                        jac[i][i][eqIdx][eqIdx] += stabilization[i][eqIdx];
+                    }
+                }
+            });
+
+            // the poro-mechanical domain with the new pressure
+            const bool poroMechConverged = solveSubDomain_(poroMechId, x, *poroMechLinearSolver_, poroMechJacobian_, [](auto& jac, auto& res) {});
+
+            ++numIterations_;
+            if (!flowConverged || !poroMechConverged)
+            {
+                if (verbosity_ > 0)
+                    std::cout << "Fixed-stress iteration " << numIterations_ << ": the Newton solver of the "
+                              << (flowConverged ? "poro-mechanical" : "flow") << " domain did not converge in "
+                              << subDomainMaxSteps_ << " steps" << std::endl;
+                return false;
+            }
+
+            shift_ = std::max(Detail::maxRelativeShift<Scalar>(x[flowId], flowSolLastIter),
+                              Detail::maxRelativeShift<Scalar>(x[poroMechId], poroMechSolLastIter));
+            bool converged = shift_ < maxRelativeShift_;
+
+            Scalar reduction = 0.0;
+            if (residualReduction_ > 0.0)
+            {
+                reduction = initialResidualNorm > 0.0 ? flowResidualNorm_(x)/initialResidualNorm : 0.0;
+                converged = converged && reduction < residualReduction_;
+            }
+
+            if (verbosity_ > 0)
+            {
+                std::cout << "Fixed-stress iteration " << numIterations_ << ", maximum relative shift = " << shift_;
+                if (residualReduction_ > 0.0)
+                    std::cout << ", flow residual reduction = " << reduction;
+                std::cout << std::endl;
+            }
+
+            if (converged)
+                return true;
+        }
+
+        return false;
+    }
+
+    //! Set the stabilization parameter (default: parameter FixedStress.StabilizationParameter)
+    void setStabilizationParameter(Scalar beta)
+    { beta_ = beta; }
+
+    //! The number of split iterations of the last solve
+    int numIterations() const
+    { return numIterations_; }
+
+    //! The maximum relative shift of the last split iteration
+    Scalar relativeShift() const
+    { return shift_; }
+
+private:
+    /*!
+     * \brief Solve subdomain i with Newton's method on its diagonal Jacobian block
+     * \param stabilize modifies the Jacobian block and the residual after the assembly
+     * \return whether the Newton iterations converged within FixedStress.SubDomainMaxSteps steps
+     */
+    template<std::size_t i, class LinearSolver, class Stabilize>
+    bool solveSubDomain_(Dune::index_constant<i> domainId, SolutionVector& x, LinearSolver& linearSolver,
+                         JacobianBlock<i>& jac, const Stabilize& stabilize)
+    {
+        SubSolutionVector<i> res, deltaX;
+        bool converged = false;
+        for (int step = 0; step < subDomainMaxSteps_; ++step)
+        {
+            couplingManager_->updateSolution(x);
+            assembler_->gridVariables(domainId).update(x[domainId]);
+            assembler_->assembleJacobianAndResidual(domainId, jac, res, x);
+            stabilize(jac, res);
+
+            deltaX.resize(res.size());
+            deltaX = 0.0;
+            if (!linearSolver.solve(jac, deltaX, res))
+                DUNE_THROW(NumericalProblem, "The linear solver of subdomain " << i << " did not converge");
+
+            const auto uLastIter = x[domainId];
+            x[domainId] -= deltaX;
+            if (Detail::maxRelativeShift<Scalar>(x[domainId], uLastIter) < subDomainMaxRelativeShift_)
+            {
+                converged = true;
+                break;
+            }
+        }
+
+        couplingManager_->updateSolution(x);
+        assembler_->gridVariables(domainId).update(x[domainId]);
+        return converged;
+    }
+
+    //! The norm of the (unstabilized) residual of the flow domain
+    Scalar flowResidualNorm_(const SolutionVector& x)
+    {
+        couplingManager_->updateSolution(x);
+        SubSolutionVector<flowId> res;
+        assembler_->assembleResidual(flowId, res, x);
+        return res.two_norm();
+    }
+
+    std::shared_ptr<Assembler> assembler_;
+    std::shared_ptr<FlowLinearSolver> flowLinearSolver_;
+    std::shared_ptr<PoroMechLinearSolver> poroMechLinearSolver_;
+    std::shared_ptr<CouplingManager> couplingManager_;
+
+    JacobianBlock<flowId> flowJacobian_;
+    JacobianBlock<poroMechId> poroMechJacobian_;
+
+    Scalar beta_;
+    int maxIterations_;
+    Scalar maxRelativeShift_;
+    Scalar residualReduction_;
+    int subDomainMaxSteps_;
+    Scalar subDomainMaxRelativeShift_;
+    int verbosity_;
+
+    int numIterations_ = 0;
+    Scalar shift_ = 0.0;
+};
+
+/*!
+ * \ingroup PoroElastic
+ * \brief A fixed-stress preconditioner for the monolithic Jacobian of poromechanics problems
+ *
+ * One application performs a fixed-stress split step on the linear system
+ * \f$ \begin{pmatrix} A_{ff} & A_{fm} \\ A_{mf} & A_{mm} \end{pmatrix} \f$ (flow f, mechanics m):
+ * the flow update is computed with the stabilized flow block \f$ A_{ff} + S \f$
+ * (S is the diagonal fixed-stress stabilization, see computeFixedStressStabilization),
+ * then the mechanics update with the defect corrected by the flow update. Both diagonal blocks
+ * are approximately inverted by one AMG cycle.
+ *
+ * \tparam M the type of the matrix (a 2x2 Dune::MultiTypeBlockMatrix)
+ * \tparam X the type of the update
+ * \tparam Y the type of the defect
+ * \tparam flowIdx the index of the flow domain in the system
+ */
+template<class M, class X, class Y, std::size_t flowIdx = 0>
+class FixedStressPreconditioner : public Dune::Preconditioner<X, Y>
+{
+    static_assert(isMultiTypeBlockMatrix<M>::value && M::N() == 2 && M::M() == 2,
+                  "FixedStressPreconditioner expects a 2x2 MultiTypeBlockMatrix");
+
+    static constexpr std::size_t poroMechIdx = 1 - flowIdx;
+    static constexpr auto flowId = Dune::index_constant<flowIdx>();
+    static constexpr auto poroMechId = Dune::index_constant<poroMechIdx>();
+
+    template<std::size_t i>
+    using DiagBlockType = std::decay_t<decltype(std::declval<M>()[Dune::index_constant<i>()][Dune::index_constant<i>()])>;
+
+    template<std::size_t i>
+    using VecBlockType = std::decay_t<decltype(std::declval<X>()[Dune::index_constant<i>()])>;
+
+    template<std::size_t i>
+    using LinearOperator = Dune::MatrixAdapter<DiagBlockType<i>, VecBlockType<i>, VecBlockType<i>>;
+
+    template<std::size_t i>
+    using Smoother = Dune::SeqSSOR<DiagBlockType<i>, VecBlockType<i>, VecBlockType<i>>;
+
+    template<std::size_t i>
+    using SmootherArgs = typename Dune::Amg::SmootherTraits<Smoother<i>>::Arguments;
+
+    template<std::size_t i>
+    using Criterion = Dune::Amg::CoarsenCriterion<Dune::Amg::SymmetricCriterion<DiagBlockType<i>, Dune::Amg::FirstDiagonal>>;
+
+    template<std::size_t i>
+    using BlockAMG = Dune::Amg::AMG<LinearOperator<i>, VecBlockType<i>, Smoother<i>>;
+
+public:
+    //! \brief The matrix type the preconditioner is for.
+    using matrix_type = M;
+    //! \brief The domain type of the preconditioner.
+    using domain_type = X;
+    //! \brief The range type of the preconditioner.
+    using range_type = Y;
+    //! \brief The field type of the preconditioner.
+    using field_type = typename X::field_type;
+
+    /*!
+     * \brief Constructor
+     * \param m the monolithic matrix
+     * \param stabilization the diagonal of the fixed-stress stabilization of the flow block
+     * \param verbosity the verbosity of the AMG setup
+     */
+    FixedStressPreconditioner(const M& m, const VecBlockType<flowIdx>& stabilization, int verbosity = 0)
+    : matrix_(m)
+    , stabilizedFlowMatrix_(m[flowId][flowId])
+    {
+        for (std::size_t i = 0; i < stabilization.size(); ++i)
+            for (std::size_t eqIdx = 0; eqIdx < stabilization[i].size(); ++eqIdx)
+                stabilizedFlowMatrix_[i][i][eqIdx][eqIdx] += stabilization[i][eqIdx];
+
+        Dune::Amg::Parameters params(15, 2000, 1.2, 1.6, Dune::Amg::atOnceAccu);
+        params.setDefaultValuesIsotropic(3);
+        params.setDebugLevel(verbosity);
+
+        flowOperator_ = std::make_unique<LinearOperator<flowIdx>>(stabilizedFlowMatrix_);
+        poroMechOperator_ = std::make_unique<LinearOperator<poroMechIdx>>(matrix_[poroMechId][poroMechId]);
+        flowAMG_ = makeAMG_<flowIdx>(*flowOperator_, params);
+        poroMechAMG_ = makeAMG_<poroMechIdx>(*poroMechOperator_, params);
+    }
+
+    /*!
+     * \brief Prepare the preconditioner.
+     */
+    void pre(X& v, Y& d) final
+    {
+        flowAMG_->pre(v[flowId], d[flowId]);
+        poroMechAMG_->pre(v[poroMechId], d[poroMechId]);
+    }
+
+    /*!
+     * \brief Apply the preconditioner
+     * \param v The update to be computed (zero on entry)
+     * \param d The current defect
+     */
+    void apply(X& v, const Y& d) final
+    {
+        // the flow update with the fixed-stress stabilization
+        flowAMG_->apply(v[flowId], d[flowId]);
+
+        // the mechanics update for the new pressure
+        auto poroMechDefect = d[poroMechId];
+        matrix_[poroMechId][flowId].mmv(v[flowId], poroMechDefect);
+        poroMechAMG_->apply(v[poroMechId], poroMechDefect);
+    }
+
+    /*!
+     * \brief Clean up.
+     */
+    void post(X& v) final
+    {
+        flowAMG_->post(v[flowId]);
+        poroMechAMG_->post(v[poroMechId]);
+    }
+
+    //! Category of the preconditioner (see SolverCategory::Category)
+    Dune::SolverCategory::Category category() const final
+    {
+        return Dune::SolverCategory::sequential;
+    }
+
+private:
+    template<std::size_t i>
+    static std::unique_ptr<BlockAMG<i>> makeAMG_(const LinearOperator<i>& op, const Dune::Amg::Parameters& params)
+    {
+        Criterion<i> criterion(params);
+        SmootherArgs<i> smootherArgs;
+        smootherArgs.iterations = 1;
+        smootherArgs.relaxationFactor = 1;
+        return std::make_unique<BlockAMG<i>>(op, criterion, smootherArgs);
+    }
+
+    const M& matrix_;
+    DiagBlockType<flowIdx> stabilizedFlowMatrix_;
+    std::unique_ptr<LinearOperator<flowIdx>> flowOperator_;
+    std::unique_ptr<LinearOperator<poroMechIdx>> poroMechOperator_;
+    std::unique_ptr<BlockAMG<flowIdx>> flowAMG_;
+    std::unique_ptr<BlockAMG<poroMechIdx>> poroMechAMG_;
+};
+
+/*!
+ * \ingroup PoroElastic
+ * \brief A BiCGSTAB solver for the monolithic Jacobian of poromechanics problems
+ *        preconditioned with a fixed-stress split step (see FixedStressPreconditioner)
+ * \note The stabilization has to be set (again after changing the time step size) with setStabilization().
+ * \tparam Assembler the multidomain assembler of the poromechanics problem
+ */
+template<class Assembler>
+class FixedStressBiCGSTABBackend : public LinearSolver
+{
+    static constexpr auto flowId = Assembler::CouplingManager::pmFlowId;
+    using Stabilization = std::decay_t<decltype(std::declval<typename Assembler::ResidualType>()[flowId])>;
+
+public:
+    using LinearSolver::LinearSolver;
+
+    //! Set the diagonal of the fixed-stress stabilization (see computeFixedStressStabilization)
+    void setStabilization(const Stabilization& stabilization)
+    { stabilization_ = stabilization; }
+
+    template<class Matrix, class Vector>
+    bool solve(const Matrix& m, Vector& x, const Vector& b)
+    {
+        if (stabilization_.size() != m[flowId][flowId].N())
+            DUNE_THROW(Dune::InvalidStateException, "The fixed-stress stabilization does not match the flow block");
+
+        FixedStressPreconditioner<Matrix, Vector, Vector, flowId> preconditioner(m, stabilization_, this->verbosity());
+
+        Dune::MatrixAdapter<Matrix, Vector, Vector> op(m);
+        Dune::BiCGSTABSolver<Vector> solver(op, preconditioner, this->residReduction(),
+                                            this->maxIter(), this->verbosity());
+        auto bTmp(b);
+        solver.apply(x, bTmp, result_);
+
+        return result_.converged;
+    }
+
+    const Dune::InverseOperatorResult& result() const
+    { return result_; }
+
+    std::string name() const
+    { return "fixed-stress preconditioned BiCGSTAB solver"; }
+
+private:
+    Stabilization stabilization_;
+    Dune::InverseOperatorResult result_;
+};
+
+} // end namespace Dumux
+
+#endif
@@ -442,13 +442,14 @@ private:
             // maybe allocate space for the process rank
             if (addProcessRank) rank.resize(numCells);
 
+            // the local views are reused for all elements
+            auto fvGeometry = localView(gridGeometry());
+            auto elemVolVars = localView(gridVariables_.curGridVolVars());
+            auto elemFluxVarsCache = localView(gridVariables_.gridFluxVarsCache());
             for (const auto& element : elements(gridGeometry().gridView(), Dune::Partitions::interior))
             {
                 const auto eIdxGlobal = gridGeometry().elementMapper().index(element);
 
-                auto fvGeometry = localView(gridGeometry());
-                auto elemVolVars = localView(gridVariables_.curGridVolVars());
-
                 // If velocity output is enabled we need to bind to the whole stencil
                 // otherwise element-local data is sufficient
                 if (velocityOutput_->enableOutput())
@@ -483,7 +484,6 @@ private:
                 // velocity output
                 if (velocityOutput_->enableOutput())
                 {
-                    auto elemFluxVarsCache = localView(gridVariables_.gridFluxVarsCache());
                     elemFluxVarsCache.bind(element, fvGeometry, elemVolVars);
 
                     for (int phaseIdx = 0; phaseIdx < velocityOutput_->numFluidPhases(); ++phaseIdx)
@@ -628,14 +628,15 @@ private:
             // maybe allocate space for the process rank
             if (addProcessRank) rank.resize(numCells);
 
+            // the local views are reused for all elements
+            auto fvGeometry = localView(gridGeometry());
+            auto elemVolVars = localView(gridVariables_.curGridVolVars());
+            auto elemFluxVarsCache = localView(gridVariables_.gridFluxVarsCache());
             for (const auto& element : elements(gridGeometry().gridView(), Dune::Partitions::interior))
             {
                 const auto eIdxGlobal = gridGeometry().elementMapper().index(element);
                 const auto numCorners = element.subEntities(dim);
 
-                auto fvGeometry = localView(gridGeometry());
-                auto elemVolVars = localView(gridVariables_.curGridVolVars());
-
                 // resize element-local data containers
                 for (std::size_t i = 0; i < volVarScalarDataInfo_.size(); ++i)
                     volVarScalarData[i][eIdxGlobal].resize(numCorners);
@@ -675,7 +676,6 @@ private:
                 // velocity output
                 if (velocityOutput_->enableOutput())
                 {
-                    auto elemFluxVarsCache = localView(gridVariables_.gridFluxVarsCache());
                     elemFluxVarsCache.bind(element, fvGeometry, elemVolVars);
 
                     for (int phaseIdx = 0; phaseIdx < velocityOutput_->numFluidPhases(); ++phaseIdx)
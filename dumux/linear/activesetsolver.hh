@@ -0,0 +1,190 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*****************************************************************************
+ *   See the file COPYING for full copying permissions.                      *
+ *                                                                           *
+ *   This program is free software: you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by    *
+ *   the Free Software Foundation, either version 3 of the License, or       *
+ *   (at your option) any later version.                                     *
+ *                                                                           *
+ *   This program is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the            *
+ *   GNU General Public License for more details.                            *
+ *                                                                           *
+ *   You should have received a copy of the GNU General Public License       *
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.   *
+ *****************************************************************************/
+/*!
+ * \file
+ * \ingroup Linear
+ * \brief A linear solver wrapper restricting the linear system to a set of active degrees of freedom
+ */
+#ifndef DUMUX_LINEAR_ACTIVE_SET_SOLVER_HH
+#define DUMUX_LINEAR_ACTIVE_SET_SOLVER_HH
+
+#include <vector>
+#include <memory>
+#include <string>
+#include <limits>
+#include <algorithm>
+
+#include <dune/common/exceptions.hh>
+#include <dune/istl/bcrsmatrix.hh>
+
+#include <dumux/linear/solver.hh>
+
+namespace Dumux {
+
+/*!
+ * \ingroup Linear
+ * \brief A linear solver wrapper restricting the linear system to a set of active degrees of freedom
+ *
+ * The rows and columns of the active degrees of freedom are copied into a smaller system which is
+ * solved with the wrapped solver, the solution of the inactive degrees of freedom is set to zero.
+ * This is exact if the rows of the inactive degrees of freedom are identity rows with zero
+ * right hand side, as assembled by FVAssembler for inactive elements (see FVAssembler::setActiveElements).
+ * The sparsity pattern of the reduced matrix is only rebuilt if the active set changed.
+ *
+ * \note Only sequential solves are supported (the wrapped solver has to be set up sequentially).
+ * \tparam Solver the wrapped linear solver (e.g. IstlSolverFactoryBackend or AMGBiCGSTABBackend)
+ * \tparam Matrix the matrix type of the linear system (a Dune::BCRSMatrix)
+ */
+template<class Solver, class Matrix>
+class ActiveSetLinearSolver : public LinearSolver
+{
+public:
+    /*!
+     * \brief The constructor
+     * \param solver the wrapped linear solver
+     * \param paramGroup the parameter group
+     */
+    explicit ActiveSetLinearSolver(std::shared_ptr<Solver> solver, const std::string& paramGroup = "")
+    : LinearSolver(paramGroup)
+    , solver_(solver)
+    {}
+
+    /*!
+     * \brief Set the active degrees of freedom
+     * \param activeDofs a flag per degree of freedom (may be changed in place), nullptr activates all
+     */
+    void setActiveDofs(std::shared_ptr<const std::vector<bool>> activeDofs)
+    { activeDofs_ = activeDofs; }
+
+    /*!
+     * \brief Solve the linear system Ax = b restricted to the active degrees of freedom
+     */
+    template<class Vector>
+    bool solve(Matrix& A, Vector& x, Vector& b)
+    {
+        if (!activeDofs_ || std::all_of(activeDofs_->begin(), activeDofs_->end(), [](bool a){ return a; }))
+            return solver_->solve(A, x, b);
+
+        if (activeDofs_->size() != A.N())
+            DUNE_THROW(Dune::InvalidStateException, "The active dof flags do not match the size of the linear system");
+
+        if (*activeDofs_ != patternActiveDofs_)
+            buildPattern_(A);
+
+        // copy the entries of the active rows and columns
+        auto& reducedA = *reducedMatrix_;
+        for (std::size_t i = 0; i < activeDofs_->size(); ++i)
+        {
+            if (!(*activeDofs_)[i])
+                continue;
+
+            auto& reducedRow = reducedA[reducedIndex_[i]];
+            const auto end = A[i].end();
+            for (auto it = A[i].begin(); it != end; ++it)
+                if ((*activeDofs_)[it.index()])
+                    reducedRow[reducedIndex_[it.index()]] = *it;
+        }
+
+        Vector reducedX(numActive_), reducedB(numActive_);
+        for (std::size_t i = 0; i < activeDofs_->size(); ++i)
+        {
+            if ((*activeDofs_)[i])
+            {
+                reducedX[reducedIndex_[i]] = x[i];
+                reducedB[reducedIndex_[i]] = b[i];
+            }
+        }
+
+        const bool converged = solver_->solve(reducedA, reducedX, reducedB);
+
+        for (std::size_t i = 0; i < activeDofs_->size(); ++i)
+            x[i] = (*activeDofs_)[i] ? reducedX[reducedIndex_[i]] : 0.0;
+
+        return converged;
+    }
+
+    /*!
+     * \brief Set the residual reduction of the wrapped solver
+     */
+    void setResidualReduction(double r)
+    {
+        LinearSolver::setResidualReduction(r);
+        solver_->setResidualReduction(r);
+    }
+
+    //! The name of the linear solver
+    std::string name() const
+    { return "active set " + solver_->name(); }
+
+    //! The wrapped linear solver
+    Solver& solver()
+    { return *solver_; }
+
+private:
+    void buildPattern_(const Matrix& A)
+    {
+        patternActiveDofs_ = *activeDofs_;
+
+        reducedIndex_.assign(A.N(), std::numeric_limits<std::size_t>::max());
+        numActive_ = 0;
+        for (std::size_t i = 0; i < patternActiveDofs_.size(); ++i)
+            if (patternActiveDofs_[i])
+                reducedIndex_[i] = numActive_++;
+
+        reducedMatrix_ = std::make_unique<Matrix>(numActive_, numActive_, Matrix::random);
+        auto& reducedA = *reducedMatrix_;
+        for (std::size_t i = 0; i < A.N(); ++i)
+        {
+            if (!patternActiveDofs_[i])
+                continue;
+
+            std::size_t rowSize = 0;
+            const auto end = A[i].end();
+            for (auto it = A[i].begin(); it != end; ++it)
+                if (patternActiveDofs_[it.index()])
+                    ++rowSize;
+            reducedA.setrowsize(reducedIndex_[i], rowSize);
+        }
+        reducedA.endrowsizes();
+
+        for (std::size_t i = 0; i < A.N(); ++i)
+        {
+            if (!patternActiveDofs_[i])
+                continue;
+
+            const auto end = A[i].end();
+            for (auto it = A[i].begin(); it != end; ++it)
+                if (patternActiveDofs_[it.index()])
+                    reducedA.addindex(reducedIndex_[i], reducedIndex_[it.index()]);
+        }
+        reducedA.endindices();
+    }
+
+    std::shared_ptr<Solver> solver_;
+    std::shared_ptr<const std::vector<bool>> activeDofs_;
+
+    std::vector<bool> patternActiveDofs_; //!< the active set for which the reduced pattern was built
+    std::vector<std::size_t> reducedIndex_;
+    std::size_t numActive_ = 0;
+    std::unique_ptr<Matrix> reducedMatrix_;
+};
+
+} // end namespace Dumux
+
+#endif
@@ -0,0 +1,155 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*****************************************************************************
+ *   See the file COPYING for full copying permissions.                      *
+ *                                                                           *
+ *   This program is free software: you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by    *
+ *   the Free Software Foundation, either version 3 of the License, or       *
+ *   (at your option) any later version.                                     *
+ *                                                                           *
+ *   This program is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the            *
+ *   GNU General Public License for more details.                            *
+ *                                                                           *
+ *   You should have received a copy of the GNU General Public License       *
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.   *
+ *****************************************************************************/
+/*!
+ * \file
+ * \ingroup Linear
+ * \brief A block diagonal matrix stored as a plain vector of blocks
+ */
+#ifndef DUMUX_LINEAR_BLOCK_DIAGONAL_MATRIX_HH
+#define DUMUX_LINEAR_BLOCK_DIAGONAL_MATRIX_HH
+
+#include <vector>
+#include <cstddef>
+
+#include <dune/common/exceptions.hh>
+#include <dune/common/fmatrix.hh>
+
+#include <dumux/common/exceptions.hh>
+
+namespace Dumux {
+
+/*!
+ * \ingroup Linear
+ * \brief A block diagonal matrix stored as a plain vector of blocks
+ *
+ * The row access mimics a Dune::BCRSMatrix whose sparsity pattern only contains the diagonal,
+ * i.e. A[i][i] is the i-th diagonal block and iterating a row visits the diagonal block only.
+ * Accessing an off-diagonal entry throws. This allows to assemble the Jacobian of explicit
+ * time discretizations (the storage derivatives) without a sparse matrix.
+ *
+ * \tparam Block the block type (a Dune::FieldMatrix)
+ */
+template<class Block>
+class BlockDiagonalMatrix
+{
+public:
+    using block_type = Block;
+    using field_type = typename Block::field_type;
+    using size_type = std::size_t;
+
+    //! An iterator over the (only) entry of a row
+    class RowIterator
+    {
+    public:
+        RowIterator(Block* block, size_type index)
+        : block_(block), index_(index) {}
+
+        Block& operator*() const { return *block_; }
+        Block* operator->() const { return block_; }
+        RowIterator& operator++() { block_ = nullptr; return *this; }
+        bool operator==(const RowIterator& other) const { return block_ == other.block_; }
+        bool operator!=(const RowIterator& other) const { return block_ != other.block_; }
+
+        //! the column index
+        size_type index() const { return index_; }
+
+    private:
+        Block* block_;
+        size_type index_;
+    };
+
+    //! A row of the matrix (containing only the diagonal block)
+    class RowReference
+    {
+    public:
+        RowReference(Block& block, size_type index)
+        : block_(&block), index_(index) {}
+
+        Block& operator[](size_type j) const
+        {
+            if (j != index_)
+                DUNE_THROW(Dune::RangeError, "Off-diagonal entry (" << index_ << ", " << j << ") of a block diagonal matrix");
+            return *block_;
+        }
+
+        RowIterator begin() const { return RowIterator(block_, index_); }
+        RowIterator end() const { return RowIterator(nullptr, index_); }
+        size_type size() const { return 1; }
+
+    private:
+        Block* block_;
+        size_type index_;
+    };
+
+    BlockDiagonalMatrix() = default;
+
+    //! Construct a matrix with n x n blocks
+    explicit BlockDiagonalMatrix(size_type n)
+    : diagonal_(n) {}
+
+    //! Resize the matrix to n x n blocks
+    void resize(size_type n)
+    { diagonal_.resize(n); }
+
+    //! The number of block rows
+    size_type N() const
+    { return diagonal_.size(); }
+
+    //! The number of block columns
+    size_type M() const
+    { return diagonal_.size(); }
+
+    //! The i-th row
+    RowReference operator[](size_type i)
+    { return RowReference(diagonal_[i], i); }
+
+    //! The i-th diagonal block
+    const Block& diagonal(size_type i) const
+    { return diagonal_[i]; }
+
+    //! Set all entries to the given value
+    BlockDiagonalMatrix& operator=(field_type value)
+    {
+        for (auto& block : diagonal_)
+            block = value;
+        return *this;
+    }
+
+    /*!
+     * \brief Solve Ax = b by inverting the diagonal blocks
+     * \throws NumericalProblem if a diagonal block is singular
+     */
+    template<class X, class Y>
+    void solve(X& x, const Y& b) const
+    {
+        for (size_type i = 0; i < diagonal_.size(); ++i)
+        {
+            try { diagonal_[i].solve(x[i], b[i]); }
+            catch (const Dune::FMatrixError& e)
+            { DUNE_THROW(NumericalProblem, "Singular diagonal block " << i << ": " << e.what()); }
+        }
+    }
+
+private:
+    std::vector<Block> diagonal_;
+};
+
+} // end namespace Dumux
+
+#endif
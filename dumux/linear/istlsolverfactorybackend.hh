@@ -44,6 +44,7 @@
 #include <dune/istl/solverfactory.hh>
 
 #include <dumux/common/typetraits/matrix.hh>
+#include <dumux/io/format.hh>
 #include <dumux/linear/solver.hh>
 #include <dumux/linear/parallelhelpers.hh>
 #include <dumux/linear/istlsolverregistry.hh>
@@ -177,6 +178,17 @@ public:
         return result_.converged;
     }
 
+    /*!
+     * \brief Set the linear solver residual reduction
+     * \note This overwrites the reduction set in the input file and is
+     *       used for all following calls to solve (e.g. by an inexact Newton method)
+     */
+    void setResidualReduction(double r)
+    {
+        LinearSolver::setResidualReduction(r);
+        params_["reduction"] = Fmt::format("{}", r);
+    }
+
     const Dune::InverseOperatorResult& result() const
     {
         return result_;
@@ -307,6 +319,11 @@ private:
     std::string name_;
 };
 
+//! The solver factory backend is configured by a parameter tree
+template<class LinearSolverTraits>
+struct linearSolverKeepsConfiguredResidualReduction<IstlSolverFactoryBackend<LinearSolverTraits>>
+: public std::true_type {};
+
 } // end namespace Dumux
 
 #endif
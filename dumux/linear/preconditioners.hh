@@ -36,6 +36,7 @@
 #endif
 
 #include <dumux/common/parameters.hh>
+#include <dumux/common/smallmatrixbatch.hh>
 #include <dumux/common/typetraits/matrix.hh>
 #include <dumux/linear/istlsolverregistry.hh>
 
@@ -333,6 +334,137 @@ private:
 
 DUMUX_REGISTER_PRECONDITIONER("uzawa", Dumux::MultiTypeBlockMatrixPreconditionerTag, Dune::defaultPreconditionerBlockLevelCreator<Dumux::SeqUzawa, 1>());
 
+/*!
+ * \ingroup Linear
+ * \brief A block Jacobi preconditioner for block matrices with small dense blocks
+ *        (e.g. Dune::BCRSMatrix<Dune::FieldMatrix<double, n, n>>)
+ *
+ * Does the same as Dune::SeqJac with block level 1, but the inverses of all diagonal blocks are
+ * computed once at construction with the batched kernels of Dumux::SmallMatrixBatch. Each application
+ * then only requires a (batched) matrix-vector product per block row instead of solving a local system.
+ * Set `LinearSolver.Preconditioner.Type = batchedjac` to use it with the IstlSolverFactoryBackend.
+ *
+ * \tparam M Type of the matrix.
+ * \tparam X Type of the update.
+ * \tparam Y Type of the defect.
+ * \tparam l Preconditioner block level (only block level 1 is supported).
+ */
+template<class M, class X, class Y, int l = 1>
+class SeqBatchedBlockJacobi : public Dune::Preconditioner<X,Y>
+{
+    static_assert(l == 1, "SeqBatchedBlockJacobi expects a block level of 1.");
+
+    using Block = typename M::block_type;
+    static_assert(Block::rows == Block::cols, "SeqBatchedBlockJacobi expects square matrix blocks.");
+    static constexpr int blockSize = Block::rows;
+
+public:
+    //! \brief The matrix type the preconditioner is for.
+    using matrix_type = M;
+    //! \brief The domain type of the preconditioner.
+    using domain_type = X;
+    //! \brief The range type of the preconditioner.
+    using range_type = Y;
+    //! \brief The field type of the preconditioner.
+    using field_type = typename X::field_type;
+    //! \brief Scalar type underlying the field_type.
+    using scalar_field_type = Dune::Simd::Scalar<field_type>;
+
+    /*!
+     * \brief Constructor
+     *
+     * \param mat The matrix to operate on.
+     * \param params Collection of paramters.
+     */
+#if DUNE_VERSION_GTE(DUNE_ISTL,2,8)
+    SeqBatchedBlockJacobi(const std::shared_ptr<const Dune::AssembledLinearOperator<M,X,Y>>& op, const Dune::ParameterTree& params)
+    : SeqBatchedBlockJacobi(op->getmat(), params.get<std::size_t>("iterations", 1), params.get<scalar_field_type>("relaxation", 1.0))
+#else
+    SeqBatchedBlockJacobi(const M& mat, const Dune::ParameterTree& params)
+    : SeqBatchedBlockJacobi(mat, params.get<std::size_t>("iterations", 1), params.get<scalar_field_type>("relaxation", 1.0))
+#endif
+    {}
+
+    /*!
+     * \brief Constructor
+     *
+     * \param mat The matrix to operate on.
+     * \param numIterations The number of Jacobi iterations per application
+     * \param relaxationFactor The relaxation factor
+     */
+    SeqBatchedBlockJacobi(const M& mat, std::size_t numIterations, scalar_field_type relaxationFactor)
+    : matrix_(mat)
+    , numIterations_(numIterations)
+    , relaxationFactor_(relaxationFactor)
+    , inverseDiagonal_(mat.N())
+    , defect_(mat.N())
+    , update_(mat.N())
+    {
+        for (std::size_t i = 0; i < matrix_.N(); ++i)
+        {
+            const auto diag = matrix_[i].find(i);
+            if (diag == matrix_[i].end())
+                DUNE_THROW(Dune::InvalidStateException, "Missing diagonal block in row " << i);
+            inverseDiagonal_.set(i, *diag);
+        }
+
+        inverseDiagonal_.invert();
+    }
+
+    void pre(X& x, Y& b) override {}
+
+    /*!
+     * \brief Apply the preconditioner
+     *
+     * \param update The update to be computed.
+     * \param currentDefect The current defect.
+     */
+    void apply(X& update, const Y& currentDefect) override
+    {
+        for (std::size_t k = 0; k < numIterations_; ++k)
+        {
+            // the defect with respect to the current update (directly in the batch layout)
+            for (auto row = matrix_.begin(); row != matrix_.end(); ++row)
+            {
+                const auto i = row.index();
+                for (int r = 0; r < blockSize; ++r)
+                    defect_(i, r) = currentDefect[i][r];
+
+                for (auto col = row->begin(); col != row->end(); ++col)
+                {
+                    const auto& block = *col;
+                    const auto& u = update[col.index()];
+                    for (int r = 0; r < blockSize; ++r)
+                        for (int c = 0; c < blockSize; ++c)
+                            defect_(i, r) -= block[r][c]*u[c];
+                }
+            }
+
+            // update += omega*D^-1*defect
+            inverseDiagonal_.mv(defect_, update_);
+            for (std::size_t i = 0; i < update.size(); ++i)
+                for (int j = 0; j < blockSize; ++j)
+                    update[i][j] += relaxationFactor_*update_(i, j);
+        }
+    }
+
+    void post(X& x) override {}
+
+    //! Category of the preconditioner (see SolverCategory::Category)
+    Dune::SolverCategory::Category category() const override
+    { return Dune::SolverCategory::sequential; }
+
+private:
+    const M& matrix_;
+    const std::size_t numIterations_;
+    const scalar_field_type relaxationFactor_;
+    SmallMatrixBatch<scalar_field_type, blockSize> inverseDiagonal_;
+    SmallVectorBatch<scalar_field_type, blockSize> defect_;
+    SmallVectorBatch<scalar_field_type, blockSize> update_;
+};
+
+DUMUX_REGISTER_PRECONDITIONER("batchedjac", Dune::PreconditionerTag, Dune::defaultPreconditionerBlockLevelCreator<Dumux::SeqBatchedBlockJacobi, 1>());
+
 } // end namespace Dumux
 
 #endif
@@ -39,6 +39,7 @@
 #include <dumux/common/parameters.hh>
 #include <dumux/common/typetraits/matrix.hh>
 #include <dumux/common/typetraits/utility.hh>
+#include <dumux/io/format.hh>
 #include <dumux/linear/solver.hh>
 #include <dumux/linear/amgbackend.hh>
 #include <dumux/linear/preconditioners.hh>
@@ -952,15 +953,41 @@ public:
         using Preconditioner = SeqUzawa<Matrix, Vector, Vector>;
         using Solver = Dune::BiCGSTABSolver<Vector>;
         static const auto solverParams = LinearSolverParameters<LinearSolverTraits>::createParameterTree(this->paramGroup());
-        return IterativePreconditionedSolverImpl::template solveWithParamTree<Preconditioner, Solver>(A, x, b, solverParams);
+
+        // use the residual reduction set by the nonlinear solver (e.g. an inexact Newton method)
+        if (!residualReductionSet_)
+            return IterativePreconditionedSolverImpl::template solveWithParamTree<Preconditioner, Solver>(A, x, b, solverParams);
+
+        auto params = solverParams;
+        params["reduction"] = Fmt::format("{}", this->residReduction());
+        return IterativePreconditionedSolverImpl::template solveWithParamTree<Preconditioner, Solver>(A, x, b, params);
+    }
+
+    /*!
+     * \brief Set the linear solver residual reduction
+     * \note This overwrites the reduction set in the input file and is
+     *       used for all following calls to solve (e.g. by an inexact Newton method)
+     */
+    void setResidualReduction(double r)
+    {
+        LinearSolver::setResidualReduction(r);
+        residualReductionSet_ = true;
     }
 
     std::string name() const
     {
         return "Uzawa preconditioned BiCGSTAB solver";
     }
+
+private:
+    bool residualReductionSet_ = false;
 };
 
+//! The Uzawa backend uses the reduction of its parameter tree unless it is set explicitly
+template<class LinearSolverTraits>
+struct linearSolverKeepsConfiguredResidualReduction<UzawaBiCGSTABBackend<LinearSolverTraits>>
+: public std::true_type {};
+
 /*!
  * \ingroup Linear
  * \brief A simple ilu0 block diagonal preconditioner
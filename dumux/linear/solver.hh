@@ -24,6 +24,8 @@
 #ifndef DUMUX_LINEAR_SOLVER_HH
 #define DUMUX_LINEAR_SOLVER_HH
 
+#include <type_traits>
+
 #include <dune/common/exceptions.hh>
 #include <dumux/common/parameters.hh>
 
@@ -99,7 +101,11 @@ public:
     double residReduction() const
     { return residReduction_; }
 
-    //! set the linear solver residual reduction
+    /*!
+     * \brief set the linear solver residual reduction
+     * \note Solver backends have to use the current value in each call to solve,
+     *       such that e.g. an inexact Newton method can adapt it for each linear system
+     */
     void setResidualReduction(double r)
     { residReduction_ = r; }
 
@@ -137,6 +143,16 @@ private:
     const std::string paramGroup_;
 };
 
+/*!
+ * \ingroup Linear
+ * \brief Trait stating if a linear solver backend keeps the residual reduction it was configured with
+ *        (e.g. from a parameter tree) instead of the default the nonlinear solver sets on construction
+ * \note The nonlinear solver may still adapt the residual reduction during a solve (inexact Newton)
+ *       but restores the configured value (LinearSolver::residReduction()) afterwards.
+ */
+template<class LinearSolver>
+struct linearSolverKeepsConfiguredResidualReduction : public std::false_type {};
+
 } // end namespace Dumux
 
 #endif
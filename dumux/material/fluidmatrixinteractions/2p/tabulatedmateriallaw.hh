@@ -0,0 +1,446 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*****************************************************************************
+ *   See the file COPYING for full copying permissions.                      *
+ *                                                                           *
+ *   This program is free software: you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by    *
+ *   the Free Software Foundation, either version 3 of the License, or       *
+ *   (at your option) any later version.                                     *
+ *                                                                           *
+ *   This program is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the            *
+ *   GNU General Public License for more details.                            *
+ *                                                                           *
+ *   You should have received a copy of the GNU General Public License       *
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.   *
+ *****************************************************************************/
+/*!
+ * \file
+ * \ingroup Fluidmatrixinteractions
+ * \brief A tabulated approximation wrapper for 2p material laws
+ *        with tables shared between laws with equal parameters
+ */
+#ifndef DUMUX_MATERIAL_FLUIDMATRIX_TWOP_TABULATED_MATERIAL_LAW_HH
+#define DUMUX_MATERIAL_FLUIDMATRIX_TWOP_TABULATED_MATERIAL_LAW_HH
+
+#include <array>
+#include <mutex>
+#include <memory>
+#include <vector>
+#include <string>
+#include <cassert>
+#include <algorithm>
+
+#include <dune/common/exceptions.hh>
+
+#include <dumux/common/math.hh>
+#include <dumux/common/span.hh>
+#include <dumux/common/parameters.hh>
+#include <dumux/common/monotonecubicspline.hh>
+#include <dumux/material/fluidmatrixinteractions/fluidmatrixinteraction.hh>
+
+namespace Dumux::FluidMatrix {
+
+/*!
+ * \ingroup Fluidmatrixinteractions
+ * \brief Tables of the capillary pressure and relative permeability curves of a 2p material law
+ *        sampled at equidistant wetting saturations
+ *
+ * The curves are approximated by monotone cubic splines (see MonotoneCubicSpline) through the samples.
+ * The coefficients of the cubic polynomial of each interval are stored consecutively, such that
+ * the evaluation only requires the computation of the interval index (no search), one load of
+ * four coefficients and a Horner scheme. The evaluation does not branch and loops over many
+ * saturations (see eval(int, Span<const Scalar>, Span<Scalar>)) can be vectorized by the compiler.
+ * Saturations outside of the table interval are extrapolated with the polynomial of the first/last interval.
+ */
+template<class Scalar>
+class TwoPMaterialLawTable
+{
+public:
+    //! the tabulated curves
+    enum Curve { pcCurve = 0, krwCurve = 1, krnCurve = 2 };
+    static constexpr int numCurves = 3;
+
+    /*!
+     * \brief Tabulate the curves of a material law
+     * \param law the material law
+     * \param swInterval the wetting saturation interval [swMin, swMax] of the table
+     * \param numSwSamples the number of samples (equidistant in sw)
+     */
+    template<class TwoPMaterialLaw>
+    TwoPMaterialLawTable(const TwoPMaterialLaw& law, const std::array<Scalar, 2>& swInterval, std::size_t numSwSamples)
+    : swMin_(swInterval[0])
+    , swMax_(swInterval[1])
+    , numIntervals_(numSwSamples-1)
+    {
+        if (numSwSamples < 2 || !(swMax_ > swMin_))
+            DUNE_THROW(Dune::InvalidStateException, "Invalid table specification: " << numSwSamples << " samples"
+                                                        << " in the interval [" << swMin_ << ", " << swMax_ << "]");
+
+        h_ = (swMax_ - swMin_)/numIntervals_;
+        invH_ = 1.0/h_;
+
+        const auto sw = linspace(swMin_, swMax_, numSwSamples);
+        tabulate_(pcCurve, sw, [&](const Scalar s){ return law.pc(s); });
+        tabulate_(krwCurve, sw, [&](const Scalar s){ return law.krw(s); });
+        tabulate_(krnCurve, sw, [&](const Scalar s){ return law.krn(s); });
+    }
+
+    //! whether the saturation is inside of the table interval
+    bool contains(const Scalar sw) const
+    { return sw > swMin_ && sw < swMax_; }
+
+    //! the wetting saturation interval of the table
+    std::array<Scalar, 2> swInterval() const
+    { return {{ swMin_, swMax_ }}; }
+
+    //! the number of samples
+    std::size_t numSwSamples() const
+    { return numIntervals_ + 1; }
+
+    //! evaluate a curve
+    Scalar eval(const int curve, const Scalar sw) const
+    {
+        Scalar t;
+        const Scalar* c = coefficients_(curve, sw, t);
+        return ((c[3]*t + c[2])*t + c[1])*t + c[0];
+    }
+
+    //! evaluate the derivative of a curve w.r.t. the wetting saturation
+    Scalar evalDerivative(const int curve, const Scalar sw) const
+    {
+        Scalar t;
+        const Scalar* c = coefficients_(curve, sw, t);
+        return ((3.0*c[3]*t + 2.0*c[2])*t + c[1])*invH_;
+    }
+
+    //! evaluate a curve for many saturations
+    void eval(const int curve, Span<const Scalar> sw, Span<Scalar> values) const
+    {
+        assert(sw.size() == values.size());
+        const auto n = sw.size();
+        for (std::size_t i = 0; i < n; ++i)
+            values[i] = eval(curve, sw[i]);
+    }
+
+    //! evaluate the derivative of a curve w.r.t. the wetting saturation for many saturations
+    void evalDerivative(const int curve, Span<const Scalar> sw, Span<Scalar> values) const
+    {
+        assert(sw.size() == values.size());
+        const auto n = sw.size();
+        for (std::size_t i = 0; i < n; ++i)
+            values[i] = evalDerivative(curve, sw[i]);
+    }
+
+private:
+    //! the coefficients of the interval containing sw and the local coordinate t in [0, 1] (extrapolated outside)
+    const Scalar* coefficients_(const int curve, const Scalar sw, Scalar& t) const
+    {
+        using std::min; using std::max;
+        const Scalar x = (sw - swMin_)*invH_;
+        const std::size_t i = static_cast<std::size_t>(min(max(x, Scalar(0.0)), Scalar(numIntervals_-1)));
+        t = x - i;
+        return coeffs_[curve].data() + 4*i;
+    }
+
+    template<class Function>
+    void tabulate_(const int curve, const std::vector<Scalar>& sw, const Function& f)
+    {
+        auto values = sw;
+        std::transform(sw.begin(), sw.end(), values.begin(), f);
+        const MonotoneCubicSpline<Scalar> spline(sw, values);
+
+        // convert the Hermite form (values and slopes at the samples) to polynomials in t = (sw - sw_i)/h
+        auto& c = coeffs_[curve];
+        c.resize(4*numIntervals_);
+        for (std::size_t i = 0; i < numIntervals_; ++i)
+        {
+            const Scalar y0 = values[i], y1 = values[i+1];
+            const Scalar m0 = spline.evalDerivative(sw[i])*h_;
+            const Scalar m1 = spline.evalDerivative(sw[i+1])*h_;
+            c[4*i + 0] = y0;
+            c[4*i + 1] = m0;
+            c[4*i + 2] = 3.0*(y1 - y0) - 2.0*m0 - m1;
+            c[4*i + 3] = 2.0*(y0 - y1) + m0 + m1;
+        }
+    }
+
+    Scalar swMin_, swMax_;
+    Scalar h_, invH_;
+    std::size_t numIntervals_;
+    std::array<std::vector<Scalar>, numCurves> coeffs_;
+};
+
+/*!
+ * \ingroup Fluidmatrixinteractions
+ * \brief A cache of the tables of 2p material laws of a given type
+ *
+ * Laws comparing equal (i.e. with equal parameters) and with the same table specification
+ * share a table, such that spatial parameters with many (possibly repeated) parameter sets
+ * only compute and store each table once. The tables are released when no law uses them anymore.
+ * \note The lookup compares the parameters with all cached tables, it is meant to be used on construction of the laws.
+ * \note The cache is thread-safe.
+ */
+template<class TwoPMaterialLaw>
+class TwoPMaterialLawTableCache
+{
+    using Scalar = typename TwoPMaterialLaw::Scalar;
+
+    struct Entry
+    {
+        TwoPMaterialLaw law;
+        std::array<Scalar, 2> swInterval;
+        std::size_t numSwSamples;
+        std::weak_ptr<const TwoPMaterialLawTable<Scalar>> table;
+    };
+
+public:
+    using Table = TwoPMaterialLawTable<Scalar>;
+
+    /*!
+     * \brief Get the table of a law (computes the table if there is none yet)
+     * \param law the material law
+     * \param swInterval the wetting saturation interval [swMin, swMax] of the table
+     * \param numSwSamples the number of samples (equidistant in sw)
+     */
+    static std::shared_ptr<const Table> table(const TwoPMaterialLaw& law, const std::array<Scalar, 2>& swInterval, std::size_t numSwSamples)
+    {
+        static std::mutex mutex;
+        static std::vector<Entry> entries;
+
+        std::lock_guard<std::mutex> lock(mutex);
+        entries.erase(std::remove_if(entries.begin(), entries.end(), [](const auto& e){ return e.table.expired(); }), entries.end());
+
+        for (const auto& e : entries)
+            if (e.numSwSamples == numSwSamples && e.swInterval == swInterval && e.law == law)
+                if (auto table = e.table.lock())
+                    return table;
+
+        auto table = std::make_shared<const Table>(law, swInterval, numSwSamples);
+        entries.push_back(Entry{law, swInterval, numSwSamples, table});
+        return table;
+    }
+};
+
+/*!
+ * \ingroup Fluidmatrixinteractions
+ * \brief A tabulated approximation wrapper for 2p material laws (e.g. van Genuchten, Brooks-Corey)
+ *
+ * Similar to SplineTwoPMaterialLaw, pc(sw), krw(sw), krn(sw) and their derivatives are approximated
+ * by monotone cubic splines in a saturation interval and evaluated with the wrapped law outside of it.
+ * In contrast, the samples are equidistant such that an evaluation is a branch-free table lookup
+ * (see TwoPMaterialLawTable), the law can evaluate many saturations at once, and the tables are shared
+ * between all laws with equal parameters (see TwoPMaterialLawTableCache) which makes the law cheap to copy.
+ * The saturation-capillary pressure curve sw(pc) and its derivative are evaluated with the wrapped law.
+ *
+ * The table is specified by the parameters `TabulationSweInterval` (effective wetting saturation interval,
+ * default: 0.01 1.0) and `TabulationNumSwSamples` (default: 1000).
+ *
+ * \tparam TwoPMaterialLaw the type of material law to be wrapped
+ */
+template<class TwoPMaterialLaw>
+class TabulatedTwoPMaterialLaw
+: public TwoPMaterialLaw
+, public Adapter<TabulatedTwoPMaterialLaw<TwoPMaterialLaw>, PcKrSw>
+{
+    using Table = TwoPMaterialLawTable<typename TwoPMaterialLaw::Scalar>;
+    using Cache = TwoPMaterialLawTableCache<TwoPMaterialLaw>;
+
+public:
+    using Scalar = typename TwoPMaterialLaw::Scalar;
+
+    using BasicParams = typename TwoPMaterialLaw::BasicParams;
+    using EffToAbsParams = typename TwoPMaterialLaw::EffToAbsParams;
+    using RegularizationParams = typename TwoPMaterialLaw::RegularizationParams;
+
+    /*!
+     * \brief Return the number of fluid phases
+     */
+    static constexpr int numFluidPhases()
+    { return 2; }
+
+    /*!
+     * \brief Return whether the wrapped law is regularized
+     */
+    static constexpr bool isRegularized()
+    { return TwoPMaterialLaw::isRegularized(); }
+
+    /*!
+     * \brief Deleted default constructor (so we are never in an undefined state)
+     * \note store owning pointers to laws instead if you need default-constructible objects
+     */
+    TabulatedTwoPMaterialLaw() = delete;
+
+    /*!
+     * \brief Construct from a subgroup from the global parameter tree
+     * \note This will give you nice error messages if a mandatory parameter is missing
+     */
+    explicit TabulatedTwoPMaterialLaw(const std::string& paramGroup)
+    : TwoPMaterialLaw(paramGroup)
+    {
+        const std::array<Scalar, 2> defaultInterval{{ 0.01, 1.0 }};
+        const auto sweInterval = getParamFromGroup<std::array<Scalar, 2>>(paramGroup, "TabulationSweInterval", defaultInterval);
+        const auto numSwSamples = getParamFromGroup<std::size_t>(paramGroup, "TabulationNumSwSamples", 1000);
+        makeTable_(sweInterval, numSwSamples);
+    }
+
+    /*!
+     * \brief Construct from the wrapped law and the table specification
+     * \param sweInterval the effective wetting saturation interval of the table
+     * \param numSwSamples the number of samples
+     * \param twoP the wrapped law
+     */
+    TabulatedTwoPMaterialLaw(const std::array<Scalar, 2>& sweInterval,
+                             std::size_t numSwSamples,
+                             TwoPMaterialLaw&& twoP)
+    : TwoPMaterialLaw(std::move(twoP))
+    {
+        makeTable_(sweInterval, numSwSamples);
+    }
+
+    /*!
+     * \brief The capillary pressure-saturation curve
+     */
+    Scalar pc(const Scalar sw) const
+    {
+        if (table_->contains(sw))
+            return table_->eval(Table::pcCurve, sw);
+
+        return TwoPMaterialLaw::pc(sw);
+    }
+
+    /*!
+     * \brief The partial derivative of the capillary pressure w.r.t. the saturation
+     */
+    Scalar dpc_dsw(const Scalar sw) const
+    {
+        if (table_->contains(sw))
+            return table_->evalDerivative(Table::pcCurve, sw);
+
+        return TwoPMaterialLaw::dpc_dsw(sw);
+    }
+
+    /*!
+     * \brief The relative permeability for the wetting phase
+     */
+    Scalar krw(const Scalar sw) const
+    {
+        if (table_->contains(sw))
+            return table_->eval(Table::krwCurve, sw);
+
+        return TwoPMaterialLaw::krw(sw);
+    }
+
+    /*!
+     * \brief The derivative of the relative permeability for the wetting phase w.r.t. saturation
+     */
+    Scalar dkrw_dsw(const Scalar sw) const
+    {
+        if (table_->contains(sw))
+            return table_->evalDerivative(Table::krwCurve, sw);
+
+        return TwoPMaterialLaw::dkrw_dsw(sw);
+    }
+
+    /*!
+     * \brief The relative permeability for the non-wetting phase
+     */
+    Scalar krn(const Scalar sw) const
+    {
+        if (table_->contains(sw))
+            return table_->eval(Table::krnCurve, sw);
+
+        return TwoPMaterialLaw::krn(sw);
+    }
+
+    /*!
+     * \brief The derivative of the relative permeability for the non-wetting phase w.r.t. saturation
+     */
+    Scalar dkrn_dsw(const Scalar sw) const
+    {
+        if (table_->contains(sw))
+            return table_->evalDerivative(Table::krnCurve, sw);
+
+        return TwoPMaterialLaw::dkrn_dsw(sw);
+    }
+
+    /*!
+     * \brief The capillary pressure for many saturations
+     */
+    void pc(Span<const Scalar> sw, Span<Scalar> pc) const
+    { evalMany_(Table::pcCurve, sw, pc, [&](const Scalar s){ return TwoPMaterialLaw::pc(s); }); }
+
+    /*!
+     * \brief The partial derivative of the capillary pressure w.r.t. the saturation for many saturations
+     */
+    void dpc_dsw(Span<const Scalar> sw, Span<Scalar> dpc_dsw) const
+    { evalManyDerivatives_(Table::pcCurve, sw, dpc_dsw, [&](const Scalar s){ return TwoPMaterialLaw::dpc_dsw(s); }); }
+
+    /*!
+     * \brief The relative permeability for the wetting phase for many saturations
+     */
+    void krw(Span<const Scalar> sw, Span<Scalar> krw) const
+    { evalMany_(Table::krwCurve, sw, krw, [&](const Scalar s){ return TwoPMaterialLaw::krw(s); }); }
+
+    /*!
+     * \brief The derivative of the relative permeability for the wetting phase w.r.t. saturation for many saturations
+     */
+    void dkrw_dsw(Span<const Scalar> sw, Span<Scalar> dkrw_dsw) const
+    { evalManyDerivatives_(Table::krwCurve, sw, dkrw_dsw, [&](const Scalar s){ return TwoPMaterialLaw::dkrw_dsw(s); }); }
+
+    /*!
+     * \brief The relative permeability for the non-wetting phase for many saturations
+     */
+    void krn(Span<const Scalar> sw, Span<Scalar> krn) const
+    { evalMany_(Table::krnCurve, sw, krn, [&](const Scalar s){ return TwoPMaterialLaw::krn(s); }); }
+
+    /*!
+     * \brief The derivative of the relative permeability for the non-wetting phase w.r.t. saturation for many saturations
+     */
+    void dkrn_dsw(Span<const Scalar> sw, Span<Scalar> dkrn_dsw) const
+    { evalManyDerivatives_(Table::krnCurve, sw, dkrn_dsw, [&](const Scalar s){ return TwoPMaterialLaw::dkrn_dsw(s); }); }
+
+    /*!
+     * \brief The table (shared by all laws with equal parameters)
+     */
+    const Table& table() const
+    { return *table_; }
+
+private:
+    void makeTable_(const std::array<Scalar, 2>& sweInterval, std::size_t numSwSamples)
+    {
+        using EffToAbs = typename TwoPMaterialLaw::EffToAbs;
+        const std::array<Scalar, 2> swInterval{{ EffToAbs::sweToSw(sweInterval[0], this->effToAbsParams()),
+                                                 EffToAbs::sweToSw(sweInterval[1], this->effToAbsParams()) }};
+
+        const TwoPMaterialLaw& law = *this;
+        table_ = Cache::table(law, swInterval, numSwSamples);
+    }
+
+    // evaluate the table for all saturations (vectorizable) and the law outside of the table interval
+    template<class Function>
+    void evalMany_(int curve, Span<const Scalar> sw, Span<Scalar> values, const Function& f) const
+    {
+        table_->eval(curve, sw, values);
+        for (std::size_t i = 0; i < sw.size(); ++i)
+            if (!table_->contains(sw[i]))
+                values[i] = f(sw[i]);
+    }
+
+    template<class Function>
+    void evalManyDerivatives_(int curve, Span<const Scalar> sw, Span<Scalar> values, const Function& f) const
+    {
+        table_->evalDerivative(curve, sw, values);
+        for (std::size_t i = 0; i < sw.size(); ++i)
+            if (!table_->contains(sw[i]))
+                values[i] = f(sw[i]);
+    }
+
+    std::shared_ptr<const Table> table_;
+};
+
+} // end namespace Dumux::FluidMatrix
+
+#endif
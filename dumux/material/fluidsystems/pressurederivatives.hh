@@ -0,0 +1,101 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*****************************************************************************
+ *   See the file COPYING for full copying permissions.                      *
+ *                                                                           *
+ *   This program is free software: you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by    *
+ *   the Free Software Foundation, either version 3 of the License, or       *
+ *   (at your option) any later version.                                     *
+ *                                                                           *
+ *   This program is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the            *
+ *   GNU General Public License for more details.                            *
+ *                                                                           *
+ *   You should have received a copy of the GNU General Public License       *
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.   *
+ *****************************************************************************/
+/*!
+ * \file
+ * \ingroup Fluidsystems
+ * \brief Derivatives of the phase densities and viscosities with respect to the phase pressure
+ */
+#ifndef DUMUX_MATERIAL_FLUIDSYSTEMS_PRESSURE_DERIVATIVES_HH
+#define DUMUX_MATERIAL_FLUIDSYSTEMS_PRESSURE_DERIVATIVES_HH
+
+#include <cmath>
+#include <algorithm>
+
+namespace Dumux {
+
+#ifndef DOXYGEN
+namespace Detail {
+
+// forward difference of a fluid system property w.r.t. the pressure of a phase
+template<class FluidSystem, class FluidState, class Function>
+typename FluidState::Scalar pressureDerivative(const FluidState& fluidState, int phaseIdx,
+                                               typename FluidState::Scalar value, const Function& f)
+{
+    using Scalar = typename FluidState::Scalar;
+    using std::abs; using std::max;
+
+    auto fs = fluidState;
+    const Scalar p = fluidState.pressure(phaseIdx);
+    const Scalar eps = 1e-8*max<Scalar>(abs(p), 1.0);
+    fs.setPressure(phaseIdx, p + eps);
+
+    typename FluidSystem::ParameterCache paramCache;
+    paramCache.updatePhase(fs, phaseIdx);
+    return (f(fs, paramCache, phaseIdx) - value)/eps;
+}
+
+} // end namespace Detail
+#endif // DOXYGEN
+
+/*!
+ * \ingroup Fluidsystems
+ * \brief The derivative of the density of a phase w.r.t. its pressure
+ *        (at constant temperature and composition) in \f$\mathrm{[kg/(m^3 Pa)]}\f$
+ *
+ * The fluid systems do not provide derivatives, so the derivative is approximated by a forward
+ * difference of FluidSystem::density. This only requires one additional evaluation of the fluid
+ * system. For incompressible phases, zero is returned without evaluating the fluid system.
+ *
+ * \param fluidState a fluid state holding the current density of the phase
+ * \param phaseIdx the phase index
+ */
+template<class FluidSystem, class FluidState>
+typename FluidState::Scalar densityPressureDerivative(const FluidState& fluidState, int phaseIdx)
+{
+    if (!FluidSystem::isCompressible(phaseIdx))
+        return 0.0;
+
+    return Detail::pressureDerivative<FluidSystem>(fluidState, phaseIdx, fluidState.density(phaseIdx),
+        [](const auto& fs, const auto& paramCache, int phaseIdx){ return FluidSystem::density(fs, paramCache, phaseIdx); });
+}
+
+/*!
+ * \ingroup Fluidsystems
+ * \brief The derivative of the viscosity of a phase w.r.t. its pressure
+ *        (at constant temperature and composition) in \f$\mathrm{[s]}\f$
+ *
+ * Approximated by a forward difference of FluidSystem::viscosity (see densityPressureDerivative).
+ * For phases with constant viscosity, zero is returned without evaluating the fluid system.
+ *
+ * \param fluidState a fluid state holding the current viscosity of the phase
+ * \param phaseIdx the phase index
+ */
+template<class FluidSystem, class FluidState>
+typename FluidState::Scalar viscosityPressureDerivative(const FluidState& fluidState, int phaseIdx)
+{
+    if (FluidSystem::viscosityIsConstant(phaseIdx))
+        return 0.0;
+
+    return Detail::pressureDerivative<FluidSystem>(fluidState, phaseIdx, fluidState.viscosity(phaseIdx),
+        [](const auto& fs, const auto& paramCache, int phaseIdx){ return FluidSystem::viscosity(fs, paramCache, phaseIdx); });
+}
+
+} // end namespace Dumux
+
+#endif
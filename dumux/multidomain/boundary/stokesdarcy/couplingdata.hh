@@ -25,6 +25,7 @@
 #ifndef DUMUX_STOKES_DARCY_COUPLINGDATA_HH
 #define DUMUX_STOKES_DARCY_COUPLINGDATA_HH
 
+#include <array>
 #include <numeric>
 
 #include <dumux/common/properties.hh>
@@ -376,6 +377,20 @@ protected:
                             : avgQuantityJ / totalDistance;
     }
 
+    /*!
+     * \brief Returns the distances of the inside and the outside cell center to a coupled scvf.
+     *        These are precomputed by the coupling manager.
+     */
+    template<std::size_t i>
+    const std::array<Scalar, 2>& couplingDistances_(Dune::index_constant<i> domainI, const SubControlVolumeFace<i>& scvfI) const
+    {
+        const auto& face = couplingManager_.couplingFace(domainI, scvfI);
+        if constexpr (i == darcyIdx)
+            return face.darcyDistances;
+        else
+            return face.stokesDistances;
+    }
+
     /*!
      * \brief Returns the distance between an scvf and the corresponding scv center.
      */
@@ -400,8 +415,9 @@ protected:
                                  const VolumeVariables<j>& volVarsJ,
                                  const DiffusionCoefficientAveragingType diffCoeffAvgType) const
     {
-        const Scalar insideDistance = getDistance_(scvI, scvfI);
-        const Scalar outsideDistance = getDistance_(scvJ, scvfI);
+        const auto& distances = couplingDistances_(domainI, scvfI);
+        const Scalar insideDistance = distances[0];
+        const Scalar outsideDistance = distances[1];
 
         const Scalar deltaT = volVarsJ.temperature() - volVarsI.temperature();
         const Scalar tij = transmissibility_(domainI,
@@ -427,18 +443,20 @@ protected:
         GlobalPosition<stokesIdx> velocity(0.0);
         velocity[scvf.directionIndex()] = elemFaceVars[scvf].velocitySelf();
         const auto& darcyScvf = context.fvGeometry.scvf(context.darcyScvfIdx);
-        return computeCouplingPhasePressureAtInterface_(context.element, context.fvGeometry, darcyScvf, context.volVars, velocity, AdvectionType());
+        const auto& faceVars = couplingManager_.couplingFaceVariables(context.couplingFaceIdx);
+        return computeCouplingPhasePressureAtInterface_(darcyScvf, context.volVars, faceVars, velocity, AdvectionType());
     }
 
     /*!
      * \brief Returns the pressure at the interface using Forchheimers's law for reconstruction
+     * \note The transmissibility and the gravity projection are precomputed by the coupling manager.
      */
-     Scalar computeCouplingPhasePressureAtInterface_(const Element<darcyIdx>& element,
-                                                     const FVElementGeometry<darcyIdx>& fvGeometry,
-                                                     const SubControlVolumeFace<darcyIdx>& scvf,
-                                                     const VolumeVariables<darcyIdx>& volVars,
-                                                     const typename Element<stokesIdx>::Geometry::GlobalCoordinate& couplingPhaseVelocity,
-                                                     ForchheimersLaw) const
+    template<class CouplingFaceVariables>
+    Scalar computeCouplingPhasePressureAtInterface_(const SubControlVolumeFace<darcyIdx>& scvf,
+                                                    const VolumeVariables<darcyIdx>& volVars,
+                                                    const CouplingFaceVariables& faceVars,
+                                                    const typename Element<stokesIdx>::Geometry::GlobalCoordinate& couplingPhaseVelocity,
+                                                    ForchheimersLaw) const
     {
         const auto darcyPhaseIdx = couplingPhaseIdx(darcyIdx);
         const Scalar cellCenterPressure = volVars.pressure(darcyPhaseIdx);
@@ -452,27 +470,26 @@ protected:
         const Scalar mu = volVars.viscosity(darcyPhaseIdx);
         const Scalar rho = volVars.density(darcyPhaseIdx);
         const auto K = volVars.permeability();
-        const auto alpha = vtmv(scvf.unitOuterNormal(), K, couplingManager_.problem(darcyIdx).spatialParams().gravity(scvf.center()));
-
-        const auto& insideScv = fvGeometry.scv(scvf.insideScvIdx());
-        const auto ti = computeTpfaTransmissibility(scvf, insideScv, K, 1.0);
+        const auto alpha = faceVars.darcyGravityProjection;
+        const auto ti = faceVars.darcyTransmissibility;
 
         // get the Forchheimer coefficient
         Scalar cF = couplingManager_.problem(darcyIdx).spatialParams().forchCoeff(scvf);
 
         const Scalar interfacePressure = ((-mu*(scvf.unitOuterNormal() * velocity))
-                                        + (-(scvf.unitOuterNormal() * velocity) * velocity.two_norm() * rho * sqrt(darcyPermeability(element, scvf)) * cF)
+                                        + (-(scvf.unitOuterNormal() * velocity) * velocity.two_norm() * rho * sqrt(K) * cF)
                                         +  rho * alpha)/ti + cellCenterPressure;
         return interfacePressure;
     }
 
     /*!
      * \brief Returns the pressure at the interface using Darcy's law for reconstruction
+     * \note The transmissibility and the gravity projection are precomputed by the coupling manager.
      */
-    Scalar computeCouplingPhasePressureAtInterface_(const Element<darcyIdx>& element,
-                                                    const FVElementGeometry<darcyIdx>& fvGeometry,
-                                                    const SubControlVolumeFace<darcyIdx>& scvf,
+    template<class CouplingFaceVariables>
+    Scalar computeCouplingPhasePressureAtInterface_(const SubControlVolumeFace<darcyIdx>& scvf,
                                                     const VolumeVariables<darcyIdx>& volVars,
+                                                    const CouplingFaceVariables& faceVars,
                                                     const typename Element<stokesIdx>::Geometry::GlobalCoordinate& couplingPhaseVelocity,
                                                     DarcysLaw) const
     {
@@ -480,16 +497,13 @@ protected:
         const Scalar couplingPhaseCellCenterPressure = volVars.pressure(darcyPhaseIdx);
         const Scalar couplingPhaseMobility = volVars.mobility(darcyPhaseIdx);
         const Scalar couplingPhaseDensity = volVars.density(darcyPhaseIdx);
-        const auto K = volVars.permeability();
 
         // A tpfa approximation yields (works if mobility != 0)
         // v*n = -kr/mu*K * (gradP - rho*g)*n = mobility*(ti*(p_center - p_interface) + rho*n^TKg)
         // -> p_interface = (1/mobility * (-v*n) + rho*n^TKg)/ti + p_center
         // where v is the free-flow velocity (couplingPhaseVelocity)
-        const auto alpha = vtmv(scvf.unitOuterNormal(), K, couplingManager_.problem(darcyIdx).spatialParams().gravity(scvf.center()));
-
-        const auto& insideScv = fvGeometry.scv(scvf.insideScvIdx());
-        const auto ti = computeTpfaTransmissibility(scvf, insideScv, K, 1.0);
+        const auto alpha = faceVars.darcyGravityProjection;
+        const auto ti = faceVars.darcyTransmissibility;
 
         return (-1/couplingPhaseMobility * (scvf.unitOuterNormal() * couplingPhaseVelocity) + couplingPhaseDensity * alpha)/ti
                + couplingPhaseCellCenterPressure;
@@ -912,8 +926,9 @@ protected:
     {
         NumEqVector diffusiveFlux(0.0);
 
-        const Scalar insideDistance = this->getDistance_(scvI, scvfI);
-        const Scalar outsideDistance = this->getDistance_(scvJ, scvfI);
+        const auto& distances = this->couplingDistances_(domainI, scvfI);
+        const Scalar insideDistance = distances[0];
+        const Scalar outsideDistance = distances[1];
 
         ReducedComponentVector moleFracInside(0.0);
         ReducedComponentVector moleFracOutside(0.0);
@@ -1055,8 +1070,9 @@ protected:
         const Scalar rhoOutside = massOrMolarDensity(volVarsJ, referenceSystemFormulation, couplingPhaseIdx(domainJ));
         const Scalar avgDensity = 0.5 * rhoInside + 0.5 * rhoOutside;
 
-        const Scalar insideDistance = this->getDistance_(scvI, scvfI);
-        const Scalar outsideDistance = this->getDistance_(scvJ, scvfI);
+        const auto& distances = this->couplingDistances_(domainI, scvfI);
+        const Scalar insideDistance = distances[0];
+        const Scalar outsideDistance = distances[1];
 
         for (int compIdx = 1; compIdx < numComponents; ++compIdx)
         {
@@ -25,12 +25,15 @@
 #ifndef DUMUX_STOKES_DARCY_COUPLINGMANAGER_HH
 #define DUMUX_STOKES_DARCY_COUPLINGMANAGER_HH
 
+#include <array>
+#include <limits>
 #include <utility>
 #include <memory>
 
 #include <dune/common/float_cmp.hh>
 #include <dune/common/exceptions.hh>
 #include <dumux/common/properties.hh>
+#include <dumux/common/math.hh>
 #include <dumux/multidomain/staggeredcouplingmanager.hh>
 #include <dumux/discretization/staggered/elementsolution.hh>
 
@@ -101,6 +104,7 @@ private:
         std::size_t darcyScvfIdx;
         std::size_t stokesScvfIdx;
         VolumeVariables<darcyIdx> volVars;
+        std::size_t couplingFaceIdx;
     };
 
     struct StationaryDarcyCouplingContext
@@ -111,9 +115,43 @@ private:
         std::size_t darcyScvfIdx;
         VelocityVector velocity;
         VolumeVariables<stokesIdx> volVars;
+        std::size_t couplingFaceIdx;
     };
+
+    static constexpr std::size_t invalidCouplingFaceIdx_ = std::numeric_limits<std::size_t>::max();
+
 public:
 
+    /*!
+     * \brief The solution-independent data of a pair of coupled Stokes and Darcy faces
+     */
+    struct CouplingFace
+    {
+        std::size_t stokesElementIdx;
+        std::size_t darcyElementIdx;
+        std::size_t stokesScvfIdx;
+        std::size_t darcyScvfIdx;
+        //! the distances of the Stokes and the Darcy cell center to the Stokes face
+        std::array<Scalar, 2> stokesDistances;
+        //! the distances of the Darcy and the Stokes cell center to the Darcy face
+        std::array<Scalar, 2> darcyDistances;
+        //! the gravity vector at the Darcy face
+        VelocityVector darcyGravity;
+    };
+
+    /*!
+     * \brief The coupled variables of a pair of coupled faces (updated once per solution update)
+     */
+    struct CouplingFaceVariables
+    {
+        VolumeVariables<darcyIdx> darcyVolVars;
+        VolumeVariables<stokesIdx> stokesVolVars;
+        //! the tpfa transmissibility of the Darcy face (unit area, without mobility)
+        Scalar darcyTransmissibility;
+        //! the projection n^T K g of the gravity vector at the Darcy face
+        Scalar darcyGravityProjection;
+    };
+
     using ParentType::couplingStencil;
     using ParentType::updateCouplingContext;
     using CouplingData = StokesDarcyCouplingData<MDTraits, StokesDarcyCouplingManager<MDTraits>>;
@@ -140,6 +178,7 @@ public:
         this->curSol() = curSol;
         couplingData_ = std::make_shared<CouplingData>(*this);
         computeStencils();
+        updateCouplingFaceVariables_();
     }
 
     //! Update after the grid has changed
@@ -148,9 +187,12 @@ public:
 
     // \}
 
-    //! Update the solution vector before assembly
+    //! Update the solution vector and the coupled variables before assembly
     void updateSolution(const SolutionVector& curSol)
-    { this->curSol() = curSol; }
+    {
+        this->curSol() = curSol;
+        updateCouplingFaceVariables_();
+    }
 
     //! Prepare the coupling stencils
     void computeStencils()
@@ -169,6 +211,8 @@ public:
             removeDuplicates_(stencil.second);
         for(auto&& stencil : stokesFaceCouplingStencils_)
             removeDuplicates_(stencil.second);
+
+        computeCouplingFaces_();
     }
 
     /*!
@@ -208,14 +252,13 @@ public:
         {
             const auto& darcyElement = this->problem(darcyIdx).gridGeometry().boundingBoxTree().entitySet().entity(indices.eIdx);
             darcyFvGeometry.bindElement(darcyElement);
-            const auto& scv = (*scvs(darcyFvGeometry).begin());
 
-            const auto darcyElemSol = elementSolution(darcyElement, this->curSol()[darcyIdx], this->problem(darcyIdx).gridGeometry());
-            VolumeVariables<darcyIdx> darcyVolVars;
-            darcyVolVars.update(darcyElemSol, this->problem(darcyIdx), darcyElement, scv);
+            // the volume variables were already computed for the current solution
+            const auto faceIdx = stokesScvfToCouplingFace_[indices.flipScvfIdx];
+            const auto& darcyVolVars = couplingFaceVariables_[faceIdx].darcyVolVars;
 
             // add the context
-            stokesCouplingContext_.push_back({darcyElement, darcyFvGeometry, indices.scvfIdx, indices.flipScvfIdx, darcyVolVars});
+            stokesCouplingContext_.push_back({darcyElement, darcyFvGeometry, indices.scvfIdx, indices.flipScvfIdx, darcyVolVars, faceIdx});
         }
     }
 
@@ -257,16 +300,12 @@ public:
                     faceVelocity[scvf.directionIndex()] = this->curSol()[stokesFaceIdx][scvf.dofIndex()];
             }
 
-            using PriVarsType = typename VolumeVariables<stokesCellCenterIdx>::PrimaryVariables;
-            const auto& cellCenterPriVars = this->curSol()[stokesCellCenterIdx][indices.eIdx];
-            const auto elemSol = makeElementSolutionFromCellCenterPrivars<PriVarsType>(cellCenterPriVars);
-
-            VolumeVariables<stokesIdx> stokesVolVars;
-            for(const auto& scv : scvs(stokesFvGeometry))
-                stokesVolVars.update(elemSol, this->problem(stokesIdx), stokesElement, scv);
+            // the volume variables were already computed for the current solution
+            const auto faceIdx = darcyScvfToCouplingFace_[indices.flipScvfIdx];
+            const auto& stokesVolVars = couplingFaceVariables_[faceIdx].stokesVolVars;
 
             // add the context
-            darcyCouplingContext_.push_back({stokesElement, stokesFvGeometry, indices.scvfIdx, indices.flipScvfIdx, faceVelocity, stokesVolVars});
+            darcyCouplingContext_.push_back({stokesElement, stokesFvGeometry, indices.scvfIdx, indices.flipScvfIdx, faceVelocity, stokesVolVars, faceIdx});
         }
     }
 
@@ -281,6 +320,8 @@ public:
                                const PrimaryVariables<darcyIdx>& priVarsJ,
                                int pvIdxJ)
     {
+        // The coupled face variables are not updated: the Darcy residual only depends
+        // on the Stokes variables of the coupling context and on the local Darcy variables.
         this->curSol()[domainJ][dofIdxGlobalJ][pvIdxJ] = priVarsJ[pvIdxJ];
     }
 
@@ -309,6 +350,9 @@ public:
 
             for(const auto& scv : scvs(data.fvGeometry))
                 data.volVars.update(elemSol, this->problem(stokesIdx), data.element, scv);
+
+            // keep the coupled variables consistent (restored when the deflection is undone)
+            couplingFaceVariables_[data.couplingFaceIdx].stokesVolVars = data.volVars;
         }
     }
 
@@ -359,6 +403,9 @@ public:
 
             for(const auto& scv : scvs(data.fvGeometry))
                 data.volVars.update(darcyElemSol, this->problem(darcyIdx), data.element, scv);
+
+            // keep the coupled variables consistent (restored when the deflection is undone)
+            updateDarcyFaceVariables_(data.couplingFaceIdx, data.fvGeometry, data.volVars);
         }
     }
 
@@ -372,6 +419,25 @@ public:
         return *couplingData_;
     }
 
+    /*!
+     * \brief Access the solution-independent data of the coupling face of a coupled scvf
+     */
+    template<std::size_t i>
+    const CouplingFace& couplingFace(Dune::index_constant<i> domainI, const SubControlVolumeFace<i>& scvf) const
+    {
+        const auto faceIdx = (i == darcyIdx) ? darcyScvfToCouplingFace_[scvf.index()] : stokesScvfToCouplingFace_[scvf.index()];
+        if (faceIdx == invalidCouplingFaceIdx_)
+            DUNE_THROW(Dune::InvalidStateException, "The scvf at " << scvf.center() << " is not coupled");
+        return couplingFaces_[faceIdx];
+    }
+
+    /*!
+     * \brief Access the coupled variables of a coupling face
+     * \param faceIdx the index of the coupling face (see the couplingFaceIdx of the coupling contexts)
+     */
+    const CouplingFaceVariables& couplingFaceVariables(std::size_t faceIdx) const
+    { return couplingFaceVariables_[faceIdx]; }
+
     /*!
      * \brief Access the coupling context needed for the Stokes domain
      */
@@ -533,6 +599,97 @@ protected:
         stencil.erase(std::unique(stencil.begin(), stencil.end()), stencil.end());
     }
 
+    //! Pair the coupled Stokes and Darcy faces and store their geometric data
+    void computeCouplingFaces_()
+    {
+        const auto& stokesGridGeometry = this->problem(stokesIdx).gridGeometry();
+        const auto& darcyGridGeometry = this->problem(darcyIdx).gridGeometry();
+
+        couplingFaces_.clear();
+        stokesScvfToCouplingFace_.assign(stokesGridGeometry.numScvf(), invalidCouplingFaceIdx_);
+        darcyScvfToCouplingFace_.assign(darcyGridGeometry.numScvf(), invalidCouplingFaceIdx_);
+
+        auto stokesFvGeometry = localView(stokesGridGeometry);
+        auto darcyFvGeometry = localView(darcyGridGeometry);
+        for (const auto& [stokesElementIdx, darcyIndices] : couplingMapper_.stokesElementToDarcyElementMap())
+        {
+            stokesFvGeometry.bindElement(stokesGridGeometry.element(stokesElementIdx));
+            for (const auto& indices : darcyIndices)
+            {
+                darcyFvGeometry.bindElement(darcyGridGeometry.element(indices.eIdx));
+
+                const auto& stokesScvf = stokesFvGeometry.scvf(indices.flipScvfIdx);
+                const auto& darcyScvf = darcyFvGeometry.scvf(indices.scvfIdx);
+                const auto& stokesScv = stokesFvGeometry.scv(stokesScvf.insideScvIdx());
+                const auto& darcyScv = darcyFvGeometry.scv(darcyScvf.insideScvIdx());
+
+                CouplingFace face;
+                face.stokesElementIdx = stokesElementIdx;
+                face.darcyElementIdx = indices.eIdx;
+                face.stokesScvfIdx = stokesScvf.index();
+                face.darcyScvfIdx = darcyScvf.index();
+                face.stokesDistances = {{ (stokesScv.dofPosition() - stokesScvf.ipGlobal()).two_norm(),
+                                          (darcyScv.dofPosition() - stokesScvf.ipGlobal()).two_norm() }};
+                face.darcyDistances = {{ (darcyScv.dofPosition() - darcyScvf.ipGlobal()).two_norm(),
+                                         (stokesScv.dofPosition() - darcyScvf.ipGlobal()).two_norm() }};
+                face.darcyGravity = this->problem(darcyIdx).spatialParams().gravity(darcyScvf.center());
+
+                stokesScvfToCouplingFace_[face.stokesScvfIdx] = couplingFaces_.size();
+                darcyScvfToCouplingFace_[face.darcyScvfIdx] = couplingFaces_.size();
+                couplingFaces_.push_back(face);
+            }
+        }
+
+        couplingFaceVariables_.resize(couplingFaces_.size());
+    }
+
+    //! Compute the coupled variables of all coupling faces for the current solution
+    void updateCouplingFaceVariables_()
+    {
+        const auto& stokesGridGeometry = this->problem(stokesIdx).gridGeometry();
+        const auto& darcyGridGeometry = this->problem(darcyIdx).gridGeometry();
+
+        auto stokesFvGeometry = localView(stokesGridGeometry);
+        auto darcyFvGeometry = localView(darcyGridGeometry);
+        for (std::size_t faceIdx = 0; faceIdx < couplingFaces_.size(); ++faceIdx)
+        {
+            const auto& face = couplingFaces_[faceIdx];
+
+            const auto& darcyElement = darcyGridGeometry.element(face.darcyElementIdx);
+            darcyFvGeometry.bindElement(darcyElement);
+            const auto darcyElemSol = elementSolution(darcyElement, this->curSol()[darcyIdx], darcyGridGeometry);
+            VolumeVariables<darcyIdx> darcyVolVars;
+            for (const auto& scv : scvs(darcyFvGeometry))
+                darcyVolVars.update(darcyElemSol, this->problem(darcyIdx), darcyElement, scv);
+            updateDarcyFaceVariables_(faceIdx, darcyFvGeometry, darcyVolVars);
+
+            const auto& stokesElement = stokesGridGeometry.element(face.stokesElementIdx);
+            stokesFvGeometry.bindElement(stokesElement);
+            using PriVarsType = typename VolumeVariables<stokesCellCenterIdx>::PrimaryVariables;
+            const auto& cellCenterPriVars = this->curSol()[stokesCellCenterIdx][face.stokesElementIdx];
+            const auto stokesElemSol = makeElementSolutionFromCellCenterPrivars<PriVarsType>(cellCenterPriVars);
+            auto& stokesVolVars = couplingFaceVariables_[faceIdx].stokesVolVars;
+            for (const auto& scv : scvs(stokesFvGeometry))
+                stokesVolVars.update(stokesElemSol, this->problem(stokesIdx), stokesElement, scv);
+        }
+    }
+
+    //! Set the Darcy volume variables of a coupling face and the quantities derived from its permeability
+    void updateDarcyFaceVariables_(std::size_t faceIdx,
+                                   const FVElementGeometry<darcyIdx>& darcyFvGeometry,
+                                   const VolumeVariables<darcyIdx>& darcyVolVars)
+    {
+        const auto& face = couplingFaces_[faceIdx];
+        const auto& scvf = darcyFvGeometry.scvf(face.darcyScvfIdx);
+        const auto& insideScv = darcyFvGeometry.scv(scvf.insideScvIdx());
+        const auto K = darcyVolVars.permeability();
+
+        auto& faceVars = couplingFaceVariables_[faceIdx];
+        faceVars.darcyVolVars = darcyVolVars;
+        faceVars.darcyTransmissibility = computeTpfaTransmissibility(scvf, insideScv, K, 1.0);
+        faceVars.darcyGravityProjection = vtmv(scvf.unitOuterNormal(), K, face.darcyGravity);
+    }
+
 private:
 
     std::vector<bool> isCoupledDarcyDof_;
@@ -544,6 +701,15 @@ private:
     std::unordered_map<std::size_t, std::vector<std::size_t> > darcyToStokesFaceCouplingStencils_;
     std::vector<std::size_t> emptyStencil_;
 
+    ////////////////////////////////////////////////////////////////////////////
+    //! The coupling faces (computed once per grid) and their coupled variables
+    //! (computed once per solution update)
+    ////////////////////////////////////////////////////////////////////////////
+    std::vector<CouplingFace> couplingFaces_;
+    std::vector<std::size_t> stokesScvfToCouplingFace_;
+    std::vector<std::size_t> darcyScvfToCouplingFace_;
+    std::vector<CouplingFaceVariables> couplingFaceVariables_;
+
     ////////////////////////////////////////////////////////////////////////////
     //! The coupling context
     ////////////////////////////////////////////////////////////////////////////
@@ -27,15 +27,72 @@
 
 #include <memory>
 #include <tuple>
+#include <type_traits>
+#include <utility>
 #include <vector>
+#include <algorithm>
 #include <dune/common/exceptions.hh>
 #include <dune/common/indices.hh>
 #include <dumux/assembly/numericepsilon.hh>
 #include <dumux/common/properties.hh>
 #include <dumux/common/typetraits/typetraits.hh>
+#include <dumux/parallel/multithreading.hh>
+#include <dumux/parallel/threadlocalstorage.hh>
 
 namespace Dumux {
 
+/*!
+ * \ingroup MultiDomain
+ * \brief Whether the coupling manager can be used in a multithreaded assembly,
+ *        i.e. elements can be bound and deflected concurrently (false by default)
+ * \note Coupling managers supporting this keep their coupling contexts per thread and deflect the solution
+ *       with CouplingManager::deflectSolution and read it with CouplingManager::curSol(domainJ).
+ *       Specialize this trait (e.g. in the header of the coupling manager) to enable the multithreaded assembly.
+ */
+template<class CouplingManager>
+struct CouplingManagerSupportsMultithreadedAssembly : public std::false_type {};
+
+#ifndef DOXYGEN
+namespace Detail {
+
+/*!
+ * \ingroup MultiDomain
+ * \brief A view on the solution of a subdomain with the deflected dofs of the calling thread
+ *        (see CouplingManager::curSol(domainJ))
+ */
+template<class SubSolutionVector>
+class DeflectedSubSolution
+{
+    using PrimaryVariables = typename SubSolutionVector::block_type;
+    using DeflectedDofs = std::vector<std::pair<std::size_t, PrimaryVariables>>;
+
+public:
+    DeflectedSubSolution(const SubSolutionVector& sol, const DeflectedDofs& deflectedDofs)
+    : sol_(&sol), deflectedDofs_(&deflectedDofs)
+    {}
+
+    //! the (deflected) primary variables of a dof
+    const PrimaryVariables& operator[](std::size_t dofIdx) const
+    {
+        // only the dofs of the element being assembled are deflected, a linear search is fine
+        for (const auto& dof : *deflectedDofs_)
+            if (dof.first == dofIdx)
+                return dof.second;
+        return (*sol_)[dofIdx];
+    }
+
+    //! the number of dofs
+    std::size_t size() const
+    { return sol_->size(); }
+
+private:
+    const SubSolutionVector* sol_;
+    const DeflectedDofs* deflectedDofs_;
+};
+
+} // end namespace Detail
+#endif // DOXYGEN
+
 /*!
  * \file
  * \ingroup MultiDomain
@@ -156,7 +213,7 @@ public:
                                const PrimaryVariables<j>& priVarsJ,
                                int pvIdxJ)
     {
-        curSol_[domainJ][dofIdxGlobalJ][pvIdxJ] = priVarsJ[pvIdxJ];
+        curSol()[domainJ][dofIdxGlobalJ][pvIdxJ] = priVarsJ[pvIdxJ];
     }
 
     /*!
@@ -182,9 +239,13 @@ public:
 
     /*!
      * \brief Updates the entire solution vector, e.g. before assembly or after grid adaption
+     * \note This must not be called concurrently with the assembly
      */
     void updateSolution(const SolutionVector& curSol)
-    { curSol_ = curSol; }
+    {
+        curSol_ = curSol;
+        deflectedDofs_.clear();
+    }
 
     // \}
 
@@ -285,13 +346,66 @@ protected:
     const SolutionVector& curSol() const
     { return curSol_; }
 
+    /*!
+     * \brief Deflect a primary variable of domain j (for coupling managers supporting multithreaded assembly)
+     * \note Without a multithreading backend, this is equivalent to the default updateCouplingContext and deflects curSol().
+     *       With a multithreading backend, only the calling thread sees the deflection (through curSol(domainJ)),
+     *       the deflected dofs of each thread are stored besides the solution vector (not a copy of it).
+     *       Restoring the original value removes the deflection.
+     */
+    template<std::size_t j>
+    void deflectSolution(Dune::index_constant<j> domainJ,
+                         std::size_t dofIdxGlobalJ,
+                         const PrimaryVariables<j>& priVarsJ,
+                         int pvIdxJ)
+    {
+        if constexpr (!Multithreading::isThreaded)
+            curSol_[domainJ][dofIdxGlobalJ][pvIdxJ] = priVarsJ[pvIdxJ];
+        else
+        {
+            auto& deflectedDofs = std::get<j>(deflectedDofs_.local());
+            auto it = std::find_if(deflectedDofs.begin(), deflectedDofs.end(),
+                                   [&](const auto& dof){ return dof.first == dofIdxGlobalJ; });
+            if (it == deflectedDofs.end())
+                it = deflectedDofs.emplace(deflectedDofs.end(), dofIdxGlobalJ, curSol_[domainJ][dofIdxGlobalJ]);
+
+            it->second[pvIdxJ] = priVarsJ[pvIdxJ];
+            if (it->second == curSol_[domainJ][dofIdxGlobalJ])
+                deflectedDofs.erase(it);
+        }
+    }
+
+    /*!
+     * \brief The solution of domain j including the deflections of the calling thread (see deflectSolution())
+     * \note Without a multithreading backend, this is curSol()[domainJ]. Otherwise, a light-weight view
+     *       providing operator[] (e.g. to create element solutions) is returned, which is valid until
+     *       the next call of deflectSolution() or updateSolution().
+     */
+    template<std::size_t j>
+    decltype(auto) curSol(Dune::index_constant<j> domainJ) const
+    {
+        if constexpr (!Multithreading::isThreaded)
+            return curSol_[domainJ];
+        else
+            return Detail::DeflectedSubSolution<std::decay_t<decltype(curSol_[domainJ])>>(
+                curSol_[domainJ], std::get<j>(deflectedDofs_.local())
+            );
+    }
+
 private:
+    template<std::size_t id>
+    using DeflectedDofs = std::vector<std::pair<std::size_t, PrimaryVariables<id>>>;
+    using DeflectedDofsTuple = typename Traits::template Tuple<DeflectedDofs>;
+
     /*!
      * \brief the solution vector of the coupled problem
      * \note in case of numeric differentiation the solution vector always carries the deflected solution
      */
     SolutionVector curSol_;
 
+    //! the dofs deflected by each thread with deflectSolution() (only used with a multithreading backend)
+    mutable ThreadLocalStorage<DeflectedDofsTuple> deflectedDofs_{[]{ return DeflectedDofsTuple{}; }};
+
     /*!
      * \brief A tuple of std::weak_ptrs to the sub problems
      * \note these are weak pointers and not shared pointers to break the cyclic dependency between coupling manager and problems
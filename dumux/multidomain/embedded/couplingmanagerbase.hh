@@ -28,8 +28,11 @@
 
 #include <iostream>
 #include <fstream>
+#include <limits>
 #include <string>
+#include <tuple>
 #include <utility>
+#include <vector>
 #include <unordered_map>
 
 #include <dune/common/timer.hh>
@@ -42,7 +45,9 @@
 #include <dumux/multidomain/couplingmanager.hh>
 #include <dumux/multidomain/glue.hh>
 #include <dumux/multidomain/embedded/pointsourcedata.hh>
+#include <dumux/multidomain/embedded/pointsourcedatastorage.hh>
 #include <dumux/multidomain/embedded/integrationpointsource.hh>
+#include <dumux/parallel/threadlocalstorage.hh>
 
 namespace Dumux {
 
@@ -82,6 +87,7 @@ class EmbeddedCouplingManagerBase
     static constexpr auto lowDimIdx = typename MDTraits::template SubDomain<1>::Index();
     using SolutionVector = typename MDTraits::SolutionVector;
     using PointSourceData = typename PSTraits::PointSourceData;
+    using PointSourceDataStorage = EmbeddedCoupling::PointSourceDataStorage<MDTraits>;
 
     // the sub domain type tags
     template<std::size_t id> using PointSource = typename PSTraits::template PointSource<id>;
@@ -146,6 +152,18 @@ public:
 
         integrationOrder_ = getParam<int>("MixedDimension.IntegrationOrder", 1);
         asImp_().computePointSourceData(integrationOrder_);
+        updatePointSourcePriVars_();
+    }
+
+    /*!
+     * \brief Updates the entire solution vector, e.g. before assembly or after grid adaption
+     * \note This also interpolates the solution to all point sources at once (see bulkPriVars(), lowDimPriVars())
+     * \note This must not be called concurrently with the assembly
+     */
+    void updateSolution(const SolutionVector& curSol)
+    {
+        ParentType::updateSolution(curSol);
+        updatePointSourcePriVars_();
     }
 
     // \}
@@ -220,6 +238,51 @@ public:
         return residual;
     }
 
+    /*!
+     * \brief prepares the coupling context for the assembly of an element of domain i
+     * \note This resets the deflections tracked for the calling thread (see updateCouplingContext()),
+     *       in particular a state with several deflected degrees of freedom is not carried on to the next element.
+     */
+    template<std::size_t i, class Assembler>
+    void bindCouplingContext(Dune::index_constant<i> domainI,
+                             const Element<i>& elementI,
+                             const Assembler& assembler)
+    {
+        ParentType::bindCouplingContext(domainI, elementI, assembler);
+        threadDeflections_().dofs = {};
+    }
+
+    /*!
+     * \brief updates the solution vector for a deflected primary variable of domain j
+     * \note In addition, the deflected degree of freedom is tracked (per thread) such that the
+     *       interpolated primary variables at the point sources can be updated with the derivative
+     *       of the interpolation instead of being interpolated anew (see bulkPriVars(), lowDimPriVars())
+     */
+    template<std::size_t i, std::size_t j, class LocalAssemblerI>
+    void updateCouplingContext(Dune::index_constant<i> domainI,
+                               const LocalAssemblerI& localAssemblerI,
+                               Dune::index_constant<j> domainJ,
+                               std::size_t dofIdxGlobalJ,
+                               const PrimaryVariables<j>& priVarsJ,
+                               int pvIdxJ)
+    {
+        const auto& solJ = this->curSol()[domainJ];
+        auto& deflection = std::get<j>(threadDeflections_().dofs);
+        if (deflection.dofIdx == Deflection<j>::none)
+        {
+            deflection.dofIdx = dofIdxGlobalJ;
+            deflection.origPriVars = solJ[dofIdxGlobalJ];
+        }
+        else if (deflection.dofIdx != dofIdxGlobalJ)
+            deflection.dofIdx = Deflection<j>::multiple;
+
+        ParentType::updateCouplingContext(domainI, localAssemblerI, domainJ, dofIdxGlobalJ, priVarsJ, pvIdxJ);
+
+        // the deflected degree of freedom has been reset
+        if (deflection.dofIdx == dofIdxGlobalJ && solJ[dofIdxGlobalJ] == deflection.origPriVars)
+            deflection.dofIdx = Deflection<j>::none;
+    }
+
     // \}
 
     /* \brief Compute integration point point sources and associated data
@@ -370,8 +433,8 @@ public:
      */
     // \{
 
-    //! Return a reference to the pointSource data
-    const PointSourceData& pointSourceData(std::size_t id) const
+    //! Return a (view on the) pointSource data
+    auto pointSourceData(std::size_t id) const
     { return pointSourceData_[id]; }
 
     //! Return a reference to the bulk problem
@@ -381,11 +444,11 @@ public:
 
     //! Return data for a bulk point source with the identifier id
     PrimaryVariables<bulkIdx> bulkPriVars(std::size_t id) const
-    { return pointSourceData_[id].interpolateBulk(this->curSol()[bulkIdx]); }
+    { return interpolatedPriVars_(bulkIdx, pointSourceData_.bulkInterpolation(), id); }
 
     //! Return data for a low dim point source with the identifier id
     PrimaryVariables<lowDimIdx> lowDimPriVars(std::size_t id) const
-    { return pointSourceData_[id].interpolateLowDim(this->curSol()[lowDimIdx]); }
+    { return interpolatedPriVars_(lowDimIdx, pointSourceData_.lowDimInterpolation(), id); }
 
     //! return the average distance to the coupled bulk cell center
     Scalar averageDistance(std::size_t id) const
@@ -409,8 +472,8 @@ public:
     const CouplingStencils<i>& couplingStencils(Dune::index_constant<i> dom) const
     { return std::get<i>(couplingStencils_); }
 
-    //! Return reference to point source data vector member
-    const std::vector<PointSourceData>& pointSourceData() const
+    //! Return reference to point source data storage
+    const PointSourceDataStorage& pointSourceData() const
     { return pointSourceData_; }
 
     //! Return a reference to an empty stencil
@@ -463,6 +526,8 @@ protected:
         vertexIndices(bulkIdx).clear();
         vertexIndices(lowDimIdx).clear();
         pointSourceData_.clear();
+        std::get<bulkIdx>(pointSourcePriVars_).clear();
+        std::get<lowDimIdx>(pointSourcePriVars_).clear();
         averageDistanceToBulkCell_.clear();
 
         idCounter_ = 0;
@@ -478,8 +543,8 @@ protected:
         glue_->build(bulkGridGeometry.boundingBoxTree(), lowDimGridGeometry.boundingBoxTree());
     }
 
-    //! Return reference to point source data vector member
-    std::vector<PointSourceData>& pointSourceData()
+    //! Return reference to point source data storage
+    PointSourceDataStorage& pointSourceData()
     { return pointSourceData_; }
 
     //! Return reference to average distances to bulk cell
@@ -521,12 +586,83 @@ protected:
     std::size_t idCounter_ = 0;
 
 private:
+    //! a deflected degree of freedom of domain id (tracked per thread during numeric differentiation)
+    template<std::size_t id>
+    struct Deflection
+    {
+        static constexpr std::size_t none = std::numeric_limits<std::size_t>::max();
+        static constexpr std::size_t multiple = none - 1;
+        std::size_t dofIdx = none;
+        PrimaryVariables<id> origPriVars;
+    };
+
+    struct ThreadDeflections
+    {
+        std::tuple<Deflection<bulkIdx>, Deflection<lowDimIdx>> dofs;
+        std::size_t version = std::numeric_limits<std::size_t>::max();
+    };
+
+    //! the deflections of the calling thread (reset if the solution has been updated)
+    ThreadDeflections& threadDeflections_() const
+    {
+        auto& deflections = deflections_.local();
+        if (deflections.version != solutionVersion_)
+        {
+            deflections = ThreadDeflections{};
+            deflections.version = solutionVersion_;
+        }
+        return deflections;
+    }
+
+    //! interpolate the current solution to all point sources at once
+    void updatePointSourcePriVars_()
+    {
+        ++solutionVersion_;
+        pointSourceData_.bulkInterpolation().apply(this->curSol()[bulkIdx], std::get<bulkIdx>(pointSourcePriVars_));
+        pointSourceData_.lowDimInterpolation().apply(this->curSol()[lowDimIdx], std::get<lowDimIdx>(pointSourcePriVars_));
+    }
+
+    /*!
+     * \brief the primary variables of domain i interpolated to the point source with identifier id
+     * \note The values for the undeflected solution are evaluated for all point sources in updateSolution().
+     *       If a single degree of freedom of domain i is deflected, its change enters with the interpolation weight.
+     *       Otherwise (point source data not yet evaluated, several deflected degrees of freedom) we interpolate
+     *       the (deflected) solution of the calling thread.
+     */
+    template<std::size_t i, class Interpolation>
+    PrimaryVariables<i> interpolatedPriVars_(Dune::index_constant<i> domainI,
+                                             const Interpolation& interpolation,
+                                             std::size_t id) const
+    {
+        const auto& sol = this->curSol()[domainI];
+        const auto& pointSourcePriVars = std::get<i>(pointSourcePriVars_);
+        if (pointSourcePriVars.size() != interpolation.size())
+            return interpolation.applyRow(id, sol);
+
+        const auto& deflection = std::get<i>(threadDeflections_().dofs);
+        if (deflection.dofIdx == Deflection<i>::none)
+            return pointSourcePriVars[id];
+        else if (deflection.dofIdx == Deflection<i>::multiple)
+            return interpolation.applyRow(id, sol);
+
+        auto priVars = pointSourcePriVars[id];
+        auto deltaPriVars = sol[deflection.dofIdx];
+        deltaPriVars -= deflection.origPriVars;
+        interpolation.applyIncrement(id, deflection.dofIdx, deltaPriVars, priVars);
+        return priVars;
+    }
+
 
     //! the point source in both domains
     std::tuple<std::vector<PointSource<bulkIdx>>, std::vector<PointSource<lowDimIdx>>> pointSources_;
-    std::vector<PointSourceData> pointSourceData_;
+    PointSourceDataStorage pointSourceData_;
     std::vector<Scalar> averageDistanceToBulkCell_;
 
+    //! the primary variables interpolated to all point sources (for the undeflected solution)
+    std::tuple<std::vector<PrimaryVariables<bulkIdx>>, std::vector<PrimaryVariables<lowDimIdx>>> pointSourcePriVars_;
+    std::size_t solutionVersion_ = 0;
+    mutable ThreadLocalStorage<ThreadDeflections> deflections_{[]{ return ThreadDeflections{}; }};
+
     //! Stencil data
     std::tuple<std::vector<std::vector<GridIndex<bulkIdx>>>,
                std::vector<std::vector<GridIndex<lowDimIdx>>>> vertexIndices_;
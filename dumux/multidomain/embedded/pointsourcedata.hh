@@ -26,6 +26,9 @@
 #define DUMUX_MULTIDOMAIN_EMBEDDED_POINTSOURCEDATA_HH
 
 #include <vector>
+#include <utility>
+#include <numeric>
+#include <cassert>
 #include <dune/common/fvector.hh>
 #include <dumux/common/properties.hh>
 #include <dumux/common/indextraits.hh>
@@ -37,6 +40,8 @@ namespace Dumux {
  * \ingroup EmbeddedCoupling
  * \brief A point source data class used for integration in multidimension models
  * \note The point source and related data are connected via an identifier (id)
+ * \note The coupling managers use this class to collect the data of a single point source
+ *       and store it in an EmbeddedCoupling::PointSourceDataStorage
  */
 template<class MDTraits>
 class PointSourceData
@@ -123,6 +128,36 @@ public:
         return lowDimPriVars;
     }
 
+    //! the bulk interpolation stencil as (dof index, weight) pairs
+    std::vector<std::pair<GridIndex<bulkIdx>, Scalar>> bulkInterpolationStencil() const
+    {
+        std::vector<std::pair<GridIndex<bulkIdx>, Scalar>> stencil;
+        if (isBox<bulkIdx>())
+        {
+            stencil.reserve(bulkCornerIndices_.size());
+            for (int i = 0; i < bulkCornerIndices_.size(); ++i)
+                stencil.emplace_back(bulkCornerIndices_[i], bulkShapeValues_[i]);
+        }
+        else
+            stencil.emplace_back(bulkElementIdx(), 1.0);
+        return stencil;
+    }
+
+    //! the low-dimensional interpolation stencil as (dof index, weight) pairs
+    std::vector<std::pair<GridIndex<lowDimIdx>, Scalar>> lowDimInterpolationStencil() const
+    {
+        std::vector<std::pair<GridIndex<lowDimIdx>, Scalar>> stencil;
+        if (isBox<lowDimIdx>())
+        {
+            stencil.reserve(lowDimCornerIndices_.size());
+            for (int i = 0; i < lowDimCornerIndices_.size(); ++i)
+                stencil.emplace_back(lowDimCornerIndices_[i], lowDimShapeValues_[i]);
+        }
+        else
+            stencil.emplace_back(lowDimElementIdx(), 1.0);
+        return stencil;
+    }
+
     GridIndex<lowDimIdx> lowDimElementIdx() const
     { return lowDimElementIdx_; }
 
@@ -246,6 +281,34 @@ public:
         enableBulkCircleInterpolation_ = true;
     }
 
+    //! the bulk interpolation stencil as (dof index, weight) pairs (the circle average if enabled)
+    std::vector<std::pair<GridIndex<bulkIdx>, Scalar>> bulkInterpolationStencil() const
+    {
+        if (!enableBulkCircleInterpolation_)
+            return ParentType::bulkInterpolationStencil();
+
+        const Scalar weightSum = std::accumulate(circleIpWeight_.begin(), circleIpWeight_.end(), 0.0);
+        std::vector<std::pair<GridIndex<bulkIdx>, Scalar>> stencil;
+        if (isBox<bulkIdx>())
+        {
+            assert(circleCornerIndices_.size() == circleShapeValues_.size());
+            for (std::size_t j = 0; j < circleStencil_.size(); ++j)
+            {
+                const auto& cornerIndices = *(circleCornerIndices_[j]);
+                const auto& shapeValues = circleShapeValues_[j];
+                for (int i = 0; i < cornerIndices.size(); ++i)
+                    stencil.emplace_back(cornerIndices[i], shapeValues[i]*circleIpWeight_[j]/weightSum);
+            }
+        }
+        else
+        {
+            stencil.reserve(circleStencil_.size());
+            for (std::size_t j = 0; j < circleStencil_.size(); ++j)
+                stencil.emplace_back(circleStencil_[j], circleIpWeight_[j]/weightSum);
+        }
+        return stencil;
+    }
+
     const std::vector<GridIndex<bulkIdx>>& circleStencil() const
     { return circleStencil_; }
 
@@ -0,0 +1,293 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*****************************************************************************
+ *   See the file COPYING for full copying permissions.                      *
+ *                                                                           *
+ *   This program is free software: you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by    *
+ *   the Free Software Foundation, either version 3 of the License, or       *
+ *   (at your option) any later version.                                     *
+ *                                                                           *
+ *   This program is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the            *
+ *   GNU General Public License for more details.                            *
+ *                                                                           *
+ *   You should have received a copy of the GNU General Public License       *
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.   *
+ *****************************************************************************/
+/*!
+ * \file
+ * \ingroup EmbeddedCoupling
+ * \brief Compact (structure-of-arrays) storage of the data associated with point sources
+ */
+
+#ifndef DUMUX_MULTIDOMAIN_EMBEDDED_POINTSOURCEDATASTORAGE_HH
+#define DUMUX_MULTIDOMAIN_EMBEDDED_POINTSOURCEDATASTORAGE_HH
+
+#include <vector>
+#include <utility>
+#include <iterator>
+#include <algorithm>
+#include <cassert>
+
+#include <dune/common/iteratorrange.hh>
+
+#include <dumux/common/properties.hh>
+#include <dumux/common/indextraits.hh>
+#include <dumux/parallel/parallel_for.hh>
+
+namespace Dumux::EmbeddedCoupling {
+
+/*!
+ * \ingroup EmbeddedCoupling
+ * \brief A linear interpolation operator in compressed row storage
+ *
+ * Each row r evaluates \f$ y_r = \sum_k w_{rk} x_{i_{rk}} \f$, i.e. the operator
+ * is a sparse matrix mapping degrees of freedom to interpolated values. The
+ * weights of a row are at the same time the derivatives of the interpolated value
+ * with respect to the degrees of freedom with the stored indices.
+ */
+template<class Scalar, class Index>
+class InterpolationOperator
+{
+public:
+    InterpolationOperator()
+    : offsets_(1, 0)
+    {}
+
+    //! remove all rows
+    void clear()
+    {
+        offsets_.assign(1, 0);
+        indices_.clear();
+        weights_.clear();
+    }
+
+    //! reserve memory for a number of rows with (in total) numEntries non-zero entries
+    void reserve(std::size_t numRows, std::size_t numEntries = 0)
+    {
+        offsets_.reserve(numRows + 1);
+        indices_.reserve(numEntries);
+        weights_.reserve(numEntries);
+    }
+
+    /*!
+     * \brief Append a row
+     * \param entries a container of (index, weight) pairs
+     * \note entries with identical index are merged into a single entry
+     */
+    void addRow(std::vector<std::pair<Index, Scalar>> entries)
+    {
+        std::sort(entries.begin(), entries.end(),
+                  [](const auto& a, const auto& b){ return a.first < b.first; });
+
+        for (const auto& [idx, weight] : entries)
+        {
+            if (indices_.size() > offsets_.back() && indices_.back() == idx)
+                weights_.back() += weight;
+            else
+            {
+                indices_.push_back(idx);
+                weights_.push_back(weight);
+            }
+        }
+
+        offsets_.push_back(indices_.size());
+    }
+
+    //! the number of rows
+    std::size_t size() const
+    { return offsets_.size() - 1; }
+
+    //! the total number of stored entries
+    std::size_t numEntries() const
+    { return indices_.size(); }
+
+    //! the indices of the non-zero entries of a row
+    Dune::IteratorRange<const Index*> indices(std::size_t row) const
+    { return { indices_.data() + offsets_[row], indices_.data() + offsets_[row+1] }; }
+
+    //! the weights of the non-zero entries of a row
+    Dune::IteratorRange<const Scalar*> weights(std::size_t row) const
+    { return { weights_.data() + offsets_[row], weights_.data() + offsets_[row+1] }; }
+
+    //! evaluate a single row for a block vector x
+    template<class Vector>
+    auto applyRow(std::size_t row, const Vector& x) const
+    {
+        assert(x.size() > 0);
+        auto y = x[0];
+        y = 0.0;
+        for (std::size_t k = offsets_[row]; k < offsets_[row+1]; ++k)
+        {
+            const auto& xk = x[indices_[k]];
+            for (std::size_t i = 0; i < y.size(); ++i)
+                y[i] += xk[i]*weights_[k];
+        }
+        return y;
+    }
+
+    /*!
+     * \brief Evaluate all rows y = Ax
+     * \note The rows are evaluated concurrently with the selected multithreading backend
+     */
+    template<class Vector, class Result>
+    void apply(const Vector& x, Result& y) const
+    {
+        y.resize(size());
+        parallelFor(size(), [&](const std::size_t row){ y[row] = applyRow(row, x); });
+    }
+
+    /*!
+     * \brief Update the value y of a row after the entry j of x changed by dx, i.e. y += w_rj dx
+     * \note The weight w_rj is the derivative of the row with respect to x_j. This is used to update
+     *       a previously evaluated row if a single degree of freedom is deflected (numeric differentiation).
+     *       The entry is found by binary search (the indices of a row are sorted and unique, see addRow()).
+     */
+    template<class Delta, class Block>
+    void applyIncrement(std::size_t row, Index j, const Delta& dx, Block& y) const
+    {
+        const auto rowBegin = indices_.begin() + offsets_[row];
+        const auto rowEnd = indices_.begin() + offsets_[row+1];
+        const auto it = std::lower_bound(rowBegin, rowEnd, j);
+        if (it == rowEnd || *it != j)
+            return;
+
+        const auto weight = weights_[std::distance(indices_.begin(), it)];
+        for (std::size_t i = 0; i < y.size(); ++i)
+            y[i] += weight*dx[i];
+    }
+
+private:
+    std::vector<std::size_t> offsets_;
+    std::vector<Index> indices_;
+    std::vector<Scalar> weights_;
+};
+
+/*!
+ * \ingroup EmbeddedCoupling
+ * \brief Compact storage for the data of all point sources of an embedded coupling manager
+ *
+ * Instead of keeping one PointSourceData object (each with several heap-allocated vectors)
+ * per point source, the element indices are stored in contiguous arrays and the interpolation
+ * stencils (indices and shape values or averaging weights) of both domains in compressed row
+ * storage indexed by the point source id. The point source data classes are only used to
+ * assemble the data for a single point source and are converted on insertion.
+ */
+template<class MDTraits>
+class PointSourceDataStorage
+{
+    using Scalar = typename MDTraits::Scalar;
+
+    template<std::size_t id> using SubDomainTypeTag = typename MDTraits::template SubDomain<id>::TypeTag;
+    template<std::size_t id> using GridGeometry = GetPropType<SubDomainTypeTag<id>, Properties::GridGeometry>;
+    template<std::size_t id> using GridView = typename GridGeometry<id>::GridView;
+    template<std::size_t id> using GridIndex = typename IndexTraits<GridView<id>>::GridIndex;
+    template<std::size_t id> using SolutionVector = GetPropType<SubDomainTypeTag<id>, Properties::SolutionVector>;
+    template<std::size_t id> using PrimaryVariables = GetPropType<SubDomainTypeTag<id>, Properties::PrimaryVariables>;
+
+    static constexpr auto bulkIdx = typename MDTraits::template SubDomain<0>::Index();
+    static constexpr auto lowDimIdx = typename MDTraits::template SubDomain<1>::Index();
+
+public:
+    using BulkInterpolationOperator = InterpolationOperator<Scalar, GridIndex<bulkIdx>>;
+    using LowDimInterpolationOperator = InterpolationOperator<Scalar, GridIndex<lowDimIdx>>;
+
+    /*!
+     * \brief A light-weight view on the data of a single point source
+     * \note provides the read-only interface of PointSourceData
+     */
+    class View
+    {
+    public:
+        View(const PointSourceDataStorage& storage, std::size_t id)
+        : storage_(&storage), id_(id) {}
+
+        PrimaryVariables<bulkIdx> interpolateBulk(const SolutionVector<bulkIdx>& sol) const
+        { return storage_->bulkInterpolation().applyRow(id_, sol); }
+
+        PrimaryVariables<lowDimIdx> interpolateLowDim(const SolutionVector<lowDimIdx>& sol) const
+        { return storage_->lowDimInterpolation().applyRow(id_, sol); }
+
+        GridIndex<lowDimIdx> lowDimElementIdx() const
+        { return storage_->lowDimElementIdx(id_); }
+
+        GridIndex<bulkIdx> bulkElementIdx() const
+        { return storage_->bulkElementIdx(id_); }
+
+    private:
+        const PointSourceDataStorage* storage_;
+        std::size_t id_;
+    };
+
+    //! reserve memory for the given number of point sources
+    void reserve(std::size_t numPointSources)
+    {
+        bulkElementIdx_.reserve(numPointSources);
+        lowDimElementIdx_.reserve(numPointSources);
+        bulkInterpolation_.reserve(numPointSources);
+        lowDimInterpolation_.reserve(numPointSources);
+    }
+
+    //! remove all point source data
+    void clear()
+    {
+        bulkElementIdx_.clear();
+        lowDimElementIdx_.clear();
+        bulkInterpolation_.clear();
+        lowDimInterpolation_.clear();
+    }
+
+    /*!
+     * \brief Add the data of the next point source (the point source id is the insertion index)
+     * \param psData a point source data object (e.g. PointSourceData or PointSourceDataCircleAverage)
+     */
+    template<class PSData>
+    void push_back(const PSData& psData)
+    {
+        bulkElementIdx_.push_back(psData.bulkElementIdx());
+        lowDimElementIdx_.push_back(psData.lowDimElementIdx());
+        bulkInterpolation_.addRow(psData.bulkInterpolationStencil());
+        lowDimInterpolation_.addRow(psData.lowDimInterpolationStencil());
+    }
+
+    //! \copydoc push_back
+    template<class PSData>
+    void emplace_back(PSData&& psData)
+    { push_back(psData); }
+
+    //! the number of stored point sources
+    std::size_t size() const
+    { return bulkElementIdx_.size(); }
+
+    //! a view on the data of the point source with identifier id
+    View operator[](std::size_t id) const
+    { return { *this, id }; }
+
+    //! the bulk element index of the point source with identifier id
+    GridIndex<bulkIdx> bulkElementIdx(std::size_t id) const
+    { return bulkElementIdx_[id]; }
+
+    //! the low-dimensional element index of the point source with identifier id
+    GridIndex<lowDimIdx> lowDimElementIdx(std::size_t id) const
+    { return lowDimElementIdx_[id]; }
+
+    //! the operator interpolating the bulk solution to all point sources
+    const BulkInterpolationOperator& bulkInterpolation() const
+    { return bulkInterpolation_; }
+
+    //! the operator interpolating the low-dimensional solution to all point sources
+    const LowDimInterpolationOperator& lowDimInterpolation() const
+    { return lowDimInterpolation_; }
+
+private:
+    std::vector<GridIndex<bulkIdx>> bulkElementIdx_;
+    std::vector<GridIndex<lowDimIdx>> lowDimElementIdx_;
+    BulkInterpolationOperator bulkInterpolation_;
+    LowDimInterpolationOperator lowDimInterpolation_;
+};
+
+} // end namespace Dumux::EmbeddedCoupling
+
+#endif
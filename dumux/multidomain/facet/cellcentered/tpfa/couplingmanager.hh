@@ -31,6 +31,7 @@
 #include <dumux/common/indextraits.hh>
 #include <dumux/discretization/method.hh>
 #include <dumux/discretization/elementsolution.hh>
+#include <dumux/parallel/threadlocalstorage.hh>
 #include <dumux/multidomain/couplingmanager.hh>
 #include <dumux/multidomain/facet/couplingmanager.hh>
 
@@ -250,15 +251,15 @@ public:
     const VolumeVariables<lowDimId>& getLowDimVolVars(const Element<bulkId>& element,
                                                       const SubControlVolumeFace<bulkId>& scvf) const
     {
-        assert(bulkContext_.isSet);
+        assert(bulkCouplingContext().isSet);
 
         const auto lowDimElemIdx = getLowDimElementIndex(element, scvf);
         const auto& map = couplingMapperPtr_->couplingMap(bulkGridId, lowDimGridId);
-        const auto& s = map.find(bulkContext_.elementIdx)->second.couplingElementStencil;
+        const auto& s = map.find(bulkCouplingContext().elementIdx)->second.couplingElementStencil;
         const auto& idxInContext = std::distance( s.begin(), std::find(s.begin(), s.end(), lowDimElemIdx) );
 
         assert(std::find(s.begin(), s.end(), lowDimElemIdx) != s.end());
-        return bulkContext_.lowDimVolVars[idxInContext];
+        return bulkCouplingContext().lowDimVolVars[idxInContext];
     }
 
     /*!
@@ -309,10 +310,10 @@ public:
     {
         const auto& map = couplingMapperPtr_->couplingMap(bulkGridId, lowDimGridId);
 
-        assert(bulkContext_.isSet);
-        assert(bulkElemIsCoupled_[bulkContext_.elementIdx]);
-        assert(map.find(bulkContext_.elementIdx) != map.end());
-        assert(bulkContext_.elementIdx == this->problem(bulkId).gridGeometry().elementMapper().index(bulkLocalAssembler.element()));
+        assert(bulkCouplingContext().isSet);
+        assert(bulkElemIsCoupled_[bulkCouplingContext().elementIdx]);
+        assert(map.find(bulkCouplingContext().elementIdx) != map.end());
+        assert(bulkCouplingContext().elementIdx == this->problem(bulkId).gridGeometry().elementMapper().index(bulkLocalAssembler.element()));
 
         typename LocalResidual<bulkId>::ElementResidualVector res(1);
         res = 0.0;
@@ -321,7 +322,7 @@ public:
                                 bulkLocalAssembler.curElemVolVars(),
                                 bulkLocalAssembler.elemFluxVarsCache(),
                                 bulkLocalAssembler.localResidual(),
-                                map.find(bulkContext_.elementIdx)->second.dofToCouplingScvfMap.at(dofIdxGlobalJ));
+                                map.find(bulkCouplingContext().elementIdx)->second.dofToCouplingScvfMap.at(dofIdxGlobalJ));
         return res;
     }
 
@@ -353,8 +354,8 @@ public:
     evalCouplingResidual(LowDimIdType, const LowDimLocalAssembler& lowDimLocalAssembler, BulkIdType)
     {
         // make sure this is called for the element for which the context was set
-        assert(lowDimContext_.isSet);
-        assert(this->problem(lowDimId).gridGeometry().elementMapper().index(lowDimLocalAssembler.element()) == lowDimContext_.elementIdx);
+        assert(lowDimCouplingContext().isSet);
+        assert(this->problem(lowDimId).gridGeometry().elementMapper().index(lowDimLocalAssembler.element()) == lowDimCouplingContext().elementIdx);
 
         // evaluate sources for the first scv
         // the sources are element-wise & scv-independent since we use tpfa in bulk domain
@@ -381,22 +382,22 @@ public:
                                               const SubControlVolume<lowDimId>& scv)
     {
         // make sure the this is called for the element of the context
-        assert(this->problem(lowDimId).gridGeometry().elementMapper().index(element) == lowDimContext_.elementIdx);
+        assert(this->problem(lowDimId).gridGeometry().elementMapper().index(element) == lowDimCouplingContext().elementIdx);
 
         NumEqVector<lowDimId> sources(0.0);
 
         const auto& map = couplingMapperPtr_->couplingMap(lowDimGridId, bulkGridId);
-        auto it = map.find(lowDimContext_.elementIdx);
+        auto it = map.find(lowDimCouplingContext().elementIdx);
         if (it == map.end())
             return sources;
 
-        assert(lowDimContext_.isSet);
+        assert(lowDimCouplingContext().isSet);
         for (const auto& embedment : it->second.embedments)
             sources += evalBulkFluxes(this->problem(bulkId).gridGeometry().element(embedment.first),
-                                      *lowDimContext_.bulkFvGeometry,
-                                      *lowDimContext_.bulkElemVolVars,
-                                      *lowDimContext_.bulkElemFluxVarsCache,
-                                      *lowDimContext_.bulkLocalResidual,
+                                      *lowDimCouplingContext().bulkFvGeometry,
+                                      *lowDimCouplingContext().bulkElemVolVars,
+                                      *lowDimCouplingContext().bulkElemFluxVarsCache,
+                                      *lowDimCouplingContext().bulkLocalResidual,
                                       embedment.second);
 
         // if lowdim domain uses box, we distribute the sources equally among the scvs
@@ -414,12 +415,14 @@ public:
     template< class Assembler >
     void bindCouplingContext(BulkIdType, const Element<bulkId>& element, const Assembler& assembler)
     {
+        auto& context = bulkCouplingContext();
+
         // clear context
-        bulkContext_.reset();
+        context.reset();
 
         // set index in context in any case
         const auto bulkElemIdx = this->problem(bulkId).gridGeometry().elementMapper().index(element);
-        bulkContext_.elementIdx = bulkElemIdx;
+        context.elementIdx = bulkElemIdx;
 
         // if element is coupled, actually set the context
         if (bulkElemIsCoupled_[bulkElemIdx])
@@ -428,38 +431,46 @@ public:
 
             auto it = map.find(bulkElemIdx); assert(it != map.end());
             const auto& elementStencil = it->second.couplingElementStencil;
-            bulkContext_.lowDimFvGeometries.reserve(elementStencil.size());
-            bulkContext_.lowDimVolVars.reserve(elementStencil.size());
+            context.lowDimFvGeometries.reserve(elementStencil.size());
+            context.lowDimVolVars.reserve(elementStencil.size());
 
-            for (const auto lowDimElemIdx : elementStencil)
+            // evaluate variables on old/new time level depending on time disc scheme
+            const auto bindLowDimVolVars = [&] (const auto& ldSol)
             {
-                const auto& ldSol = Assembler::isImplicit() ? this->curSol()[lowDimId] : assembler.prevSol()[lowDimId];
                 const auto& ldProblem = this->problem(lowDimId);
                 const auto& ldGridGeometry = this->problem(lowDimId).gridGeometry();
 
-                const auto elemJ = ldGridGeometry.element(lowDimElemIdx);
-                auto fvGeom = localView(ldGridGeometry);
-                fvGeom.bindElement(elemJ);
-
-                VolumeVariables<lowDimId> volVars;
-
-                // if low dim domain uses the box scheme, we have to create interpolated vol vars
-                if (lowDimUsesBox)
+                for (const auto lowDimElemIdx : elementStencil)
                 {
-                    const auto elemGeom = elemJ.geometry();
-                    FacetCoupling::makeInterpolatedVolVars(volVars, ldProblem, ldSol, fvGeom, elemJ, elemGeom, elemGeom.center());
+                    const auto elemJ = ldGridGeometry.element(lowDimElemIdx);
+                    auto fvGeom = localView(ldGridGeometry);
+                    fvGeom.bindElement(elemJ);
+
+                    VolumeVariables<lowDimId> volVars;
+
+                    // if low dim domain uses the box scheme, we have to create interpolated vol vars
+                    if (lowDimUsesBox)
+                    {
+                        const auto elemGeom = elemJ.geometry();
+                        FacetCoupling::makeInterpolatedVolVars(volVars, ldProblem, ldSol, fvGeom, elemJ, elemGeom, elemGeom.center());
+                    }
+                    // if low dim domain uses a cc scheme we can directly update the vol vars
+                    else
+                        volVars.update( elementSolution(elemJ, ldSol, ldGridGeometry),
+                                        ldProblem,
+                                        elemJ,
+                                        fvGeom.scv(lowDimElemIdx) );
+
+                    context.isSet = true;
+                    context.lowDimFvGeometries.emplace_back( std::move(fvGeom) );
+                    context.lowDimVolVars.emplace_back( std::move(volVars) );
                 }
-                // if low dim domain uses a cc scheme we can directly update the vol vars
-                else
-                    volVars.update( elementSolution(elemJ, ldSol, ldGridGeometry),
-                                    ldProblem,
-                                    elemJ,
-                                    fvGeom.scv(lowDimElemIdx) );
+            };
 
-                bulkContext_.isSet = true;
-                bulkContext_.lowDimFvGeometries.emplace_back( std::move(fvGeom) );
-                bulkContext_.lowDimVolVars.emplace_back( std::move(volVars) );
-            }
+            if (Assembler::isImplicit())
+                bindLowDimVolVars(this->curSol(lowDimId));
+            else
+                bindLowDimVolVars(assembler.prevSol()[lowDimId]);
         }
     }
 
@@ -475,13 +486,15 @@ public:
     template< class Assembler >
     void bindCouplingContext(LowDimIdType, const Element<lowDimId>& element, const Assembler& assembler)
     {
+        auto& context = lowDimCouplingContext();
+
         // reset contexts
-        bulkContext_.reset();
-        lowDimContext_.reset();
+        bulkCouplingContext().reset();
+        context.reset();
 
         // set index in context in any case
         const auto lowDimElemIdx = this->problem(lowDimId).gridGeometry().elementMapper().index(element);
-        lowDimContext_.elementIdx = lowDimElemIdx;
+        context.elementIdx = lowDimElemIdx;
 
         const auto& map = couplingMapperPtr_->couplingMap(lowDimGridId, bulkGridId);
         auto it = map.find(lowDimElemIdx);
@@ -501,16 +514,18 @@ public:
             auto bulkElemFluxVarsCache = localView(assembler.gridVariables(bulkId).gridFluxVarsCache());
 
             // evaluate variables on old/new time level depending on time disc scheme
-            const auto& bulkSol = Assembler::isImplicit() ? this->curSol()[bulkId] : assembler.prevSol()[bulkId];
             bulkFvGeom.bind(bulkElem);
-            bulkElemVolVars.bind(bulkElem, bulkFvGeom, bulkSol);
+            if (Assembler::isImplicit())
+                bulkElemVolVars.bind(bulkElem, bulkFvGeom, this->curSol(bulkId));
+            else
+                bulkElemVolVars.bind(bulkElem, bulkFvGeom, assembler.prevSol()[bulkId]);
             bulkElemFluxVarsCache.bind(bulkElem, bulkFvGeom, bulkElemVolVars);
 
-            lowDimContext_.isSet = true;
-            lowDimContext_.bulkFvGeometry = std::make_unique< FVElementGeometry<bulkId> >( std::move(bulkFvGeom) );
-            lowDimContext_.bulkElemVolVars = std::make_unique< ElementVolumeVariables<bulkId> >( std::move(bulkElemVolVars) );
-            lowDimContext_.bulkElemFluxVarsCache = std::make_unique< ElementFluxVariablesCache<bulkId> >( std::move(bulkElemFluxVarsCache) );
-            lowDimContext_.bulkLocalResidual = std::make_unique< LocalResidual<bulkId> >(assembler.localResidual(bulkId));
+            context.isSet = true;
+            context.bulkFvGeometry = std::make_unique< FVElementGeometry<bulkId> >( std::move(bulkFvGeom) );
+            context.bulkElemVolVars = std::make_unique< ElementVolumeVariables<bulkId> >( std::move(bulkElemVolVars) );
+            context.bulkElemFluxVarsCache = std::make_unique< ElementFluxVariablesCache<bulkId> >( std::move(bulkElemFluxVarsCache) );
+            context.bulkLocalResidual = std::make_unique< LocalResidual<bulkId> >(assembler.localResidual(bulkId));
         }
     }
 
@@ -527,7 +542,7 @@ public:
                                unsigned int pvIdxJ)
     {
         // communicate deflected solution
-        ParentType::updateCouplingContext(domainI, bulkLocalAssembler, domainJ, dofIdxGlobalJ, priVarsJ, pvIdxJ);
+        this->deflectSolution(domainJ, dofIdxGlobalJ, priVarsJ, pvIdxJ);
 
         // Since coupling only occurs via the fluxes, the context does not
         // have to be updated in explicit time discretization schemes, where
@@ -536,11 +551,11 @@ public:
             return;
 
         // skip the rest if context is empty
-        if (bulkContext_.isSet)
+        if (bulkCouplingContext().isSet)
         {
             const auto& map = couplingMapperPtr_->couplingMap(bulkGridId, lowDimGridId);
-            const auto& couplingElemStencil = map.find(bulkContext_.elementIdx)->second.couplingElementStencil;
-            const auto& ldSol = this->curSol()[lowDimId];
+            const auto& couplingElemStencil = map.find(bulkCouplingContext().elementIdx)->second.couplingElementStencil;
+            const auto& ldSol = this->curSol(lowDimId);
             const auto& ldProblem = this->problem(lowDimId);
             const auto& ldGridGeometry = this->problem(lowDimId).gridGeometry();
 
@@ -576,8 +591,8 @@ public:
                 const auto idxInContext = std::distance(couplingElemStencil.begin(), it);
                 assert(it != couplingElemStencil.end());
 
-                auto& volVars = bulkContext_.lowDimVolVars[idxInContext];
-                const auto& fvGeom = bulkContext_.lowDimFvGeometries[idxInContext];
+                auto& volVars = bulkCouplingContext().lowDimVolVars[idxInContext];
+                const auto& fvGeom = bulkCouplingContext().lowDimFvGeometries[idxInContext];
                 // if low dim domain uses the box scheme, we have to create interpolated vol vars
                 if (lowDimUsesBox)
                 {
@@ -607,7 +622,7 @@ public:
                                unsigned int pvIdxJ)
     {
         // communicate deflected solution
-        ParentType::updateCouplingContext(domainI, bulkLocalAssembler, domainJ, dofIdxGlobalJ, priVarsJ, pvIdxJ);
+        this->deflectSolution(domainJ, dofIdxGlobalJ, priVarsJ, pvIdxJ);
     }
 
     /*!
@@ -624,7 +639,7 @@ public:
                                unsigned int pvIdxJ)
     {
         // communicate deflected solution
-        ParentType::updateCouplingContext(domainI, lowDimLocalAssembler, domainJ, dofIdxGlobalJ, priVarsJ, pvIdxJ);
+        this->deflectSolution(domainJ, dofIdxGlobalJ, priVarsJ, pvIdxJ);
 
         // Since coupling only occurs via the fluxes, the context does not
         // have to be updated in explicit time discretization schemes, where
@@ -633,26 +648,26 @@ public:
             return;
 
         // skip the rest if context is empty
-        if (lowDimContext_.isSet)
+        if (lowDimCouplingContext().isSet)
         {
-            assert(lowDimContext_.elementIdx == this->problem(lowDimId).gridGeometry().elementMapper().index(lowDimLocalAssembler.element()));
+            assert(lowDimCouplingContext().elementIdx == this->problem(lowDimId).gridGeometry().elementMapper().index(lowDimLocalAssembler.element()));
 
             // since we use cc scheme in bulk domain: dof index = element index
             const auto& bulkGridGeom = this->problem(bulkId).gridGeometry();
             const auto elementJ = bulkGridGeom.element(dofIdxGlobalJ);
 
             // update corresponding vol vars in context
-            const auto& scv = lowDimContext_.bulkFvGeometry->scv(dofIdxGlobalJ);
-            const auto elemSol = elementSolution(elementJ, this->curSol()[bulkId], bulkGridGeom);
-            (*lowDimContext_.bulkElemVolVars)[dofIdxGlobalJ].update(elemSol, this->problem(bulkId), elementJ, scv);
+            const auto& scv = lowDimCouplingContext().bulkFvGeometry->scv(dofIdxGlobalJ);
+            const auto elemSol = elementSolution(elementJ, this->curSol(bulkId), bulkGridGeom);
+            (*lowDimCouplingContext().bulkElemVolVars)[dofIdxGlobalJ].update(elemSol, this->problem(bulkId), elementJ, scv);
 
             // update the element flux variables cache (tij might be solution-dependent)
-            if (dofIdxGlobalJ == bulkContext_.elementIdx)
-                lowDimContext_.bulkElemFluxVarsCache->update( elementJ, *lowDimContext_.bulkFvGeometry, *lowDimContext_.bulkElemVolVars);
+            if (dofIdxGlobalJ == bulkCouplingContext().elementIdx)
+                lowDimCouplingContext().bulkElemFluxVarsCache->update( elementJ, *lowDimCouplingContext().bulkFvGeometry, *lowDimCouplingContext().bulkElemVolVars);
             else
-                lowDimContext_.bulkElemFluxVarsCache->update( this->problem(bulkId).gridGeometry().element(bulkContext_.elementIdx),
-                                                              *lowDimContext_.bulkFvGeometry,
-                                                              *lowDimContext_.bulkElemVolVars );
+                lowDimCouplingContext().bulkElemFluxVarsCache->update( this->problem(bulkId).gridGeometry().element(bulkCouplingContext().elementIdx),
+                                                              *lowDimCouplingContext().bulkFvGeometry,
+                                                              *lowDimCouplingContext().bulkElemVolVars );
         }
     }
 
@@ -671,7 +686,7 @@ public:
                                unsigned int pvIdxJ)
     {
         // communicate deflected solution
-        ParentType::updateCouplingContext(domainI, lowDimLocalAssembler, domainJ, dofIdxGlobalJ, priVarsJ, pvIdxJ);
+        this->deflectSolution(domainJ, dofIdxGlobalJ, priVarsJ, pvIdxJ);
 
         // Since coupling only occurs via the fluxes, the context does not
         // have to be updated in explicit time discretization schemes, where
@@ -680,24 +695,24 @@ public:
             return;
 
         // skip the rest if context is empty
-        if (lowDimContext_.isSet)
+        if (lowDimCouplingContext().isSet)
         {
-            const auto& ldSol = this->curSol()[lowDimId];
+            const auto& ldSol = this->curSol(lowDimId);
             const auto& ldProblem = this->problem(lowDimId);
             const auto& ldGridGeometry = this->problem(lowDimId).gridGeometry();
 
-            assert(bulkContext_.isSet);
-            assert(lowDimContext_.elementIdx == ldGridGeometry.elementMapper().index(lowDimLocalAssembler.element()));
+            assert(bulkCouplingContext().isSet);
+            assert(lowDimCouplingContext().elementIdx == ldGridGeometry.elementMapper().index(lowDimLocalAssembler.element()));
 
             // update the corresponding vol vars in the bulk context
             const auto& bulkMap = couplingMapperPtr_->couplingMap(bulkGridId, lowDimGridId);
-            const auto& couplingElementStencil = bulkMap.find(bulkContext_.elementIdx)->second.couplingElementStencil;
-            auto it = std::find(couplingElementStencil.begin(), couplingElementStencil.end(), lowDimContext_.elementIdx);
+            const auto& couplingElementStencil = bulkMap.find(bulkCouplingContext().elementIdx)->second.couplingElementStencil;
+            auto it = std::find(couplingElementStencil.begin(), couplingElementStencil.end(), lowDimCouplingContext().elementIdx);
             assert(it != couplingElementStencil.end());
             const auto idxInContext = std::distance(couplingElementStencil.begin(), it);
 
-            auto& volVars = bulkContext_.lowDimVolVars[idxInContext];
-            const auto& fvGeom = bulkContext_.lowDimFvGeometries[idxInContext];
+            auto& volVars = bulkCouplingContext().lowDimVolVars[idxInContext];
+            const auto& fvGeom = bulkCouplingContext().lowDimFvGeometries[idxInContext];
             const auto& element = lowDimLocalAssembler.element();
             // if low dim domain uses the box scheme, we have to create interpolated vol vars
             if (lowDimUsesBox)
@@ -710,11 +725,11 @@ public:
                 volVars.update( elementSolution(element, ldSol, ldGridGeometry),
                                 ldProblem,
                                 element,
-                                fvGeom.scv(lowDimContext_.elementIdx) );
+                                fvGeom.scv(lowDimCouplingContext().elementIdx) );
 
             // update the element flux variables cache (tij depend on low dim values in context)
-            const auto contextElem = this->problem(bulkId).gridGeometry().element(bulkContext_.elementIdx);
-            lowDimContext_.bulkElemFluxVarsCache->update(contextElem, *lowDimContext_.bulkFvGeometry, *lowDimContext_.bulkElemVolVars);
+            const auto contextElem = this->problem(bulkId).gridGeometry().element(bulkCouplingContext().elementIdx);
+            lowDimCouplingContext().bulkElemFluxVarsCache->update(contextElem, *lowDimCouplingContext().bulkFvGeometry, *lowDimCouplingContext().bulkElemVolVars);
         }
     }
 
@@ -752,7 +767,7 @@ public:
         if (BulkLocalAssembler::isImplicit())
         {
             auto elemVolVars = localView(gridVolVars);
-            elemVolVars.bind(bulkLocalAssembler.element(), bulkLocalAssembler.fvGeometry(), this->curSol()[bulkId]);
+            elemVolVars.bind(bulkLocalAssembler.element(), bulkLocalAssembler.fvGeometry(), this->curSol(bulkId));
             fluxVarsCache.update(bulkLocalAssembler.element(), bulkLocalAssembler.fvGeometry(), elemVolVars);
         }
     }
@@ -764,13 +779,13 @@ public:
     { return std::get<(id == bulkId ? 0 : 1)>(emptyStencilTuple_); }
 
 protected:
-    //! Return const references to the bulk coupling contexts
-    const BulkCouplingContext& bulkCouplingContext() const { return bulkContext_; }
-    const LowDimCouplingContext& lowDimCouplingContext() const { return lowDimContext_; }
+    //! Return const references to the coupling contexts of the calling thread
+    const BulkCouplingContext& bulkCouplingContext() const { return bulkContexts_.local(); }
+    const LowDimCouplingContext& lowDimCouplingContext() const { return lowDimContexts_.local(); }
 
-    //! Return references to the bulk coupling contexts
-    BulkCouplingContext& bulkCouplingContext() { return bulkContext_; }
-    LowDimCouplingContext& lowDimCouplingContext() { return lowDimContext_; }
+    //! Return references to the coupling contexts of the calling thread
+    BulkCouplingContext& bulkCouplingContext() { return bulkContexts_.local(); }
+    LowDimCouplingContext& lowDimCouplingContext() { return lowDimContexts_.local(); }
 
     //! evaluates the bulk-facet exchange fluxes for a given facet element
     template<class BulkScvfIndices>
@@ -806,11 +821,20 @@ private:
     using LowDimStencil = typename CouplingMapper::template Stencil<lowDimId>;
     std::tuple<BulkStencil, LowDimStencil> emptyStencilTuple_;
 
-    //! The coupling contexts of the two domains
-    BulkCouplingContext bulkContext_;
-    LowDimCouplingContext lowDimContext_;
+    //! The coupling contexts of the two domains (one per thread, such that elements can be assembled concurrently)
+    mutable ThreadLocalStorage<BulkCouplingContext> bulkContexts_{[]{ return BulkCouplingContext{}; }};
+    mutable ThreadLocalStorage<LowDimCouplingContext> lowDimContexts_{[]{ return LowDimCouplingContext{}; }};
 };
 
+/*!
+ * \ingroup FacetCoupling
+ * \brief The facet coupling manager for tpfa bulk domains keeps its contexts per thread and
+ *        deflects the solution per thread, such that it can be used in a multithreaded assembly
+ */
+template<class MDTraits, class CouplingMapper, std::size_t bulkDomainId, std::size_t lowDimDomainId>
+struct CouplingManagerSupportsMultithreadedAssembly<FacetCouplingManager<MDTraits, CouplingMapper, bulkDomainId, lowDimDomainId, DiscretizationMethod::cctpfa>>
+: public std::true_type {};
+
 } // end namespace Dumux
 
 #endif
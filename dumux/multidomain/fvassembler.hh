@@ -28,17 +28,25 @@
 
 #include <type_traits>
 #include <tuple>
+#include <array>
+#include <atomic>
 
 #include <dune/common/hybridutilities.hh>
 #include <dune/istl/matrixindexset.hh>
 
 #include <dumux/common/properties.hh>
+#include <dumux/common/parameters.hh>
+#include <dumux/common/exceptions.hh>
 #include <dumux/common/timeloop.hh>
 #include <dumux/common/typetraits/utility.hh>
 #include <dumux/discretization/method.hh>
 #include <dumux/assembly/diffmethod.hh>
 #include <dumux/assembly/jacobianpattern.hh>
 #include <dumux/linear/parallelhelpers.hh>
+#include <dumux/parallel/multithreading.hh>
+#include <dumux/parallel/parallel_for.hh>
+#include <dumux/parallel/coloring.hh>
+#include <dumux/parallel/threadlocalstorage.hh>
 
 #include "couplingjacobianpattern.hh"
 #include "subdomaincclocalassembler.hh"
@@ -133,6 +141,10 @@ private:
     template<std::size_t id>
     using SubDomainAssembler = typename SubDomainAssemblerType<GridGeometry<id>::discMethod, id>::type;
 
+    template<std::size_t id>
+    using LocalViewsStorage = ThreadLocalStorage<typename SubDomainAssembler<id>::LocalViews>;
+    using LocalViewsStorageTuple = typename MDTraits::template TupleOfSharedPtr<LocalViewsStorage>;
+
 public:
 
 
@@ -155,6 +167,9 @@ public:
     {
         static_assert(isImplicit(), "Explicit assembler for stationary problem doesn't make sense!");
         std::cout << "Instantiated assembler for a stationary problem." << std::endl;
+
+        enableMultithreading_ = getParam<bool>("Assembly.Multithreading", true);
+        makeLocalViewsStorage_();
     }
 
     /*!
@@ -178,6 +193,9 @@ public:
     , warningIssued_(false)
     {
         std::cout << "Instantiated assembler for an instationary problem." << std::endl;
+
+        enableMultithreading_ = getParam<bool>("Assembly.Multithreading", true);
+        makeLocalViewsStorage_();
     }
 
     /*!
@@ -222,6 +240,46 @@ public:
         });
     }
 
+    /*!
+     * \brief Assembles the diagonal Jacobian block and the residual of subdomain i for the current solution
+     * \note The coupling blocks are not assembled, the other subdomains only enter through the coupling
+     *       manager (which has to be updated with curSol before). This is used by partitioned solvers
+     *       solving the subdomains one after another (e.g. FixedStressSplitSolver).
+     * \param domainId the index of the subdomain
+     * \param jac the diagonal Jacobian block (with the pattern set by setJacobianPattern(domainId, jac))
+     * \param res the residual of the subdomain
+     * \param curSol the solution of all subdomains
+     */
+    template<std::size_t i, class JacobianBlock, class SubResidual>
+    void assembleJacobianAndResidual(Dune::index_constant<i> domainId, JacobianBlock& jac, SubResidual& res,
+                                     const SolutionVector& curSol)
+    {
+        checkAssemblerState_();
+        jac = 0.0;
+        res.resize(numDofs(domainId));
+        res = 0.0;
+
+        assemble_(domainId, [&](const auto& element)
+        {
+            auto subDomainAssembler = makeSubDomainAssembler_(domainId, element, curSol);
+            subDomainAssembler.assembleDiagonalJacobianAndResidual(jac, res, gridVariables(domainId));
+        });
+    }
+
+    /*!
+     * \brief Assembles the residual of subdomain i for the current solution
+     * \note Only the grid variables of subdomain i are updated
+     */
+    template<std::size_t i, class SubResidual>
+    void assembleResidual(Dune::index_constant<i> domainId, SubResidual& res, const SolutionVector& curSol)
+    {
+        checkAssemblerState_();
+        gridVariables(domainId).update(curSol[domainId]);
+        res.resize(numDofs(domainId));
+        res = 0.0;
+        assembleResidual_(domainId, res, curSol);
+    }
+
     //! compute the residual and return it's vector norm
     Scalar residualNorm(const SolutionVector& curSol)
     {
@@ -341,6 +399,22 @@ public:
         });
     }
 
+    /*!
+     * \brief Sets the build mode and the sparsity pattern of the diagonal Jacobian block
+     *        of subdomain i (without coupling entries to other subdomains)
+     */
+    template<std::size_t i, class JacobianBlock>
+    void setJacobianPattern(Dune::index_constant<i> domainId, JacobianBlock& jac) const
+    {
+        if (jac.buildMode() == JacobianBlock::BuildMode::unknown)
+            jac.setBuildMode(JacobianBlock::BuildMode::random);
+        else if (jac.buildMode() != JacobianBlock::BuildMode::random)
+            DUNE_THROW(Dune::NotImplemented, "Only BCRS matrices with random build mode are supported at the moment");
+
+        const auto pattern = getJacobianPattern_(domainId, domainId);
+        pattern.exportIdx(jac);
+    }
+
     /*!
      * \brief Resizes the residual
      */
@@ -437,6 +511,22 @@ public:
     bool isStationaryProblem() const
     { return isStationaryProblem_; }
 
+    /*!
+     * \brief Enable or disable the multithreaded assembly (default: parameter Assembly.Multithreading)
+     * \note Only cell-centered subdomains without grid-wide caching of volume variables and flux
+     *       variables caches are assembled multithreaded (if a multithreading backend is selected).
+     *       The coupling manager has to support it (see CouplingManagerSupportsMultithreadedAssembly).
+     */
+    void enableMultithreading(bool enable = true)
+    { enableMultithreading_ = enable; }
+
+    /*!
+     * \brief Whether subdomain i is assembled multithreaded
+     */
+    template<std::size_t i>
+    bool isMultithreaded(Dune::index_constant<i> domainId) const
+    { return isThreadable_(domainId) && enableMultithreading_; }
+
     /*!
      * \brief Create a local residual object (used by the local assembler)
      */
@@ -485,13 +575,47 @@ private:
                                                     << " Did you forget to set the timeLoop to make this problem instationary?");
     }
 
+    /*!
+     * \brief Create the per-thread local views of the subdomains, the factories only hold
+     *        the grid geometry and grid variables of the subdomain
+     * \note Staggered subdomains are left out, their local assemblers also own the element
+     *       face variables and construct all local views per element
+     */
+    void makeLocalViewsStorage_()
+    {
+        using namespace Dune::Hybrid;
+        forEach(std::make_index_sequence<JacobianMatrix::N()>(), [&](const auto domainId)
+        {
+            if constexpr (GridGeometry<domainId>::discMethod != DiscretizationMethod::staggered)
+            {
+                using LocalAssembler = SubDomainAssembler<domainId>;
+                const auto gg = std::get<domainId>(gridGeometryTuple_);
+                const auto gv = std::get<domainId>(gridVariablesTuple_);
+                std::get<domainId>(localViews_) = std::make_shared<LocalViewsStorage<domainId>>(
+                    [gg, gv]{ return LocalAssembler::makeLocalViews(*gg, *gv); }
+                );
+            }
+        });
+    }
+
+    //! create the local assembler of subdomain i for an element (reusing the local views of the calling thread)
+    template<std::size_t i, class Element>
+    SubDomainAssembler<i> makeSubDomainAssembler_(Dune::index_constant<i> domainId, const Element& element,
+                                                  const SolutionVector& curSol) const
+    {
+        if constexpr (GridGeometry<i>::discMethod == DiscretizationMethod::staggered)
+            return SubDomainAssembler<i>(*this, element, curSol, *couplingManager_);
+        else
+            return SubDomainAssembler<i>(*this, element, curSol, *couplingManager_, std::get<i>(localViews_)->local());
+    }
+
     template<std::size_t i, class JacRow, class SubRes>
     void assembleJacobianAndResidual_(Dune::index_constant<i> domainId, JacRow& jacRow, SubRes& subRes,
                                       const SolutionVector& curSol)
     {
         assemble_(domainId, [&](const auto& element)
         {
-            SubDomainAssembler<i> subDomainAssembler(*this, element, curSol, *couplingManager_);
+            auto subDomainAssembler = makeSubDomainAssembler_(domainId, element, curSol);
             subDomainAssembler.assembleJacobianAndResidual(jacRow, subRes, gridVariablesTuple_);
         });
     }
@@ -502,7 +626,7 @@ private:
     {
         assemble_(domainId, [&](const auto& element)
         {
-            SubDomainAssembler<i> subDomainAssembler(*this, element, curSol, *couplingManager_);
+            auto subDomainAssembler = makeSubDomainAssembler_(domainId, element, curSol);
             subDomainAssembler.assembleResidual(subRes);
         });
     }
@@ -510,15 +634,111 @@ private:
     /*!
      * \brief A method assembling something per element
      * \note Handles exceptions for parallel runs
+     * \note Assembles multithreaded if enabled (see isMultithreaded()), coloring the elements
+     *       such that no two elements of a color assemble into the same row
      * \throws NumericalProblem on all processes if something throwed during assembly
-     * TODO: assemble in parallel
      */
     template<std::size_t i, class AssembleElementFunc>
     void assemble_(Dune::index_constant<i> domainId, AssembleElementFunc&& assembleElement) const
     {
-        // let the local assembler add the element contributions
-        for (const auto& element : elements(gridView(domainId)))
-            assembleElement(element);
+        // a state that will be checked on all processes
+        bool succeeded = false;
+
+        // try assembling using the local assembly function
+        try
+        {
+            bool assembled = false;
+            if constexpr (isThreadable_(Dune::index_constant<i>()))
+            {
+                if (enableMultithreading_)
+                {
+                    assembleMultithreaded_(domainId, assembleElement);
+                    assembled = true;
+                }
+            }
+
+            if (!assembled)
+            {
+                // let the local assembler add the element contributions
+                for (const auto& element : elements(gridView(domainId)))
+                    assembleElement(element);
+            }
+
+            // if we get here, everything worked well on this process
+            succeeded = true;
+        }
+        // throw exception if a problem ocurred
+        catch (NumericalProblem &e)
+        {
+            std::cout << "rank " << gridView(domainId).comm().rank()
+                      << " caught an exception while assembling:" << e.what()
+                      << "\n";
+            succeeded = false;
+        }
+
+        // make sure everything worked well on all processes
+        if (gridView(domainId).comm().size() > 1)
+            succeeded = gridView(domainId).comm().min(succeeded);
+
+        // if not succeeded rethrow the error on all processes
+        if (!succeeded)
+            DUNE_THROW(NumericalProblem, "A process did not succeed in linearizing the system");
+    }
+
+    /*!
+     * \brief Assemble the elements of a cell-centered subdomain multithreaded
+     *        (color by color, such that no two elements of a color assemble into the same row)
+     * \throws NumericalProblem if something throwed during assembly on one of the threads
+     */
+    template<std::size_t i, class AssembleElementFunc>
+    void assembleMultithreaded_(Dune::index_constant<i> domainId, AssembleElementFunc& assembleElement) const
+    {
+        const auto& gg = gridGeometry(domainId);
+        auto& coloring = std::get<i>(elementColorings_);
+        if (coloring.colors.size() != static_cast<std::size_t>(gridView(domainId).size(0)))
+            coloring = computeConnectivityColoring(gg);
+
+        gg.elementMap(); // make sure the element map is built before the threaded loop
+        std::atomic<bool> threadFailed(false);
+        for (const auto& elementSet : coloring.sets)
+        {
+            Dumux::parallelFor(elementSet.size(), [&](const std::size_t n)
+            {
+                // exceptions must not leave the threads
+                try { assembleElement(gg.element(elementSet[n])); }
+                catch (NumericalProblem& e)
+                {
+                    std::cout << "rank " << gridView(domainId).comm().rank()
+                              << " caught an exception while assembling:" << e.what()
+                              << "\n";
+                    threadFailed = true;
+                }
+            });
+
+            if (threadFailed)
+                DUNE_THROW(NumericalProblem, "A thread did not succeed in linearizing the system");
+        }
+    }
+
+    /*!
+     * \brief Whether subdomain i can be assembled multithreaded, i.e. a multithreading backend is selected
+     *        and it is a cell-centered subdomain without grid-wide caching (which would be written concurrently),
+     *        and the coupling manager supports concurrent binding and deflection (see CouplingManagerSupportsMultithreadedAssembly)
+     */
+    template<std::size_t i>
+    static constexpr bool isThreadable_(Dune::index_constant<i>)
+    {
+        if constexpr (GridGeometry<i>::discMethod == DiscretizationMethod::cctpfa
+                      || GridGeometry<i>::discMethod == DiscretizationMethod::ccmpfa)
+        {
+            using GV = GridVariables<i>;
+            return Multithreading::isThreaded
+                   && CouplingManagerSupportsMultithreadedAssembly<CouplingManager>::value
+                   && !GV::GridVolumeVariables::cachingEnabled
+                   && !GV::GridFluxVariablesCache::cachingEnabled;
+        }
+        else
+            return false;
     }
 
     // get diagonal block pattern
@@ -564,6 +784,15 @@ private:
     std::shared_ptr<JacobianMatrix> jacobian_;
     std::shared_ptr<SolutionVector> residual_;
 
+    //! if multithreaded assembly is enabled (see isMultithreaded())
+    bool enableMultithreading_;
+
+    //! the element colorings of the subdomains for the multithreaded assembly (computed when needed)
+    mutable std::array<ElementColoring, JacobianMatrix::N()> elementColorings_;
+
+    //! the local views of the subdomains reused for all elements assembled by a thread (not for staggered subdomains)
+    LocalViewsStorageTuple localViews_;
+
     //! Issue a warning if the calculation is used in parallel with overlap. This could be a static local variable if it wasn't for g++7 yielding a linker error.
     bool warningIssued_;
 };
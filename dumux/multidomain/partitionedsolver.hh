@@ -0,0 +1,483 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/****************************************************************************
+ *   See the file COPYING for full copying permissions.                      *
+ *                                                                           *
+ *   This program is free software: you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by    *
+ *   the Free Software Foundation, either version 3 of the License, or       *
+ *   (at your option) any later version.                                     *
+ *                                                                           *
+ *   This program is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the            *
+ *   GNU General Public License for more details.                            *
+ *                                                                           *
+ *   You should have received a copy of the GNU General Public License       *
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.   *
+ *****************************************************************************/
+/*!
+ * \file
+ * \ingroup MultiDomain
+ * \brief A partitioned (block Gauss-Seidel / block Jacobi) nonlinear solver for multidomain problems
+ */
+#ifndef DUMUX_MULTIDOMAIN_PARTITIONED_SOLVER_HH
+#define DUMUX_MULTIDOMAIN_PARTITIONED_SOLVER_HH
+
+#include <deque>
+#include <tuple>
+#include <memory>
+#include <string>
+#include <utility>
+#include <iostream>
+#include <type_traits>
+
+#include <dune/common/exceptions.hh>
+#include <dune/common/indices.hh>
+#include <dune/common/hybridutilities.hh>
+#include <dune/common/dynmatrix.hh>
+#include <dune/common/dynvector.hh>
+#include <dune/common/parallel/mpihelper.hh>
+
+#include <dumux/common/parameters.hh>
+#include <dumux/common/exceptions.hh>
+#include <dumux/assembly/partialreassembler.hh>
+#include <dumux/nonlinear/newtonsolver.hh>
+
+namespace Dumux {
+
+/*!
+ * \ingroup MultiDomain
+ * \brief The assembler of a single subdomain of a multidomain problem, solving for the
+ *        subdomain's solution only while the other subdomains are frozen
+ *
+ * Implements the assembler interface of the NewtonSolver on top of a MultiDomainFVAssembler,
+ * assembling only the diagonal Jacobian block of subdomain i (the coupling blocks are never allocated).
+ * The solution of the other subdomains (the coupling data) is set with bindSolution() and
+ * passed to the coupling manager before each assembly.
+ *
+ * \note Only sequential runs are supported.
+ * \tparam MDAssembler the multidomain assembler (MultiDomainFVAssembler)
+ * \tparam CouplingManager the coupling manager
+ * \tparam i the index of the subdomain
+ */
+template<class MDAssembler, class CouplingManager, std::size_t i>
+class PartitionedSubDomainAssembler
+{
+    using MDSolutionVector = typename MDAssembler::SolutionVector;
+    static constexpr auto domainId = Dune::index_constant<i>();
+
+public:
+    using Scalar = typename MDAssembler::Scalar;
+    using JacobianMatrix = std::decay_t<decltype(std::declval<typename MDAssembler::JacobianMatrix>()[domainId][domainId])>;
+    using SolutionVector = std::decay_t<decltype(std::declval<MDSolutionVector>()[domainId])>;
+    using ResidualType = SolutionVector;
+    using GridVariables = typename MDAssembler::template GridVariables<i>;
+    using GridGeometry = typename MDAssembler::template GridGeometry<i>;
+    using Problem = typename MDAssembler::template Problem<i>;
+
+    PartitionedSubDomainAssembler(std::shared_ptr<MDAssembler> assembler,
+                                  std::shared_ptr<CouplingManager> couplingManager)
+    : assembler_(assembler)
+    , couplingManager_(couplingManager)
+    {}
+
+    /*!
+     * \brief Sets the solution of all subdomains providing the coupling data
+     * \note The solution of subdomain i is replaced by the one passed to the assembly
+     */
+    void bindSolution(const MDSolutionVector& sol)
+    { sol_ = sol; }
+
+    //! Assembles the diagonal Jacobian block and the residual of subdomain i
+    void assembleJacobianAndResidual(const SolutionVector& curSol)
+    {
+        updateSolution_(curSol);
+        assembler_->assembleJacobianAndResidual(domainId, *jacobian_, *residual_, sol_);
+    }
+
+    //! Assembles the residual of subdomain i
+    void assembleResidual(const SolutionVector& curSol)
+    {
+        updateSolution_(curSol);
+        assembler_->assembleResidual(domainId, *residual_, sol_);
+    }
+
+    //! Computes the residual of subdomain i and returns its vector norm
+    Scalar residualNorm(const SolutionVector& curSol)
+    {
+        assembleResidual(curSol);
+        return residual_->two_norm();
+    }
+
+    //! Allocates the diagonal Jacobian block and the residual of subdomain i
+    void setLinearSystem()
+    {
+        jacobian_ = std::make_shared<JacobianMatrix>();
+        residual_ = std::make_shared<ResidualType>();
+        assembler_->setJacobianPattern(domainId, *jacobian_);
+        residual_->resize(numDofs());
+    }
+
+    //! Updates the grid variables of subdomain i with the given solution
+    void updateGridVariables(const SolutionVector& curSol)
+    { gridVariables().update(curSol); }
+
+    //! Resets the grid variables of subdomain i to the last time step
+    void resetTimeStep(const SolutionVector& curSol)
+    { gridVariables().resetTimeStep(curSol); }
+
+    //! Whether we are assembling a stationary or instationary problem
+    bool isStationaryProblem() const
+    { return assembler_->isStationaryProblem(); }
+
+    //! The solution of subdomain i of the previous time step
+    const SolutionVector& prevSol() const
+    { return assembler_->prevSol()[domainId]; }
+
+    //! The number of degrees of freedom of subdomain i
+    std::size_t numDofs() const
+    { return assembler_->numDofs(domainId); }
+
+    //! The problem of subdomain i
+    const Problem& problem() const
+    { return assembler_->problem(domainId); }
+
+    //! The grid geometry of subdomain i
+    const GridGeometry& gridGeometry() const
+    { return assembler_->gridGeometry(domainId); }
+
+    //! The grid variables of subdomain i
+    GridVariables& gridVariables()
+    { return assembler_->gridVariables(domainId); }
+
+    //! The grid variables of subdomain i
+    const GridVariables& gridVariables() const
+    { return assembler_->gridVariables(domainId); }
+
+    //! The diagonal Jacobian block of subdomain i
+    JacobianMatrix& jacobian()
+    { return *jacobian_; }
+
+    //! The residual of subdomain i
+    ResidualType& residual()
+    { return *residual_; }
+
+private:
+    void updateSolution_(const SolutionVector& curSol)
+    {
+        sol_[domainId] = curSol;
+        couplingManager_->updateSolution(sol_);
+    }
+
+    std::shared_ptr<MDAssembler> assembler_;
+    std::shared_ptr<CouplingManager> couplingManager_;
+    std::shared_ptr<JacobianMatrix> jacobian_;
+    std::shared_ptr<ResidualType> residual_;
+    MDSolutionVector sol_;
+};
+
+/*!
+ * \ingroup MultiDomain
+ * \brief A partitioned nonlinear solver for multidomain problems
+ *
+ * Instead of solving the coupled system with a monolithic Newton method, the subdomains are
+ * solved one after another, each by its own NewtonSolver and linear solver (with the parameter
+ * group of the subdomain problem, e.g. [1.Newton]). The coupling data is exchanged through the
+ * coupling manager and the coupling blocks of the Jacobian are never assembled.
+ * The iterations between the subdomains (parameter group PartitionedSolver) are either
+ * - block Gauss-Seidel (Scheme = GaussSeidel): each subdomain uses the new solution of the previous ones
+ * - block Jacobi (Scheme = Jacobi): all subdomains use the solution of the last iteration
+ *
+ * and can be accelerated (Acceleration = None, Aitken or Anderson). Without acceleration,
+ * the update is relaxed with RelaxationFactor, which also is the initial Aitken relaxation.
+ * The iterations stop if the maximum relative shift of the primary variables between two
+ * iterations is below MaxRelativeShift.
+ *
+ * \note Only sequential runs are supported.
+ * \tparam Assembler the multidomain assembler (MultiDomainFVAssembler)
+ * \tparam CouplingManager the coupling manager
+ * \tparam LinearSolvers the linear solver of each subdomain
+ */
+template<class Assembler, class CouplingManager, class... LinearSolvers>
+class MultiDomainPartitionedSolver
+{
+    using Scalar = typename Assembler::Scalar;
+    using SolutionVector = typename Assembler::SolutionVector;
+
+    static constexpr std::size_t numSubDomains = Assembler::Traits::numSubDomains;
+    static_assert(sizeof...(LinearSolvers) == numSubDomains, "A linear solver is needed for each subdomain");
+
+    template<std::size_t i>
+    using LinearSolver = std::tuple_element_t<i, std::tuple<LinearSolvers...>>;
+
+public:
+    //! the assembler of subdomain i
+    template<std::size_t i>
+    using SubDomainAssembler = PartitionedSubDomainAssembler<Assembler, CouplingManager, i>;
+
+    //! the Newton solver of subdomain i
+    template<std::size_t i>
+    using SubDomainNewtonSolver = NewtonSolver<SubDomainAssembler<i>, LinearSolver<i>, DefaultPartialReassembler>;
+
+    //! the iteration scheme between the subdomains
+    enum class Scheme { gaussSeidel, jacobi };
+
+    //! the acceleration of the iterations between the subdomains
+    enum class Acceleration { none, aitken, anderson };
+
+private:
+    template<std::size_t i>
+    using SubDomainAssemblerPtr = std::shared_ptr<SubDomainAssembler<i>>;
+    using SubDomainAssemblers = typename Assembler::Traits::template Tuple<SubDomainAssemblerPtr>;
+
+    template<std::size_t i>
+    using SubDomainNewtonSolverPtr = std::shared_ptr<SubDomainNewtonSolver<i>>;
+    using SubDomainNewtonSolvers = typename Assembler::Traits::template Tuple<SubDomainNewtonSolverPtr>;
+
+public:
+    /*!
+     * \brief The constructor
+     * \param assembler the multidomain assembler
+     * \param linearSolvers a tuple with the linear solver of each subdomain
+     * \param couplingManager the coupling manager
+     * \param paramGroup the parameter group
+     */
+    MultiDomainPartitionedSolver(std::shared_ptr<Assembler> assembler,
+                                 std::tuple<std::shared_ptr<LinearSolvers>...> linearSolvers,
+                                 std::shared_ptr<CouplingManager> couplingManager,
+                                 const std::string& paramGroup = "")
+    : assembler_(assembler)
+    , couplingManager_(couplingManager)
+    {
+        const auto scheme = getParamFromGroup<std::string>(paramGroup, "PartitionedSolver.Scheme", "GaussSeidel");
+        if (scheme == "GaussSeidel")
+            scheme_ = Scheme::gaussSeidel;
+        else if (scheme == "Jacobi")
+            scheme_ = Scheme::jacobi;
+        else
+            DUNE_THROW(ParameterException, "Unknown partitioned solver scheme " << scheme << ". Use GaussSeidel or Jacobi");
+
+        const auto acceleration = getParamFromGroup<std::string>(paramGroup, "PartitionedSolver.Acceleration", "Aitken");
+        if (acceleration == "None")
+            acceleration_ = Acceleration::none;
+        else if (acceleration == "Aitken")
+            acceleration_ = Acceleration::aitken;
+        else if (acceleration == "Anderson")
+            acceleration_ = Acceleration::anderson;
+        else
+            DUNE_THROW(ParameterException, "Unknown partitioned solver acceleration " << acceleration << ". Use None, Aitken or Anderson");
+
+        maxIterations_ = getParamFromGroup<int>(paramGroup, "PartitionedSolver.MaxIterations", 100);
+        maxRelativeShift_ = getParamFromGroup<Scalar>(paramGroup, "PartitionedSolver.MaxRelativeShift", 1e-8);
+        relaxationFactor_ = getParamFromGroup<Scalar>(paramGroup, "PartitionedSolver.RelaxationFactor", 1.0);
+        andersonDepth_ = getParamFromGroup<int>(paramGroup, "PartitionedSolver.AndersonDepth", 5);
+        verbosity_ = getParamFromGroup<int>(paramGroup, "PartitionedSolver.Verbosity", 1);
+
+        using namespace Dune::Hybrid;
+        forEach(std::make_index_sequence<numSubDomains>{}, [&](auto domainId)
+        { initSubDomain_(domainId, std::get<domainId>(linearSolvers)); });
+    }
+
+    /*!
+     * \brief Solve the coupled problem with partitioned iterations
+     * \throws NumericalProblem if the iterations did not converge
+     */
+    void solve(SolutionVector& x)
+    {
+        if (!apply(x))
+            DUNE_THROW(NumericalProblem, "The partitioned solver did not converge in " << numIterations_ << " iterations");
+    }
+
+    /*!
+     * \brief Solve the coupled problem with partitioned iterations
+     * \return whether the iterations converged
+     */
+    bool apply(SolutionVector& x)
+    {
+        resetAcceleration_();
+
+        bool converged = false;
+        for (numIterations_ = 0; numIterations_ < maxIterations_ && !converged;)
+        {
+            // block Gauss-Seidel couples to the new solution of the previous subdomains, block Jacobi to the old one
+            const auto xLastIter = x;
+            auto xNew = x;
+            using namespace Dune::Hybrid;
+            forEach(std::make_index_sequence<numSubDomains>{}, [&](auto domainId)
+            { solveSubDomain_(domainId, xNew, scheme_ == Scheme::jacobi ? xLastIter : xNew); });
+
+            ++numIterations_;
+            shift_ = Detail::maxRelativeShift<Scalar>(xNew, xLastIter);
+            converged = shift_ < maxRelativeShift_;
+
+            if (verbosity_ > 0)
+                std::cout << "Partitioned iteration " << numIterations_ << ", maximum relative shift = " << shift_ << std::endl;
+
+            x = converged ? xNew : accelerate_(xLastIter, xNew);
+        }
+
+        couplingManager_->updateSolution(x);
+        assembler_->updateGridVariables(x);
+        return converged;
+    }
+
+    //! The number of partitioned iterations of the last solve
+    int numIterations() const
+    { return numIterations_; }
+
+    //! The maximum relative shift of the last partitioned iteration
+    Scalar relativeShift() const
+    { return shift_; }
+
+    //! The Newton solver of subdomain i (e.g. to adjust its parameters)
+    template<std::size_t i>
+    SubDomainNewtonSolver<i>& subDomainNewtonSolver(Dune::index_constant<i> domainId)
+    { return *std::get<domainId>(newtonSolvers_); }
+
+private:
+    template<std::size_t i>
+    void initSubDomain_(Dune::index_constant<i> domainId, std::shared_ptr<LinearSolver<i>> linearSolver)
+    {
+        auto subDomainAssembler = std::make_shared<SubDomainAssembler<i>>(assembler_, couplingManager_);
+        std::get<domainId>(subDomainAssemblers_) = subDomainAssembler;
+        std::get<domainId>(newtonSolvers_) = std::make_shared<SubDomainNewtonSolver<i>>(
+            subDomainAssembler, linearSolver, Dune::MPIHelper::getCollectiveCommunication(),
+            assembler_->problem(domainId).paramGroup()
+        );
+    }
+
+    //! Solve subdomain i for the coupling data given by couplingSol and store its solution in x
+    template<std::size_t i>
+    void solveSubDomain_(Dune::index_constant<i> domainId, SolutionVector& x, const SolutionVector& couplingSol)
+    {
+        auto& subDomainAssembler = *std::get<domainId>(subDomainAssemblers_);
+        subDomainAssembler.bindSolution(couplingSol);
+
+        auto u = couplingSol[domainId];
+        subDomainAssembler.updateGridVariables(u);
+        std::get<domainId>(newtonSolvers_)->solve(u);
+        x[domainId] = u;
+    }
+
+    void resetAcceleration_()
+    {
+        omega_ = relaxationFactor_;
+        hasLastIter_ = false;
+        residualDiffs_.clear();
+        solutionDiffs_.clear();
+    }
+
+    /*!
+     * \brief Computes the next iterate from the last iterate x and the result g of the partitioned iteration
+     * \note Aitken: dynamic relaxation of the update r = g - x, Anderson: the combination of the
+     *       last AndersonDepth results minimizing the update (see Walker & Ni, 2011)
+     */
+    SolutionVector accelerate_(const SolutionVector& x, const SolutionVector& g)
+    {
+        auto r = g;
+        r -= x;
+
+        auto xNext = x;
+        if (acceleration_ == Acceleration::none)
+        {
+            xNext.axpy(relaxationFactor_, r);
+            return xNext;
+        }
+
+        else if (acceleration_ == Acceleration::aitken)
+        {
+            if (hasLastIter_)
+            {
+                auto residualDiff = r;
+                residualDiff -= lastResidual_;
+                const auto diffNorm2 = residualDiff.two_norm2();
+                if (diffNorm2 > 0.0)
+                    omega_ *= -lastResidual_.dot(residualDiff)/diffNorm2;
+            }
+
+            lastResidual_ = r;
+            hasLastIter_ = true;
+            xNext.axpy(omega_, r);
+            return xNext;
+        }
+
+        // Anderson acceleration
+        if (hasLastIter_)
+        {
+            residualDiffs_.push_back(r);
+            residualDiffs_.back() -= lastResidual_;
+            solutionDiffs_.push_back(g);
+            solutionDiffs_.back() -= lastSolution_;
+            if (static_cast<int>(residualDiffs_.size()) > andersonDepth_)
+            {
+                residualDiffs_.pop_front();
+                solutionDiffs_.pop_front();
+            }
+        }
+
+        lastResidual_ = r;
+        lastSolution_ = g;
+        hasLastIter_ = true;
+
+        if (residualDiffs_.empty())
+        {
+            xNext.axpy(relaxationFactor_, r);
+            return xNext;
+        }
+
+        // solve the least-squares problem min |r - sum_j gamma_j residualDiffs_j| (normal equations)
+        const auto m = residualDiffs_.size();
+        Dune::DynamicMatrix<Scalar> normalMatrix(m, m);
+        Dune::DynamicVector<Scalar> rhs(m), gamma(m);
+        for (std::size_t j = 0; j < m; ++j)
+        {
+            rhs[j] = residualDiffs_[j].dot(r);
+            for (std::size_t k = 0; k < m; ++k)
+                normalMatrix[j][k] = residualDiffs_[j].dot(residualDiffs_[k]);
+        }
+
+        try { normalMatrix.solve(gamma, rhs); }
+        catch (const Dune::FMatrixError&)
+        {
+            // the history is (numerically) linearly dependent, restart
+            residualDiffs_.clear();
+            solutionDiffs_.clear();
+            xNext.axpy(relaxationFactor_, r);
+            return xNext;
+        }
+
+        xNext = g;
+        for (std::size_t j = 0; j < m; ++j)
+            xNext.axpy(-gamma[j], solutionDiffs_[j]);
+        return xNext;
+    }
+
+    std::shared_ptr<Assembler> assembler_;
+    std::shared_ptr<CouplingManager> couplingManager_;
+    SubDomainAssemblers subDomainAssemblers_;
+    SubDomainNewtonSolvers newtonSolvers_;
+
+    Scheme scheme_;
+    Acceleration acceleration_;
+    int maxIterations_;
+    Scalar maxRelativeShift_;
+    Scalar relaxationFactor_;
+    int andersonDepth_;
+    int verbosity_;
+
+    int numIterations_ = 0;
+    Scalar shift_ = 0.0;
+
+    // the state of the acceleration
+    Scalar omega_;
+    bool hasLastIter_ = false;
+    SolutionVector lastResidual_;
+    SolutionVector lastSolution_;
+    std::deque<SolutionVector> residualDiffs_;
+    std::deque<SolutionVector> solutionDiffs_;
+};
+
+} // end namespace Dumux
+
+#endif
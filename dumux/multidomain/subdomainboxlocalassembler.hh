@@ -108,12 +108,59 @@ public:
     , couplingManager_(couplingManager)
     {}
 
+    /*!
+     * \brief The constructor reusing existing local views (e.g. a per-thread workspace)
+     * \note The local views are rebound to the element, their previous state is overwritten.
+     */
+    explicit SubDomainBoxLocalAssemblerBase(const Assembler& assembler,
+                                            const Element& element,
+                                            const SolutionVector& curSol,
+                                            CouplingManager& couplingManager,
+                                            typename ParentType::LocalViews& localViews)
+    : ParentType(assembler,
+                 element,
+                 curSol,
+                 localViews,
+                 assembler.localResidual(domainId),
+                 (element.partitionType() == Dune::GhostEntity))
+    , couplingManager_(couplingManager)
+    {}
+
     /*!
      * \brief Computes the derivatives with respect to the given element and adds them
      *        to the global matrix. The element residual is written into the right hand side.
      */
     template<class JacobianMatrixRow, class GridVariablesTuple>
     void assembleJacobianAndResidual(JacobianMatrixRow& jacRow, SubSolutionVector& res, GridVariablesTuple& gridVariables)
+    {
+        assembleJacobianAndResidual_(jacRow[domainId], res, *std::get<domainId>(gridVariables), [&](const auto& residual)
+        {
+            // assemble the coupling blocks
+            using namespace Dune::Hybrid;
+            forEach(integralRange(Dune::Hybrid::size(jacRow)), [&](auto&& i)
+            {
+                if (i != id)
+                    this->assembleJacobianCoupling(i, jacRow, residual, gridVariables);
+            });
+        });
+    }
+
+    /*!
+     * \brief Computes the derivatives with respect to the given element and adds them
+     *        to the diagonal Jacobian block only (the coupling blocks are not assembled).
+     *        The element residual is written into the right hand side.
+     */
+    template<class JacobianMatrixDiagBlock, class GridVariables>
+    void assembleDiagonalJacobianAndResidual(JacobianMatrixDiagBlock& A, SubSolutionVector& res, GridVariables& gridVariables)
+    {
+        assembleJacobianAndResidual_(A, res, gridVariables, [](const auto& residual){});
+    }
+
+private:
+    //! assemble the diagonal block and the residual, assembleCoupling is called with the element residual
+    template<class JacobianMatrixDiagBlock, class GridVariables, class AssembleCoupling>
+    void assembleJacobianAndResidual_(JacobianMatrixDiagBlock& A, SubSolutionVector& res, GridVariables& gridVariables,
+                                      AssembleCoupling&& assembleCoupling)
     {
         this->asImp_().bindLocalViews();
         this->elemBcTypes().update(problem(), this->element(), this->fvGeometry());
@@ -122,19 +169,13 @@ public:
         {
             // for the diagonal jacobian block
             // forward to the internal implementation
-            const auto residual = this->asImp_().assembleJacobianAndResidualImpl(jacRow[domainId], *std::get<domainId>(gridVariables));
+            const auto residual = this->asImp_().assembleJacobianAndResidualImpl(A, gridVariables);
 
             // update the residual vector
             for (const auto& scv : scvs(this->fvGeometry()))
                 res[scv.dofIndex()] += residual[scv.localDofIndex()];
 
-            // assemble the coupling blocks
-            using namespace Dune::Hybrid;
-            forEach(integralRange(Dune::Hybrid::size(jacRow)), [&](auto&& i)
-            {
-                if (i != id)
-                    this->assembleJacobianCoupling(i, jacRow, residual, gridVariables);
-            });
+            assembleCoupling(residual);
         }
         else
         {
@@ -159,7 +200,7 @@ public:
                 const auto vIdx = this->assembler().gridGeometry(domainId).vertexMapper().index(vertex);
 
                 typedef typename JacobianMatrix::block_type BlockType;
-                BlockType &J = jacRow[domainId][vIdx][vIdx];
+                BlockType &J = A[vIdx][vIdx];
                 for (int j = 0; j < BlockType::rows; ++j)
                     J[j][j] = 1.0;
 
@@ -181,16 +222,17 @@ public:
             if (implicit)
             {
                 for (const auto& scvJ : scvs(this->fvGeometry()))
-                    jacRow[domainId][scvI.dofIndex()][scvJ.dofIndex()][eqIdx] = 0.0;
+                    A[scvI.dofIndex()][scvJ.dofIndex()][eqIdx] = 0.0;
             }
 
-            jacRow[domainId][scvI.dofIndex()][scvI.dofIndex()][eqIdx][pvIdx] = 1.0;
+            A[scvI.dofIndex()][scvI.dofIndex()][eqIdx][pvIdx] = 1.0;
         };
 
         // incorporate Dirichlet BCs
         this->asImp_().enforceDirichletConstraints(applyDirichlet);
     }
 
+public:
     /*!
      * \brief Assemble the entries in a coupling block of the jacobian.
      *        There is no coupling block between a domain and itself.
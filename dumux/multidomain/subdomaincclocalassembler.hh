@@ -109,6 +109,24 @@ public:
     , couplingManager_(couplingManager)
     {}
 
+    /*!
+     * \brief The constructor reusing existing local views (e.g. a per-thread workspace)
+     * \note The local views are rebound to the element, their previous state is overwritten.
+     */
+    explicit SubDomainCCLocalAssemblerBase(const Assembler& assembler,
+                                           const Element& element,
+                                           const SolutionVector& curSol,
+                                           CouplingManager& couplingManager,
+                                           typename ParentType::LocalViews& localViews)
+    : ParentType(assembler,
+                 element,
+                 curSol,
+                 localViews,
+                 assembler.localResidual(domainId),
+                 (element.partitionType() == Dune::GhostEntity))
+    , couplingManager_(couplingManager)
+    {}
+
     /*!
      * \brief Computes the derivatives with respect to the given element and adds them
      *        to the global matrix. The element residual is written into the right hand side.
@@ -131,6 +149,19 @@ public:
         });
     }
 
+    /*!
+     * \brief Computes the derivatives with respect to the given element and adds them
+     *        to the diagonal Jacobian block only (the coupling blocks are not assembled).
+     *        The element residual is written into the right hand side.
+     */
+    template<class JacobianMatrixDiagBlock, class GridVariables>
+    void assembleDiagonalJacobianAndResidual(JacobianMatrixDiagBlock& A, SubSolutionVector& res, GridVariables& gridVariables)
+    {
+        this->asImp_().bindLocalViews();
+        const auto globalI = this->fvGeometry().gridGeometry().elementMapper().index(this->element());
+        res[globalI] = this->asImp_().assembleJacobianAndResidualImplInverse(A, gridVariables);
+    }
+
     /*!
      * \brief Assemble the entries in a coupling block of the jacobian.
      *        There is no coupling block between a domain and itself.
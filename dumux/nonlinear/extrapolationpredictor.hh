@@ -0,0 +1,280 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*****************************************************************************
+ *   See the file COPYING for full copying permissions.                      *
+ *                                                                           *
+ *   This program is free software: you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by    *
+ *   the Free Software Foundation, either version 3 of the License, or       *
+ *   (at your option) any later version.                                     *
+ *                                                                           *
+ *   This program is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the            *
+ *   GNU General Public License for more details.                            *
+ *                                                                           *
+ *   You should have received a copy of the GNU General Public License       *
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.   *
+ *****************************************************************************/
+/*!
+ * \file
+ * \ingroup Nonlinear
+ * \brief A predictor extrapolating the initial guess of a time step from previous solutions
+ */
+#ifndef DUMUX_NONLINEAR_EXTRAPOLATION_PREDICTOR_HH
+#define DUMUX_NONLINEAR_EXTRAPOLATION_PREDICTOR_HH
+
+#include <cmath>
+#include <limits>
+#include <string>
+#include <vector>
+#include <utility>
+#include <algorithm>
+
+#include <dune/common/exceptions.hh>
+#include <dune/common/typetraits.hh>
+#include <dune/common/indices.hh>
+#include <dune/common/hybridutilities.hh>
+#include <dune/common/std/type_traits.hh>
+#include <dune/istl/bvector.hh>
+
+#include <dumux/common/parameters.hh>
+#include <dumux/common/variablesbackend.hh>
+#include <dumux/common/typetraits/vector.hh>
+
+namespace Dumux {
+namespace Detail {
+
+//! helper alias to detect primary variables with a phase state (primary variable switch)
+template<class PrimaryVariables>
+using PhaseStateDetector = decltype(std::declval<PrimaryVariables>().state());
+
+//! helper variable to check if a type is a (dynamically sized) Dune::BlockVector
+template<class T> inline constexpr bool isBlockVector = false;
+template<class B, class A> inline constexpr bool isBlockVector<Dune::BlockVector<B, A>> = true;
+
+} // end namespace Detail
+
+/*!
+ * \ingroup Nonlinear
+ * \brief Extrapolates the solution of a time step from the last accepted solutions
+ *
+ * The predictor keeps a ring buffer of the last order+1 accepted solutions and
+ * the corresponding times and evaluates the interpolating polynomial (Lagrange form)
+ * through these solutions at the end of the new time step, i.e. order 1 corresponds
+ * to linear and order 2 to quadratic extrapolation in time. As long as not enough
+ * solutions are recorded, the order is reduced.
+ *
+ * The extrapolated values are limited to the interval given for each primary variable index
+ * (e.g. [0,1] for saturations or mole fractions). A value is never limited beyond the value of the
+ * last accepted solution, such that an initial guess that already violated the bounds is not altered.
+ * For degrees of freedom that changed their phase state (primary variable switch) within the history,
+ * the last accepted solution is used.
+ *
+ * \note For multi-type block vectors, the same bounds apply to the primary variables of all blocks.
+ */
+template<class SolutionVector, class Scalar>
+class ExtrapolationPredictor
+{
+    using DofBackend = Dumux::DofBackend<SolutionVector>;
+
+public:
+    /*!
+     * \brief Construct the predictor from the parameter tree
+     * \param paramGroup the parameter group in which to look for the predictor parameters
+     * \note The predictor is disabled if Newton.PredictorOrder is zero (the default)
+     */
+    explicit ExtrapolationPredictor(const std::string& paramGroup = "")
+    {
+        setOrder(getParamFromGroup<std::size_t>(paramGroup, "Newton.PredictorOrder", 0));
+        lowerBounds_ = getParamFromGroup<std::vector<Scalar>>(paramGroup, "Newton.PredictorLowerBounds", std::vector<Scalar>{});
+        upperBounds_ = getParamFromGroup<std::vector<Scalar>>(paramGroup, "Newton.PredictorUpperBounds", std::vector<Scalar>{});
+    }
+
+    //! set the order of the extrapolation polynomial (0 disables the predictor)
+    void setOrder(std::size_t order)
+    {
+        if (order > 2)
+            DUNE_THROW(Dune::NotImplemented, "Extrapolation predictor of order " << order << " (only orders 0, 1, 2 are supported)");
+
+        order_ = order;
+        history_.resize(order_ + 1);
+        times_.resize(order_ + 1);
+        clear();
+    }
+
+    //! the order of the extrapolation polynomial
+    std::size_t order() const
+    { return order_; }
+
+    //! if the predictor is enabled
+    bool enabled() const
+    { return order_ > 0; }
+
+    //! limit all extrapolated primary variables with index pvIdx to the interval [lower, upper]
+    void setBounds(std::size_t pvIdx, Scalar lower, Scalar upper)
+    {
+        if (lowerBounds_.size() <= pvIdx)
+            lowerBounds_.resize(pvIdx + 1, std::numeric_limits<Scalar>::lowest());
+        if (upperBounds_.size() <= pvIdx)
+            upperBounds_.resize(pvIdx + 1, std::numeric_limits<Scalar>::max());
+
+        lowerBounds_[pvIdx] = lower;
+        upperBounds_[pvIdx] = upper;
+    }
+
+    //! remove all recorded solutions (e.g. after a discontinuity or a restart)
+    void clear()
+    {
+        size_ = 0;
+        head_ = 0;
+    }
+
+    //! the number of recorded solutions
+    std::size_t historySize() const
+    { return size_; }
+
+    /*!
+     * \brief Record an accepted solution
+     * \param sol the solution
+     * \param time the time at which the solution is valid
+     * \note Recording a solution at the time of the newest recorded solution replaces it.
+     *       If the time is smaller than the time of the newest recorded solution, the history is reset.
+     */
+    void push(const SolutionVector& sol, Scalar time)
+    {
+        if (!enabled())
+            return;
+
+        if (size_ > 0)
+        {
+            using std::abs; using std::max;
+            const Scalar newestTime = times_[newest_()];
+            const Scalar eps = 1e-10*max(abs(time), abs(newestTime));
+            if (abs(time - newestTime) <= eps)
+            {
+                history_[newest_()] = sol;
+                return;
+            }
+            else if (time < newestTime)
+                clear();
+        }
+
+        // overwrite the oldest entry (reusing its memory)
+        const std::size_t capacity = history_.size();
+        const std::size_t slot = (head_ + size_) % capacity;
+        history_[slot] = sol;
+        times_[slot] = time;
+        if (size_ < capacity)
+            ++size_;
+        else
+            head_ = (head_ + 1) % capacity;
+    }
+
+    /*!
+     * \brief Extrapolate the recorded solutions to the given time
+     * \param sol the extrapolated solution (output)
+     * \param time the time at which the solution is predicted
+     * \return false if no prediction was possible (less than two recorded solutions), then sol is not touched
+     */
+    bool predict(SolutionVector& sol, Scalar time) const
+    {
+        if (!enabled() || size_ < 2)
+            return false;
+
+        // the Lagrange weights of the recorded solutions evaluated at the given time
+        const std::size_t capacity = history_.size();
+        std::vector<Scalar> weights(size_, 1.0);
+        for (std::size_t i = 0; i < size_; ++i)
+            for (std::size_t j = 0; j < size_; ++j)
+                if (i != j)
+                {
+                    const Scalar ti = times_[(head_ + i) % capacity];
+                    const Scalar tj = times_[(head_ + j) % capacity];
+                    weights[i] *= (time - tj)/(ti - tj);
+                }
+
+        const auto& newest = history_[newest_()];
+        sol = newest;
+        sol *= weights[size_-1];
+        for (std::size_t i = 0; i + 1 < size_; ++i)
+            DofBackend::axpy(weights[i], history_[(head_ + i) % capacity], sol);
+
+        // limit the extrapolated values (k is the index of the recorded solution, size_-1 is the newest)
+        limitBlocks_(sol, [&](std::size_t k) -> const SolutionVector& { return history_[(head_ + k) % capacity]; });
+
+        return true;
+    }
+
+private:
+    std::size_t newest_() const
+    { return (head_ + size_ - 1) % history_.size(); }
+
+    //! apply the phase state check and the bounds to all blocks of a (possibly nested) vector
+    template<class Vector, class HistoryBlock>
+    void limitBlocks_(Vector& sol, const HistoryBlock& historyBlock) const
+    {
+        if constexpr (Dune::IsNumber<Vector>::value)
+            limitValue_(sol, historyBlock(size_-1), 0);
+
+        else if constexpr (isMultiTypeBlockVector<Vector>::value)
+            Dune::Hybrid::forEach(std::make_index_sequence<Vector::size()>{}, [&](auto i)
+            {
+                limitBlocks_(sol[Dune::index_constant<i>{}], [&](std::size_t k) -> const auto&
+                { return historyBlock(k)[Dune::index_constant<i>{}]; });
+            });
+
+        else if constexpr (Detail::isBlockVector<Vector>)
+            for (std::size_t i = 0; i < sol.size(); ++i)
+                limitBlocks_(sol[i], [&](std::size_t k) -> const auto& { return historyBlock(k)[i]; });
+
+        else
+            limitPriVars_(sol, historyBlock);
+    }
+
+    //! limit the primary variables of a single degree of freedom
+    template<class PriVars, class HistoryBlock>
+    void limitPriVars_(PriVars& priVars, const HistoryBlock& historyBlock) const
+    {
+        const auto& newest = historyBlock(size_-1);
+
+        // do not extrapolate across a change of the phase state
+        if constexpr (Dune::Std::is_detected_v<Detail::PhaseStateDetector, PriVars>)
+        {
+            for (std::size_t k = 0; k + 1 < size_; ++k)
+            {
+                if (historyBlock(k).state() != newest.state())
+                {
+                    priVars = newest;
+                    return;
+                }
+            }
+        }
+
+        for (std::size_t pvIdx = 0; pvIdx < priVars.size(); ++pvIdx)
+            limitValue_(priVars[pvIdx], newest[pvIdx], pvIdx);
+    }
+
+    template<class Value>
+    void limitValue_(Value& value, const Value& newest, std::size_t pvIdx) const
+    {
+        using std::min; using std::max;
+        if (pvIdx < lowerBounds_.size())
+            value = max(value, min(newest, Value(lowerBounds_[pvIdx])));
+        if (pvIdx < upperBounds_.size())
+            value = min(value, max(newest, Value(upperBounds_[pvIdx])));
+    }
+
+    std::size_t order_ = 0;
+    std::vector<Scalar> lowerBounds_, upperBounds_;
+
+    // ring buffer of the recorded solutions
+    std::vector<SolutionVector> history_;
+    std::vector<Scalar> times_;
+    std::size_t head_ = 0;
+    std::size_t size_ = 0;
+};
+
+} // end namespace Dumux
+
+#endif
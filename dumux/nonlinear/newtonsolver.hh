@@ -53,10 +53,12 @@
 #include <dumux/io/format.hh>
 #include <dumux/linear/linearsolveracceptsmultitypematrix.hh>
 #include <dumux/linear/matrixconverter.hh>
+#include <dumux/linear/solver.hh>
 #include <dumux/assembly/partialreassembler.hh>
 
 #include "newtonconvergencewriter.hh"
 #include "primaryvariableswitchadapter.hh"
+#include "extrapolationpredictor.hh"
 
 namespace Dumux {
 namespace Detail {
@@ -197,6 +199,14 @@ struct BlockTypeHelper<S, true>
 template<class SolutionVector>
 using BlockType = typename BlockTypeHelper<SolutionVector, Dune::IsNumber<SolutionVector>::value>::type;
 
+//! helper to detect linear solvers exposing their residual reduction (e.g. all derived from Dumux::LinearSolver)
+template<class LinearSolver>
+using LinearSolverResidReductionDetector = decltype(std::declval<const LinearSolver&>().residReduction());
+
+template<class LinearSolver>
+inline constexpr bool linearSolverHasResidReduction
+    = Dune::Std::is_detected_v<LinearSolverResidReductionDetector, LinearSolver>;
+
 } // end namespace Detail
 
 /*!
@@ -238,6 +248,7 @@ private:
 public:
     using typename ParentType::Variables;
     using Communication = Comm;
+    using Predictor = ExtrapolationPredictor<SolutionVector, Scalar>;
 
     /*!
      * \brief The Constructor
@@ -251,6 +262,7 @@ public:
     , comm_(comm)
     , paramGroup_(paramGroup)
     , priVarSwitchAdapter_(std::make_unique<PrimaryVariableSwitchAdapter>(paramGroup))
+    , predictor_(paramGroup)
     {
         initParams_(paramGroup);
 
@@ -259,7 +271,16 @@ public:
 
         // set a different default for the linear solver residual reduction
         // within the Newton the linear solver doesn't need to solve too exact
-        this->linearSolver().setResidualReduction(getParamFromGroup<Scalar>(paramGroup, "LinearSolver.ResidualReduction", 1e-6));
+        // (backends configured by a parameter tree, e.g. IstlSolverFactoryBackend, keep their tolerance)
+        if constexpr (!linearSolverKeepsConfiguredResidualReduction<LinearSolver>::value)
+            this->linearSolver().setResidualReduction(getParamFromGroup<Scalar>(paramGroup, "LinearSolver.ResidualReduction", 1e-6));
+
+        // the tolerance of the linear solver is the lower bound of the inexact Newton forcing terms
+        // and is restored after each inexact Newton solve
+        if constexpr (Detail::linearSolverHasResidReduction<LinearSolver>)
+            linearSolverReduction_ = this->linearSolver().residReduction();
+        else
+            linearSolverReduction_ = getParamFromGroup<Scalar>(paramGroup, "LinearSolver.ResidualReduction", 1e-6);
 
         // initialize the partial reassembler
         if (enablePartialReassembly_)
@@ -329,6 +350,13 @@ public:
     void setMaxSteps(int maxSteps)
     { maxSteps_ = maxSteps; }
 
+    /*!
+     * \brief Access the predictor extrapolating the initial guess of time steps
+     *        (e.g. to set the bounds of the primary variables)
+     */
+    Predictor& predictor()
+    { return predictor_; }
+
     /*!
      * \brief Run the Newton method to solve a non-linear system.
      *        Does time step control when the Newton fails to converge
@@ -343,12 +371,35 @@ public:
                 DUNE_THROW(Dune::InvalidStateException, "Using time step control with stationary problem makes no sense!");
         }
 
+        // the initial solution of the time step is the last accepted solution
+        predictor_.push(Backend::dofs(vars), timeLoop.time());
+
         // try solving the non-linear system
         for (std::size_t i = 0; i <= maxTimeStepDivisions_; ++i)
         {
+            // extrapolate the initial guess from the previously accepted solutions
+            // after a failed attempt we fall back to the solution of the last time step
+            bool predicted = false;
+            if (i == 0 && predictor_.enabled())
+            {
+                auto uPredicted = Backend::dofs(vars);
+                predicted = predictor_.predict(uPredicted, timeLoop.time() + timeLoop.timeStepSize());
+                if (predicted)
+                    solutionChanged_(vars, uPredicted);
+            }
+
             // linearize & solve
             const bool converged = solve_(vars);
 
+            if (predicted)
+            {
+                ++numPredictedSolves_;
+                if (converged)
+                    totalPredictedIter_ += numSteps_;
+                else
+                    ++numFailedPredictedSolves_;
+            }
+
             if (converged)
                 return;
 
@@ -507,19 +558,13 @@ public:
         try
         {
             if (numSteps_ == 0)
-            {
-                if constexpr (Detail::hasNorm<LinearSolver, SolutionVector>())
-                    initialResidual_ = this->linearSolver().norm(b);
+                initialResidual_ = linearSystemResidualNorm_(b);
 
-                else
-                {
-                    Scalar norm2 = b.two_norm2();
-                    if (comm_.size() > 1)
-                        norm2 = comm_.sum(norm2);
-
-                    using std::sqrt;
-                    initialResidual_ = sqrt(norm2);
-                }
+            // adapt the linear solver tolerance to the current nonlinear residual (inexact Newton)
+            if (useInexactNewton_)
+            {
+                const auto residualNorm = numSteps_ == 0 ? initialResidual_ : linearSystemResidualNorm_(b);
+                this->linearSolver().setResidualReduction(forcingTerm_(residualNorm));
             }
 
             // solve by calling the appropriate implementation depending on whether the linear solver
@@ -751,8 +796,18 @@ public:
              << "-- Total wasted Newton iterations:     " << totalWastedIter_ << '\n'
              << "-- Total succeeded Newton iterations:  " << totalSucceededIter_ << '\n'
              << "-- Average iterations per solve:       " << std::setprecision(3) << double(totalSucceededIter_) / double(numConverged_) << '\n'
-             << "-- Number of linear solver breakdowns: " << numLinearSolverBreakdowns_ << '\n'
-             << std::endl;
+             << "-- Number of linear solver breakdowns: " << numLinearSolverBreakdowns_ << '\n';
+
+        if (predictor_.enabled())
+        {
+            const auto numConvergedPredicted = numPredictedSolves_ - numFailedPredictedSolves_;
+            sout << "-- Solves with extrapolated guess:     " << numPredictedSolves_ << '\n'
+                 << "-- Failed solves with extrapolation:   " << numFailedPredictedSolves_ << '\n'
+                 << "-- Average iterations (extrapolated):  " << std::setprecision(3)
+                 << (numConvergedPredicted > 0 ? double(totalPredictedIter_) / double(numConvergedPredicted) : 0.0) << '\n';
+        }
+
+        sout << std::endl;
     }
 
     /*!
@@ -764,6 +819,9 @@ public:
         totalSucceededIter_ = 0;
         numConverged_ = 0;
         numLinearSolverBreakdowns_ = 0;
+        numPredictedSolves_ = 0;
+        numFailedPredictedSolves_ = 0;
+        totalPredictedIter_ = 0;
     }
 
     /*!
@@ -776,6 +834,7 @@ public:
         if (useLineSearch_) sout << " -- Newton.UseLineSearch = true\n";
         if (useChop_) sout << " -- Newton.EnableChop = true\n";
         if (enablePartialReassembly_) sout << " -- Newton.EnablePartialReassembly = true\n";
+        if (useInexactNewton_) sout << " -- Newton.UseInexactNewton = true\n";
         if (enableAbsoluteResidualCriterion_) sout << " -- Newton.EnableAbsoluteResidualCriterion = true\n";
         if (enableShiftCriterion_) sout << " -- Newton.EnableShiftCriterion = true (relative shift convergence criterion)\n";
         if (enableResidualCriterion_) sout << " -- Newton.EnableResidualCriterion = true\n";
@@ -793,8 +852,15 @@ public:
             sout << " -- Newton.ReassemblyMaxThreshold = " << reassemblyMaxThreshold_ << '\n';
             sout << " -- Newton.ReassemblyShiftWeight = " << reassemblyShiftWeight_ << '\n';
         }
+        if (useInexactNewton_)
+        {
+            sout << " -- Newton.ForcingTermGamma = " << forcingTermGamma_ << '\n';
+            sout << " -- Newton.ForcingTermAlpha = " << forcingTermAlpha_ << '\n';
+            sout << " -- Newton.MaxForcingTerm = " << maxForcingTerm_ << '\n';
+        }
         sout << " -- Newton.RetryTimeStepReductionFactor = " << retryTimeStepReductionFactor_ << '\n';
         sout << " -- Newton.MaxTimeStepDivisions = " << maxTimeStepDivisions_ << '\n';
+        if (predictor_.enabled()) sout << " -- Newton.PredictorOrder = " << predictor_.order() << '\n';
         sout << std::endl;
     }
 
@@ -1029,6 +1095,10 @@ private:
             // tell solver we are done
             newtonEnd();
 
+            // restore the linear solver tolerance after an inexact Newton solve
+            if (useInexactNewton_)
+                this->linearSolver().setResidualReduction(linearSolverReduction_);
+
             // reset state if Newton failed
             if (!newtonConverged())
             {
@@ -1060,6 +1130,9 @@ private:
 
             totalWastedIter_ += numSteps_;
 
+            if (useInexactNewton_)
+                this->linearSolver().setResidualReduction(linearSolverReduction_);
+
             newtonFail(vars);
             return false;
         }
@@ -1134,6 +1207,67 @@ private:
                    "Chopped Newton update strategy not implemented.");
     }
 
+    //! the (parallel) two-norm of the right hand side of the linear system
+    Scalar linearSystemResidualNorm_(const SolutionVector& b)
+    {
+        if constexpr (Detail::hasNorm<LinearSolver, SolutionVector>())
+            return this->linearSolver().norm(b);
+
+        else
+        {
+            Scalar norm2 = b.two_norm2();
+            if (comm_.size() > 1)
+                norm2 = comm_.sum(norm2);
+
+            using std::sqrt;
+            return sqrt(norm2);
+        }
+    }
+
+    /*!
+     * \brief Compute the forcing term, i.e. the relative linear solver tolerance, of an inexact Newton step
+     *
+     * Uses choice 2 of Eisenstat and Walker (1996), https://doi.org/10.1137/0917003
+     * \f[ \eta_k = \gamma \left( \frac{\| F(u_k) \|}{\| F(u_{k-1}) \|} \right)^\alpha \f]
+     * with the safeguard \f$ \eta_k = \max(\eta_k, \gamma \eta_{k-1}^\alpha) \f$ if \f$ \gamma \eta_{k-1}^\alpha > 0.1 \f$.
+     * The forcing term is bounded from above by Newton.MaxForcingTerm and from below by the residual reduction
+     * the linear solver was configured with (LinearSolver::residReduction()).
+     * Close to convergence of the residual criterion, we avoid oversolving by not reducing the linear residual much
+     * below the nonlinear tolerance (Kelley, Iterative methods for linear and nonlinear equations, SIAM, 1995).
+     *
+     * \param residualNorm the norm of the nonlinear residual in the current iteration
+     */
+    Scalar forcingTerm_(Scalar residualNorm)
+    {
+        using std::pow; using std::max; using std::min;
+
+        Scalar eta = maxForcingTerm_;
+        if (numSteps_ > 0 && lastLinearSystemResidualNorm_ > 0.0)
+        {
+            eta = forcingTermGamma_*pow(residualNorm/lastLinearSystemResidualNorm_, forcingTermAlpha_);
+
+            // do not reduce the forcing term too fast
+            const Scalar etaSafeguard = forcingTermGamma_*pow(lastForcingTerm_, forcingTermAlpha_);
+            if (etaSafeguard > 0.1)
+                eta = max(eta, etaSafeguard);
+
+            eta = min(eta, maxForcingTerm_);
+
+            // do not solve the linear system much more accurately than needed for the nonlinear tolerance
+            if (enableResidualCriterion_ && residualNorm > 0.0)
+            {
+                const Scalar tolerance = enableAbsoluteResidualCriterion_ ? residualTolerance_ : reductionTolerance_*initialResidual_;
+                eta = min(maxForcingTerm_, max(eta, 0.5*tolerance/residualNorm));
+            }
+        }
+
+        eta = max(eta, linearSolverReduction_);
+
+        lastLinearSystemResidualNorm_ = residualNorm;
+        lastForcingTerm_ = eta;
+        return eta;
+    }
+
     virtual bool solveLinearSystem_(SolutionVector& deltaU)
     {
         return solveLinearSystemImpl_(this->linearSolver(),
@@ -1280,6 +1414,11 @@ private:
         reassemblyMaxThreshold_ = getParamFromGroup<Scalar>(group, "Newton.ReassemblyMaxThreshold", 1e2*shiftTolerance_);
         reassemblyShiftWeight_ = getParamFromGroup<Scalar>(group, "Newton.ReassemblyShiftWeight", 1e-3);
 
+        useInexactNewton_ = getParamFromGroup<bool>(group, "Newton.UseInexactNewton", false);
+        forcingTermGamma_ = getParamFromGroup<Scalar>(group, "Newton.ForcingTermGamma", 0.9);
+        forcingTermAlpha_ = getParamFromGroup<Scalar>(group, "Newton.ForcingTermAlpha", 2.0);
+        maxForcingTerm_ = getParamFromGroup<Scalar>(group, "Newton.MaxForcingTerm", 0.9);
+
         maxTimeStepDivisions_ = getParamFromGroup<std::size_t>(group, "Newton.MaxTimeStepDivisions", 10);
         retryTimeStepReductionFactor_ = getParamFromGroup<Scalar>(group, "Newton.RetryTimeStepReductionFactor", 0.5);
 
@@ -1348,6 +1487,15 @@ private:
     Scalar reductionTolerance_;
     Scalar residualTolerance_;
 
+    // inexact Newton (adaptive linear solver tolerance)
+    bool useInexactNewton_;
+    Scalar linearSolverReduction_;
+    Scalar forcingTermGamma_;
+    Scalar forcingTermAlpha_;
+    Scalar maxForcingTerm_;
+    Scalar lastForcingTerm_ = 1.0;
+    Scalar lastLinearSystemResidualNorm_ = 0.0;
+
     // time step control
     std::size_t maxTimeStepDivisions_;
     Scalar retryTimeStepReductionFactor_;
@@ -1378,12 +1526,18 @@ private:
     std::size_t totalSucceededIter_ = 0; //! Newton steps in solves that converged
     std::size_t numConverged_ = 0; //! total number of converged solves
     std::size_t numLinearSolverBreakdowns_ = 0; //! total number of linear solves that failed
+    std::size_t numPredictedSolves_ = 0; //! solves starting from an extrapolated initial guess
+    std::size_t numFailedPredictedSolves_ = 0; //! solves starting from an extrapolated initial guess that didn't converge
+    std::size_t totalPredictedIter_ = 0; //! Newton steps in converged solves starting from an extrapolated initial guess
 
     //! the class handling the primary variable switch
     std::unique_ptr<PrimaryVariableSwitchAdapter> priVarSwitchAdapter_;
 
     //! convergence writer
     std::shared_ptr<ConvergenceWriter> convergenceWriter_ = nullptr;
+
+    //! extrapolation of the initial guess for time-dependent problems
+    Predictor predictor_;
 };
 
 } // end namespace Dumux
@@ -0,0 +1,149 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*****************************************************************************
+ *   See the file COPYING for full copying permissions.                      *
+ *                                                                           *
+ *   This program is free software: you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by    *
+ *   the Free Software Foundation, either version 3 of the License, or       *
+ *   (at your option) any later version.                                     *
+ *                                                                           *
+ *   This program is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the            *
+ *   GNU General Public License for more details.                            *
+ *                                                                           *
+ *   You should have received a copy of the GNU General Public License       *
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.   *
+ *****************************************************************************/
+/*!
+ * \file
+ * \ingroup Parallel
+ * \brief Coloring of the elements of a grid for conflict-free multithreaded loops
+ */
+#ifndef DUMUX_PARALLEL_COLORING_HH
+#define DUMUX_PARALLEL_COLORING_HH
+
+#include <vector>
+#include <iterator>
+#include <algorithm>
+#include <type_traits>
+
+#include <dune/grid/common/rangegenerators.hh>
+
+namespace Dumux {
+
+/*!
+ * \ingroup Parallel
+ * \brief A partition of the elements into sets (colors) such that
+ *        no two elements of the same set share a vertex
+ */
+struct ElementColoring
+{
+    //! the color of each element
+    std::vector<int> colors;
+
+    //! the indices of the elements of each color
+    std::vector<std::vector<std::size_t>> sets;
+};
+
+/*!
+ * \ingroup Parallel
+ * \brief Compute a greedy coloring of the elements of a grid such that
+ *        no two elements of the same color share a vertex
+ *
+ * Data associated with a vertex (e.g. the interaction volumes of mpfa schemes) or with
+ * the elements around a vertex can then be modified concurrently by all elements of one color.
+ *
+ * \param gridGeometry the grid geometry (providing the grid view and the element/vertex mappers)
+ */
+template<class GridGeometry>
+ElementColoring computeVertexColoring(const GridGeometry& gridGeometry)
+{
+    const auto& gridView = gridGeometry.gridView();
+    static constexpr int dim = std::decay_t<decltype(gridView)>::dimension;
+
+    ElementColoring coloring;
+    coloring.colors.assign(gridView.size(0), -1);
+
+    // the colors of the already colored elements around each vertex
+    std::vector<std::vector<int>> vertexColors(gridView.size(dim));
+    std::vector<bool> isUsed;
+    for (const auto& element : elements(gridView))
+    {
+        // collect the colors used by the neighbors
+        isUsed.assign(coloring.sets.size(), false);
+        const auto numCorners = element.subEntities(dim);
+        for (unsigned int i = 0; i < numCorners; ++i)
+            for (const auto color : vertexColors[gridGeometry.vertexMapper().subIndex(element, i, dim)])
+                isUsed[color] = true;
+
+        // take the smallest free color (or add a new one)
+        const int color = std::distance(isUsed.begin(), std::find(isUsed.begin(), isUsed.end(), false));
+        if (color == static_cast<int>(coloring.sets.size()))
+            coloring.sets.emplace_back();
+
+        const auto eIdx = gridGeometry.elementMapper().index(element);
+        coloring.colors[eIdx] = color;
+        coloring.sets[color].push_back(eIdx);
+        for (unsigned int i = 0; i < numCorners; ++i)
+            vertexColors[gridGeometry.vertexMapper().subIndex(element, i, dim)].push_back(color);
+    }
+
+    return coloring;
+}
+
+/*!
+ * \ingroup Parallel
+ * \brief Compute a greedy coloring of the elements of a grid of a cell-centered scheme such that
+ *        no two elements of the same color assemble into the same row of the Jacobian
+ *
+ * The local assembly of a cell-centered element writes the residual derivatives of the element itself
+ * and of all elements whose stencil contains it (given by the connectivity map of the grid geometry).
+ * The elements of one color can then be assembled concurrently.
+ *
+ * \param gridGeometry the grid geometry (providing the grid view, the element mapper and the connectivity map)
+ */
+template<class GridGeometry>
+ElementColoring computeConnectivityColoring(const GridGeometry& gridGeometry)
+{
+    const auto& gridView = gridGeometry.gridView();
+    const auto& connectivityMap = gridGeometry.connectivityMap();
+
+    ElementColoring coloring;
+    coloring.colors.assign(gridView.size(0), -1);
+
+    // the colors of the already colored elements assembling into each row
+    std::vector<std::vector<int>> rowColors(gridView.size(0));
+    std::vector<bool> isUsed;
+    for (const auto& element : elements(gridView))
+    {
+        const auto eIdx = gridGeometry.elementMapper().index(element);
+        const auto& connectivity = connectivityMap[eIdx];
+
+        // collect the colors of the elements assembling into the same rows
+        isUsed.assign(coloring.sets.size(), false);
+        for (const auto color : rowColors[eIdx])
+            isUsed[color] = true;
+        for (const auto& dataJ : connectivity)
+            for (const auto color : rowColors[dataJ.globalJ])
+                isUsed[color] = true;
+
+        // take the smallest free color (or add a new one)
+        const int color = std::distance(isUsed.begin(), std::find(isUsed.begin(), isUsed.end(), false));
+        if (color == static_cast<int>(coloring.sets.size()))
+            coloring.sets.emplace_back();
+
+        coloring.colors[eIdx] = color;
+        coloring.sets[color].push_back(eIdx);
+        rowColors[eIdx].push_back(color);
+        for (const auto& dataJ : connectivity)
+            rowColors[dataJ.globalJ].push_back(color);
+    }
+
+    return coloring;
+}
+
+} // end namespace Dumux
+
+#endif
@@ -0,0 +1,104 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*****************************************************************************
+ *   See the file COPYING for full copying permissions.                      *
+ *                                                                           *
+ *   This program is free software: you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by    *
+ *   the Free Software Foundation, either version 3 of the License, or       *
+ *   (at your option) any later version.                                     *
+ *                                                                           *
+ *   This program is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the            *
+ *   GNU General Public License for more details.                            *
+ *                                                                           *
+ *   You should have received a copy of the GNU General Public License       *
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.   *
+ *****************************************************************************/
+/*!
+ * \file
+ * \ingroup Parallel
+ * \brief Multithreading backends and the compile-time selection of the default backend
+ *
+ * The backend is selected by defining DUMUX_MULTITHREADING_BACKEND to one of
+ * Serial, Cpp (C++17 parallel algorithms), TBB or OpenMP before including any
+ * DuMux header (e.g. via the compile definitions of a target). If nothing is
+ * defined, all loops are executed serially.
+ */
+#ifndef DUMUX_PARALLEL_MULTITHREADING_HH
+#define DUMUX_PARALLEL_MULTITHREADING_HH
+
+#include <cstddef>
+#include <thread>
+#include <algorithm>
+#include <type_traits>
+
+#if __has_include(<execution>)
+#include <execution>
+#endif
+
+#if HAVE_TBB
+#include <tbb/task_arena.h>
+#endif
+
+#if _OPENMP
+#include <omp.h>
+#endif
+
+#if defined(__cpp_lib_parallel_algorithm) && __cpp_lib_parallel_algorithm >= 201603L
+#define DUMUX_HAVE_CPP_PARALLEL_ALGORITHMS 1
+#else
+#define DUMUX_HAVE_CPP_PARALLEL_ALGORITHMS 0
+#endif
+
+#ifndef DUMUX_MULTITHREADING_BACKEND
+#define DUMUX_MULTITHREADING_BACKEND Serial
+#endif
+
+namespace Dumux::Multithreading {
+
+namespace ExecutionBackends {
+
+//! execute everything in the calling thread
+struct Serial {};
+//! use the C++17 parallel algorithms with std::execution::par_unseq
+struct Cpp {};
+//! use Intel Threading Building Blocks
+struct TBB {};
+//! use OpenMP worksharing loops
+struct OpenMP {};
+
+} // end namespace ExecutionBackends
+
+//! the execution backend selected at compile time
+using DefaultExecutionBackend = ExecutionBackends::DUMUX_MULTITHREADING_BACKEND;
+
+//! whether the selected backend may execute loop bodies concurrently
+inline constexpr bool isThreaded
+    = !std::is_same_v<DefaultExecutionBackend, ExecutionBackends::Serial>;
+
+/*!
+ * \brief The maximum number of threads the selected backend may use
+ * \note The Cpp backend does not expose its thread count, we report the hardware concurrency
+ */
+inline std::size_t maxThreads()
+{
+    using namespace ExecutionBackends;
+    if constexpr (std::is_same_v<DefaultExecutionBackend, Serial>)
+        return 1;
+#if HAVE_TBB
+    else if constexpr (std::is_same_v<DefaultExecutionBackend, TBB>)
+        return tbb::this_task_arena::max_concurrency();
+#endif
+#if _OPENMP
+    else if constexpr (std::is_same_v<DefaultExecutionBackend, OpenMP>)
+        return omp_get_max_threads();
+#endif
+    else
+        return std::max<std::size_t>(1, std::thread::hardware_concurrency());
+}
+
+} // end namespace Dumux::Multithreading
+
+#endif
@@ -0,0 +1,153 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*****************************************************************************
+ *   See the file COPYING for full copying permissions.                      *
+ *                                                                           *
+ *   This program is free software: you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by    *
+ *   the Free Software Foundation, either version 3 of the License, or       *
+ *   (at your option) any later version.                                     *
+ *                                                                           *
+ *   This program is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the            *
+ *   GNU General Public License for more details.                            *
+ *                                                                           *
+ *   You should have received a copy of the GNU General Public License       *
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.   *
+ *****************************************************************************/
+/*!
+ * \file
+ * \ingroup Parallel
+ * \brief Storage of one object per thread (e.g. reusable workspaces)
+ */
+#ifndef DUMUX_PARALLEL_THREAD_LOCAL_STORAGE_HH
+#define DUMUX_PARALLEL_THREAD_LOCAL_STORAGE_HH
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <functional>
+
+#include <dumux/parallel/multithreading.hh>
+
+namespace Dumux {
+
+/*!
+ * \ingroup Parallel
+ * \brief Storage of one object per thread
+ *
+ * Each thread calling local() obtains its own object, which is created with the
+ * given factory on the first call of the thread and kept for the lifetime of the storage.
+ * This can be used for workspaces (e.g. local views of the grid geometry and grid variables)
+ * that are reused for successive elements, such that memory is only allocated once per thread.
+ * If the selected multithreading backend is serial, only a single object is created and
+ * no synchronization takes place.
+ *
+ * \note local() is thread-safe. The objects are stored on the heap, references returned
+ *       by local() stay valid until clear() is called or the storage is destroyed.
+ * \note Each thread remembers the object it obtained last (per object type), such that repeated calls
+ *       of local() on the same storage neither lock nor search.
+ * \tparam T the type of the stored objects
+ */
+template<class T>
+class ThreadLocalStorage
+{
+public:
+    /*!
+     * \brief Constructor
+     * \param factory a callable returning a new object (called once per thread)
+     */
+    template<class Factory>
+    explicit ThreadLocalStorage(Factory&& factory)
+    : factory_(std::forward<Factory>(factory))
+    , id_(nextId_())
+    {}
+
+    ThreadLocalStorage(const ThreadLocalStorage&) = delete;
+    ThreadLocalStorage& operator=(const ThreadLocalStorage&) = delete;
+
+    //! the object of the calling thread
+    T& local()
+    {
+        if constexpr (!Multithreading::isThreaded)
+        {
+            if (objects_.empty())
+                objects_.emplace_back(std::thread::id{}, std::make_unique<T>(factory_()));
+            return *objects_.front().second;
+        }
+        else
+        {
+            // the object of the storage the calling thread used last (storage ids are unique)
+            thread_local std::pair<std::size_t, T*> lastUsed(0, nullptr);
+            if (lastUsed.first == id_)
+                return *lastUsed.second;
+
+            const auto id = std::this_thread::get_id();
+            T* obj = nullptr;
+            {
+                std::shared_lock<std::shared_mutex> lock(mutex_);
+                obj = find_(id);
+            }
+
+            if (!obj)
+            {
+                // construct outside of the lock, the factory might be expensive
+                auto newObj = std::make_unique<T>(factory_());
+                std::unique_lock<std::shared_mutex> lock(mutex_);
+                objects_.emplace_back(id, std::move(newObj));
+                obj = objects_.back().second.get();
+            }
+
+            lastUsed = {id_, obj};
+            return *obj;
+        }
+    }
+
+    //! apply a function to the objects of all threads (not thread-safe)
+    template<class F>
+    void forEach(F&& f)
+    {
+        for (auto& obj : objects_)
+            f(*obj.second);
+    }
+
+    //! the number of created objects
+    std::size_t size() const
+    { return objects_.size(); }
+
+    //! remove the objects of all threads (not thread-safe)
+    void clear()
+    {
+        objects_.clear();
+        id_ = nextId_(); // invalidate the objects remembered by the threads
+    }
+
+private:
+    T* find_(std::thread::id id) const
+    {
+        auto it = std::find_if(objects_.begin(), objects_.end(), [id](const auto& obj){ return obj.first == id; });
+        return it != objects_.end() ? it->second.get() : nullptr;
+    }
+
+    // a unique id for each storage (and each state after clear()), starting at 1
+    static std::size_t nextId_()
+    {
+        static std::atomic<std::size_t> counter(0);
+        return ++counter;
+    }
+
+    std::function<T()> factory_;
+    std::size_t id_;
+    std::vector<std::pair<std::thread::id, std::unique_ptr<T>>> objects_;
+    mutable std::shared_mutex mutex_;
+};
+
+} // end namespace Dumux
+
+#endif
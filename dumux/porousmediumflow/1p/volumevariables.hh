@@ -28,6 +28,7 @@
 #include <dumux/porousmediumflow/volumevariables.hh>
 #include <dumux/porousmediumflow/nonisothermal/volumevariables.hh>
 #include <dumux/material/fluidstates/immiscible.hh>
+#include <dumux/material/fluidsystems/pressurederivatives.hh>
 #include <dumux/material/solidstates/updatesolidvolumefractions.hh>
 
 namespace Dumux {
@@ -177,6 +178,24 @@ public:
     Scalar viscosity(int phaseIdx = 0) const
     { return fluidState_.viscosity(phaseIdx); }
 
+    /*!
+     * \brief Returns the derivative of the density w.r.t. the pressure \f$\mathrm{[kg/(m^3 Pa)]}\f$
+     *        (computed on demand, used for analytic Jacobians).
+     *
+     * \param phaseIdx The phase index
+     */
+    Scalar dDensity_dP(int phaseIdx = 0) const
+    { return densityPressureDerivative<FluidSystem>(fluidState_, phaseIdx); }
+
+    /*!
+     * \brief Returns the derivative of the dynamic viscosity w.r.t. the pressure \f$\mathrm{[s]}\f$
+     *        (computed on demand, used for analytic Jacobians).
+     *
+     * \param phaseIdx The phase index
+     */
+    Scalar dViscosity_dP(int phaseIdx = 0) const
+    { return viscosityPressureDerivative<FluidSystem>(fluidState_, phaseIdx); }
+
     /*!
      * \brief Returns the mobility \f$\mathrm{[1/(Pa s)]}\f$.
      *
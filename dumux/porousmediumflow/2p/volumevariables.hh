@@ -29,6 +29,7 @@
 #include <dumux/porousmediumflow/volumevariables.hh>
 #include <dumux/porousmediumflow/nonisothermal/volumevariables.hh>
 #include <dumux/material/solidstates/updatesolidvolumefractions.hh>
+#include <dumux/material/fluidsystems/pressurederivatives.hh>
 #include <dumux/porousmediumflow/2p/formulation.hh>
 
 #include <dumux/common/deprecated.hh>
@@ -274,6 +275,24 @@ public:
     Scalar viscosity(int phaseIdx) const
     { return fluidState_.viscosity(phaseIdx); }
 
+    /*!
+     * \brief Returns the derivative of the density of a phase w.r.t. its pressure
+     *        \f$\mathrm{[kg/(m^3 Pa)]}\f$ (computed on demand, used for analytic Jacobians).
+     *
+     * \param phaseIdx The phase index
+     */
+    Scalar dDensity_dP(int phaseIdx) const
+    { return densityPressureDerivative<FluidSystem>(fluidState_, phaseIdx); }
+
+    /*!
+     * \brief Returns the derivative of the dynamic viscosity of a phase w.r.t. its pressure
+     *        \f$\mathrm{[s]}\f$ (computed on demand, used for analytic Jacobians).
+     *
+     * \param phaseIdx The phase index
+     */
+    Scalar dViscosity_dP(int phaseIdx) const
+    { return viscosityPressureDerivative<FluidSystem>(fluidState_, phaseIdx); }
+
     /*!
      * \brief Returns the effective mobility of a given phase within
      *        the control volume in \f$[s*m/kg]\f$.
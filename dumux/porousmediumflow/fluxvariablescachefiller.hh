@@ -328,6 +328,58 @@ public:
         }
     }
 
+    /*!
+     * \brief function to fill the flux variables caches of an interaction volume that has been
+     *        created beforehand (without being bound) and whose index in the container is set in the caches.
+     *        The interaction volume is bound and all its data (e.g. transmissibilities) is computed.
+     * \note This allows to compute the data of different interaction volumes concurrently.
+     *
+     * \param fluxVarsCacheStorage Class that holds the scvf flux vars caches
+     * \param scvfFluxVarsCache The flux var cache to be updated corresponding to the given scvf
+     * \param ivDataStorage Class that stores the interaction volumes & handles
+     * \param element The finite element
+     * \param fvGeometry The finite volume geometry
+     * \param elemVolVars The element volume variables (primary/secondary variables)
+     * \param scvf The corresponding sub-control volume face
+     */
+    template<class FluxVarsCacheStorage, class FluxVariablesCache, class IVDataStorage>
+    void fillCreated(FluxVarsCacheStorage& fluxVarsCacheStorage,
+                     FluxVariablesCache& scvfFluxVarsCache,
+                     IVDataStorage& ivDataStorage,
+                     const Element& element,
+                     const FVElementGeometry& fvGeometry,
+                     const ElementVolumeVariables& elemVolVars,
+                     const SubControlVolumeFace& scvf)
+    {
+        // Set pointers
+        elementPtr_ = &element;
+        fvGeometryPtr_ = &fvGeometry;
+        elemVolVarsPtr_ = &elemVolVars;
+        const auto& gridGeometry = fvGeometry.gridGeometry();
+        const auto ivIndexInContainer = scvfFluxVarsCache.ivIndexInContainer();
+
+        if (gridGeometry.vertexUsesSecondaryInteractionVolume(scvf.vertexIndex()))
+        {
+            const auto& indexSet = gridGeometry.gridInteractionVolumeIndexSets().secondaryIndexSet(scvf);
+            secondaryIv_ = &ivDataStorage.secondaryInteractionVolumes[ivIndexInContainer];
+            secondaryIv_->bind(indexSet, problem(), fvGeometry);
+
+            secondaryIvDataHandle_ = &ivDataStorage.secondaryDataHandles[ivIndexInContainer];
+            prepareDataHandle_(*secondaryIv_, *secondaryIvDataHandle_, /*forceUpdateAll*/true);
+            fillCachesInInteractionVolume_<FluxVariablesCache>(fluxVarsCacheStorage, *secondaryIv_, ivIndexInContainer);
+        }
+        else
+        {
+            const auto& indexSet = gridGeometry.gridInteractionVolumeIndexSets().primaryIndexSet(scvf);
+            primaryIv_ = &ivDataStorage.primaryInteractionVolumes[ivIndexInContainer];
+            primaryIv_->bind(indexSet, problem(), fvGeometry);
+
+            primaryIvDataHandle_ = &ivDataStorage.primaryDataHandles[ivIndexInContainer];
+            prepareDataHandle_(*primaryIv_, *primaryIvDataHandle_, /*forceUpdateAll*/true);
+            fillCachesInInteractionVolume_<FluxVariablesCache>(fluxVarsCacheStorage, *primaryIv_, ivIndexInContainer);
+        }
+    }
+
     //! returns the stored interaction volume pointer
     const PrimaryInteractionVolume& primaryInteractionVolume() const
     { return *primaryIv_; }
@@ -25,7 +25,21 @@
 #ifndef DUMUX_IMMISCIBLE_LOCAL_RESIDUAL_HH
 #define DUMUX_IMMISCIBLE_LOCAL_RESIDUAL_HH
 
+#include <array>
+#include <cmath>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#include <dune/common/exceptions.hh>
+
 #include <dumux/common/properties.hh>
+#include <dumux/common/parameters.hh>
+#include <dumux/common/deprecated.hh>
+#include <dumux/discretization/method.hh>
+#include <dumux/discretization/extrusion.hh>
+#include <dumux/discretization/elementsolution.hh>
+#include <dumux/porousmediumflow/2p/formulation.hh>
 
 namespace Dumux {
 
@@ -33,6 +47,15 @@ namespace Dumux {
  * \ingroup PorousmediumflowModels
  * \brief Element-wise calculation of the residual for problems
  *        using the n-phase immiscible fully implicit models.
+ *
+ * For the isothermal one-phase and two-phase models, the residual also provides the
+ * derivatives for analytic Jacobian assembly (DiffMethod::analytic) with the cell-centered
+ * tpfa and the box scheme, including compressible fluids and pressure-dependent viscosities.
+ * The derivatives of the densities and viscosities w.r.t. pressure are provided by the volume
+ * variables, those of the relative permeabilities and the capillary pressure by the material law.
+ * It is assumed that the porosity and the permeability do not depend on the primary variables
+ * and that Neumann boundary fluxes and sources are solution-independent (unless the problem
+ * implements addSourceDerivatives).
  */
 template<class TypeTag>
 class ImmiscibleLocalResidual : public GetPropType<TypeTag, Properties::BaseLocalResidual>
@@ -48,14 +71,27 @@ class ImmiscibleLocalResidual : public GetPropType<TypeTag, Properties::BaseLoca
     using FVElementGeometry = typename GetPropType<TypeTag, Properties::GridGeometry>::LocalView;
     using SubControlVolume = typename FVElementGeometry::SubControlVolume;
     using SubControlVolumeFace = typename FVElementGeometry::SubControlVolumeFace;
-    using GridView = typename GetPropType<TypeTag, Properties::GridGeometry>::GridView;
+    using GridGeometry = GetPropType<TypeTag, Properties::GridGeometry>;
+    using GridView = typename GridGeometry::GridView;
     using Element = typename GridView::template Codim<0>::Entity;
     using EnergyLocalResidual = GetPropType<TypeTag, Properties::EnergyLocalResidual>;
+    using Extrusion = Extrusion_t<GridGeometry>;
 
     using ModelTraits = GetPropType<TypeTag, Properties::ModelTraits>;
     static constexpr int numPhases = ModelTraits::numFluidPhases();
+    static constexpr int numEq = ModelTraits::numEq();
     static constexpr int conti0EqIdx = ModelTraits::Indices::conti0EqIdx; //!< first index for the mass balance
 
+    //! the derivatives of the phase quantities of a control volume w.r.t. its primary variables
+    struct VolVarsDerivatives
+    {
+        using Matrix = std::array<std::array<Scalar, numEq>, numPhases>;
+        Matrix dPressure;   //!< derivatives of the phase pressures
+        Matrix dSaturation; //!< derivatives of the phase saturations
+        Matrix dDensity;    //!< derivatives of the phase densities
+        Matrix dUpwindTerm; //!< derivatives of the upwinded terms (density times mobility)
+    };
+
 public:
     using ParentType::ParentType;
 
@@ -134,6 +170,364 @@ public:
 
         return flux;
     }
+
+    /*!
+     * \brief Adds the derivatives of the storage term w.r.t. the primary variables
+     *
+     * \param partialDerivatives The partial derivatives
+     * \param problem The problem
+     * \param element The element
+     * \param fvGeometry The finite volume element geometry
+     * \param curVolVars The current volume variables
+     * \param scv The sub control volume
+     */
+    template<class PartialDerivativeMatrix>
+    void addStorageDerivatives(PartialDerivativeMatrix& partialDerivatives,
+                               const Problem& problem,
+                               const Element& element,
+                               const FVElementGeometry& fvGeometry,
+                               const VolumeVariables& curVolVars,
+                               const SubControlVolume& scv) const
+    {
+        const auto d = volVarsDerivatives_(problem, element, fvGeometry, scv, curVolVars);
+        const auto poreVolume = Extrusion::volume(scv)*curVolVars.extrusionFactor()*curVolVars.porosity();
+        const auto dt = this->timeLoop().timeStepSize();
+
+        for (int phaseIdx = 0; phaseIdx < numPhases; ++phaseIdx)
+            for (int pvIdx = 0; pvIdx < numEq; ++pvIdx)
+                partialDerivatives[conti0EqIdx+phaseIdx][pvIdx]
+                    += poreVolume/dt*(d.dDensity[phaseIdx][pvIdx]*curVolVars.saturation(phaseIdx)
+                                      + curVolVars.density(phaseIdx)*d.dSaturation[phaseIdx][pvIdx]);
+    }
+
+    /*!
+     * \brief Adds the derivatives of the source term (forwarded to the problem)
+     *
+     * \param partialDerivatives The partial derivatives
+     * \param problem The problem
+     * \param element The element
+     * \param fvGeometry The finite volume element geometry
+     * \param curVolVars The current volume variables
+     * \param scv The sub control volume
+     */
+    template<class PartialDerivativeMatrix>
+    void addSourceDerivatives(PartialDerivativeMatrix& partialDerivatives,
+                              const Problem& problem,
+                              const Element& element,
+                              const FVElementGeometry& fvGeometry,
+                              const VolumeVariables& curVolVars,
+                              const SubControlVolume& scv) const
+    {
+        problem.addSourceDerivatives(partialDerivatives, element, fvGeometry, curVolVars, scv);
+    }
+
+    /*!
+     * \brief Adds the derivatives of the advective fluxes for the cell-centered tpfa scheme
+     *
+     * \param derivativeMatrices The partial derivatives w.r.t. the primary variables of the stencil elements
+     * \param problem The problem
+     * \param element The element
+     * \param fvGeometry The finite volume element geometry
+     * \param curElemVolVars The current element volume variables
+     * \param elemFluxVarsCache The element flux variables cache
+     * \param scvf The sub control volume face
+     */
+    template<class PartialDerivativeMatrices, class T = TypeTag>
+    std::enable_if_t<GetPropType<T, Properties::GridGeometry>::discMethod == DiscretizationMethod::cctpfa, void>
+    addFluxDerivatives(PartialDerivativeMatrices& derivativeMatrices,
+                       const Problem& problem,
+                       const Element& element,
+                       const FVElementGeometry& fvGeometry,
+                       const ElementVolumeVariables& curElemVolVars,
+                       const ElementFluxVariablesCache& elemFluxVarsCache,
+                       const SubControlVolumeFace& scvf) const
+    {
+        if (scvf.numOutsideScvs() > 1)
+            DUNE_THROW(Dune::NotImplemented, "Analytic flux derivatives for scvfs with several neighbors (network grids)");
+
+        addTpfaFluxDerivatives_(derivativeMatrices, problem, element, fvGeometry, curElemVolVars, elemFluxVarsCache, scvf);
+    }
+
+    /*!
+     * \brief Adds the derivatives of the advective fluxes for the box scheme
+     *
+     * \param A The Jacobian matrix
+     * \param problem The problem
+     * \param element The element
+     * \param fvGeometry The finite volume element geometry
+     * \param curElemVolVars The current element volume variables
+     * \param elemFluxVarsCache The element flux variables cache
+     * \param scvf The sub control volume face
+     */
+    template<class JacobianMatrix, class T = TypeTag>
+    std::enable_if_t<GetPropType<T, Properties::GridGeometry>::discMethod == DiscretizationMethod::box, void>
+    addFluxDerivatives(JacobianMatrix& A,
+                       const Problem& problem,
+                       const Element& element,
+                       const FVElementGeometry& fvGeometry,
+                       const ElementVolumeVariables& curElemVolVars,
+                       const ElementFluxVariablesCache& elemFluxVarsCache,
+                       const SubControlVolumeFace& scvf) const
+    {
+        using AdvectionType = GetPropType<T, Properties::AdvectionType>;
+        static const Scalar upwindWeight = getParamFromGroup<Scalar>(problem.paramGroup(), "Flux.UpwindWeight");
+        static const bool enableGravity = getParamFromGroup<bool>(problem.paramGroup(), "Problem.EnableGravity");
+
+        const auto ti = AdvectionType::calculateTransmissibilities(problem, element, fvGeometry, curElemVolVars,
+                                                                   scvf, elemFluxVarsCache[scvf]);
+        const auto& shapeValues = elemFluxVarsCache[scvf].shapeValues();
+
+        const auto& insideScv = fvGeometry.scv(scvf.insideScvIdx());
+        const auto& outsideScv = fvGeometry.scv(scvf.outsideScvIdx());
+        const auto& insideVolVars = curElemVolVars[insideScv];
+        const auto& outsideVolVars = curElemVolVars[outsideScv];
+
+        // the pressure gradient in the flux depends on the primary variables of all scvs of the element
+        // we compute their derivatives once per element, i.e. for its first scvf (the inner scvfs come first)
+        const auto eIdx = fvGeometry.gridGeometry().elementMapper().index(element);
+        if (scvf.index() == 0 || eIdx != boxDerivativesElementIdx_)
+        {
+            boxDerivatives_.resize(fvGeometry.numScv());
+            for (const auto& scv : scvs(fvGeometry))
+                boxDerivatives_[scv.indexInElement()] = volVarsDerivatives_(problem, element, fvGeometry, scv, curElemVolVars[scv]);
+            boxDerivativesElementIdx_ = eIdx;
+        }
+        const auto& d = boxDerivatives_;
+
+        for (int phaseIdx = 0; phaseIdx < numPhases; ++phaseIdx)
+        {
+            // the Darcy flux is the sum of ti*p_i over all scvs and the gravity term rho*g (rho interpolated)
+            const auto flux = AdvectionType::flux(problem, element, fvGeometry, curElemVolVars, scvf, phaseIdx, elemFluxVarsCache);
+            Scalar pressureFlux = 0.0, rho = 0.0;
+            for (const auto& scv : scvs(fvGeometry))
+            {
+                pressureFlux += ti[scv.indexInElement()]*curElemVolVars[scv].pressure(phaseIdx);
+                rho += shapeValues[scv.indexInElement()][0]*curElemVolVars[scv].density(phaseIdx);
+            }
+            const Scalar gravityFluxPerDensity = (enableGravity && rho != 0.0) ? (flux - pressureFlux)/rho : 0.0;
+
+            const auto insideWeight = std::signbit(flux) ? (1.0 - upwindWeight) : upwindWeight;
+            const auto outsideWeight = 1.0 - insideWeight;
+            const auto upwindTerm = insideWeight*insideVolVars.density(phaseIdx)*insideVolVars.mobility(phaseIdx)
+                                    + outsideWeight*outsideVolVars.density(phaseIdx)*outsideVolVars.mobility(phaseIdx);
+
+            const auto eqIdx = conti0EqIdx + phaseIdx;
+            for (const auto& scvJ : scvs(fvGeometry))
+            {
+                const auto localJ = scvJ.indexInElement();
+                const auto& dJ = d[localJ];
+                for (int pvIdx = 0; pvIdx < numEq; ++pvIdx)
+                {
+                    const auto dFlux = ti[localJ]*dJ.dPressure[phaseIdx][pvIdx]
+                                       + gravityFluxPerDensity*shapeValues[localJ][0]*dJ.dDensity[phaseIdx][pvIdx];
+                    auto deriv = upwindTerm*dFlux;
+                    if (localJ == insideScv.indexInElement())
+                        deriv += insideWeight*dJ.dUpwindTerm[phaseIdx][pvIdx]*flux;
+                    if (localJ == outsideScv.indexInElement())
+                        deriv += outsideWeight*dJ.dUpwindTerm[phaseIdx][pvIdx]*flux;
+
+                    A[insideScv.dofIndex()][scvJ.dofIndex()][eqIdx][pvIdx] += deriv;
+                    A[outsideScv.dofIndex()][scvJ.dofIndex()][eqIdx][pvIdx] -= deriv;
+                }
+            }
+        }
+    }
+
+    /*!
+     * \brief Adds the derivatives of the advective fluxes over Dirichlet boundaries for the cell-centered tpfa scheme
+     *
+     * \param derivativeMatrices The partial derivatives w.r.t. the primary variables of the stencil elements
+     * \param problem The problem
+     * \param element The element
+     * \param fvGeometry The finite volume element geometry
+     * \param curElemVolVars The current element volume variables
+     * \param elemFluxVarsCache The element flux variables cache
+     * \param scvf The sub control volume face
+     */
+    template<class PartialDerivativeMatrices, class T = TypeTag>
+    std::enable_if_t<GetPropType<T, Properties::GridGeometry>::discMethod == DiscretizationMethod::cctpfa, void>
+    addCCDirichletFluxDerivatives(PartialDerivativeMatrices& derivativeMatrices,
+                                  const Problem& problem,
+                                  const Element& element,
+                                  const FVElementGeometry& fvGeometry,
+                                  const ElementVolumeVariables& curElemVolVars,
+                                  const ElementFluxVariablesCache& elemFluxVarsCache,
+                                  const SubControlVolumeFace& scvf) const
+    {
+        addTpfaFluxDerivatives_(derivativeMatrices, problem, element, fvGeometry, curElemVolVars, elemFluxVarsCache, scvf);
+    }
+
+    /*!
+     * \brief Adds the derivatives of Robin-type boundary fluxes
+     * \note Neumann fluxes are assumed to be solution-independent. Problems with
+     *       solution-dependent Neumann fluxes have to provide their own local residual.
+     */
+    template<class PartialDerivativeMatrices>
+    void addRobinFluxDerivatives(PartialDerivativeMatrices& derivativeMatrices,
+                                 const Problem& problem,
+                                 const Element& element,
+                                 const FVElementGeometry& fvGeometry,
+                                 const ElementVolumeVariables& curElemVolVars,
+                                 const ElementFluxVariablesCache& elemFluxVarsCache,
+                                 const SubControlVolumeFace& scvf) const
+    {}
+
+private:
+    //! the flux derivatives for tpfa (interior faces and Dirichlet boundary faces)
+    template<class PartialDerivativeMatrices>
+    void addTpfaFluxDerivatives_(PartialDerivativeMatrices& derivativeMatrices,
+                                 const Problem& problem,
+                                 const Element& element,
+                                 const FVElementGeometry& fvGeometry,
+                                 const ElementVolumeVariables& curElemVolVars,
+                                 const ElementFluxVariablesCache& elemFluxVarsCache,
+                                 const SubControlVolumeFace& scvf) const
+    {
+        using AdvectionType = GetPropType<TypeTag, Properties::AdvectionType>;
+        static const Scalar upwindWeight = getParamFromGroup<Scalar>(problem.paramGroup(), "Flux.UpwindWeight");
+
+        const auto insideScvIdx = scvf.insideScvIdx();
+        const auto outsideScvIdx = scvf.outsideScvIdx();
+        const auto& insideScv = fvGeometry.scv(insideScvIdx);
+        const auto& insideVolVars = curElemVolVars[insideScvIdx];
+        const auto& outsideVolVars = curElemVolVars[outsideScvIdx];
+
+        // on Dirichlet boundaries, the outside volume variables are fixed
+        const bool boundary = scvf.boundary();
+        const auto dInside = volVarsDerivatives_(problem, element, fvGeometry, insideScv, insideVolVars);
+        const auto dOutside = boundary ? VolVarsDerivatives{}
+                                       : volVarsDerivatives_(problem, fvGeometry.gridGeometry().element(outsideScvIdx),
+                                                             fvGeometry, fvGeometry.scv(outsideScvIdx), outsideVolVars);
+
+        const auto tij = elemFluxVarsCache[scvf].advectionTij();
+        auto& dI_dI = derivativeMatrices[insideScvIdx];
+
+        for (int phaseIdx = 0; phaseIdx < numPhases; ++phaseIdx)
+        {
+            // the Darcy flux is tij*(p_I - p_J) plus a gravity term proportional to the averaged density
+            // (the boundary density on boundaries), which we extract from the flux
+            const auto flux = AdvectionType::flux(problem, element, fvGeometry, curElemVolVars, scvf, phaseIdx, elemFluxVarsCache);
+            const auto pressureFlux = tij*(insideVolVars.pressure(phaseIdx) - outsideVolVars.pressure(phaseIdx));
+            const auto rho = 0.5*(insideVolVars.density(phaseIdx) + outsideVolVars.density(phaseIdx));
+            const Scalar gravityFluxPerDensity = (!boundary && rho != 0.0) ? (flux - pressureFlux)/rho : 0.0;
+
+            const auto insideWeight = std::signbit(flux) ? (1.0 - upwindWeight) : upwindWeight;
+            const auto outsideWeight = 1.0 - insideWeight;
+            const auto upwindTerm = insideWeight*insideVolVars.density(phaseIdx)*insideVolVars.mobility(phaseIdx)
+                                    + outsideWeight*outsideVolVars.density(phaseIdx)*outsideVolVars.mobility(phaseIdx);
+
+            const auto eqIdx = conti0EqIdx + phaseIdx;
+            for (int pvIdx = 0; pvIdx < numEq; ++pvIdx)
+            {
+                const auto dFlux_dI = tij*dInside.dPressure[phaseIdx][pvIdx]
+                                      + 0.5*gravityFluxPerDensity*dInside.dDensity[phaseIdx][pvIdx];
+                dI_dI[eqIdx][pvIdx] += insideWeight*dInside.dUpwindTerm[phaseIdx][pvIdx]*flux + upwindTerm*dFlux_dI;
+
+                if (!boundary)
+                {
+                    const auto dFlux_dJ = -tij*dOutside.dPressure[phaseIdx][pvIdx]
+                                          + 0.5*gravityFluxPerDensity*dOutside.dDensity[phaseIdx][pvIdx];
+                    derivativeMatrices[outsideScvIdx][eqIdx][pvIdx] += outsideWeight*dOutside.dUpwindTerm[phaseIdx][pvIdx]*flux + upwindTerm*dFlux_dJ;
+                }
+            }
+        }
+    }
+
+    //! the derivatives of the phase quantities of a control volume w.r.t. its primary variables
+    VolVarsDerivatives volVarsDerivatives_(const Problem& problem,
+                                           const Element& element,
+                                           const FVElementGeometry& fvGeometry,
+                                           const SubControlVolume& scv,
+                                           const VolumeVariables& volVars) const
+    {
+        static_assert(numPhases <= 2, "Analytic derivatives are only implemented for the one-phase and two-phase models");
+        static_assert(!ModelTraits::enableEnergyBalance(), "Analytic derivatives are only implemented for isothermal models");
+
+        static constexpr int pressureIdx = ModelTraits::Indices::pressureIdx;
+
+        VolVarsDerivatives d{};
+        std::array<std::array<Scalar, numEq>, numPhases> dKr{};
+        if constexpr (numPhases == 1)
+        {
+            d.dPressure[0][pressureIdx] = 1.0;
+        }
+        else
+        {
+            static constexpr int saturationIdx = ModelTraits::Indices::saturationIdx;
+            static constexpr bool p0s1 = ModelTraits::priVarFormulation() == TwoPFormulation::p0s1;
+
+            // old material law interface is deprecated: Replace this by
+            // const auto& fluidMatrixInteraction = problem.spatialParams().fluidMatrixInteraction(element, scv, elemSol);
+            // after the release of 3.3, when the deprecated interface is no longer supported
+            const auto elemSol = scvElementSolution_(element, fvGeometry, scv, volVars);
+            const auto fluidMatrixInteraction = Deprecated::makePcKrSw(Scalar{}, problem.spatialParams(), element, scv, elemSol);
+
+            // the phase of the pressure and the phase of the saturation primary variable
+            const int pPhaseIdx = p0s1 ? 0 : 1;
+            const int sPhaseIdx = 1 - pPhaseIdx;
+            const int wPhaseIdx = volVars.wettingPhase();
+            const int nPhaseIdx = 1 - wPhaseIdx;
+            const auto sw = volVars.saturation(wPhaseIdx);
+            const Scalar dSw_dS = (wPhaseIdx == sPhaseIdx) ? 1.0 : -1.0;
+
+            d.dSaturation[sPhaseIdx][saturationIdx] = 1.0;
+            d.dSaturation[pPhaseIdx][saturationIdx] = -1.0;
+
+            // the pressure of the other phase is p + pc if it is the nonwetting phase and p - pc otherwise
+            d.dPressure[pPhaseIdx][pressureIdx] = 1.0;
+            d.dPressure[sPhaseIdx][pressureIdx] = 1.0;
+            d.dPressure[sPhaseIdx][saturationIdx] = (sPhaseIdx == nPhaseIdx ? 1.0 : -1.0)*fluidMatrixInteraction.dpc_dsw(sw)*dSw_dS;
+
+            dKr[wPhaseIdx][saturationIdx] = fluidMatrixInteraction.dkrw_dsw(sw)*dSw_dS;
+            dKr[nPhaseIdx][saturationIdx] = fluidMatrixInteraction.dkrn_dsw(sw)*dSw_dS;
+        }
+
+        // derivatives of density and upwind term rho*kr/mu (mobility = kr/mu)
+        for (int phaseIdx = 0; phaseIdx < numPhases; ++phaseIdx)
+        {
+            const auto rho = volVars.density(phaseIdx);
+            const auto mu = volVars.viscosity(phaseIdx);
+            const auto kr = volVars.mobility(phaseIdx)*mu;
+            const auto dRho_dP = volVars.dDensity_dP(phaseIdx);
+            const auto dMu_dP = volVars.dViscosity_dP(phaseIdx);
+            for (int pvIdx = 0; pvIdx < numEq; ++pvIdx)
+            {
+                const auto dRho = dRho_dP*d.dPressure[phaseIdx][pvIdx];
+                const auto dMu = dMu_dP*d.dPressure[phaseIdx][pvIdx];
+                d.dDensity[phaseIdx][pvIdx] = dRho;
+                d.dUpwindTerm[phaseIdx][pvIdx] = (dRho*kr + rho*dKr[phaseIdx][pvIdx])/mu - rho*kr*dMu/(mu*mu);
+            }
+        }
+
+        return d;
+    }
+
+    //! an element solution to evaluate the spatial parameters of an scv with
+    auto scvElementSolution_(const Element& element,
+                             const FVElementGeometry& fvGeometry,
+                             const SubControlVolume& scv,
+                             const VolumeVariables& volVars) const
+    {
+        if constexpr (GridGeometry::discMethod == DiscretizationMethod::box)
+        {
+            // only the primary variables of the scv itself are known here, use them for all vertices
+            struct ConstantSolution
+            {
+                const typename VolumeVariables::PrimaryVariables& priVars;
+                const auto& operator[](std::size_t) const { return priVars; }
+            };
+
+            BoxElementSolution<FVElementGeometry, typename VolumeVariables::PrimaryVariables> elemSol;
+            elemSol.update(element, ConstantSolution{volVars.priVars()}, fvGeometry);
+            return elemSol;
+        }
+        else
+            return elementSolution<FVElementGeometry>(volVars.priVars());
+    }
+
+    //! the derivatives for the scvs of the element (box) assembled last
+    mutable std::vector<VolVarsDerivatives> boxDerivatives_;
+    mutable std::size_t boxDerivativesElementIdx_ = std::numeric_limits<std::size_t>::max();
 };
 
 } // end namespace Dumux
@@ -0,0 +1,90 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/****************************************************************************
+ *   See the file COPYING for full copying permissions.                      *
+ *                                                                           *
+ *   This program is free software: you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by    *
+ *   the Free Software Foundation, either version 3 of the License, or       *
+ *   (at your option) any later version.                                     *
+ *                                                                           *
+ *   This program is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the            *
+ *   GNU General Public License for more details.                            *
+ *                                                                           *
+ *   You should have received a copy of the GNU General Public License       *
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.   *
+ *****************************************************************************/
+/*!
+ * \file
+ * \ingroup Assembly
+ * \brief Python bindings for the finite volume assembler
+ */
+
+#ifndef DUMUX_PYTHON_ASSEMBLY_FVASSEMBLER_HH
+#define DUMUX_PYTHON_ASSEMBLY_FVASSEMBLER_HH
+
+#include <memory>
+
+#include <dune/python/pybind11/pybind11.h>
+
+#include <dumux/common/timeloop.hh>
+#include <dumux/python/common/solutionvector.hh>
+
+namespace Dumux::Python {
+
+/*!
+ * \ingroup Assembly
+ * \brief Register a finite volume assembler (e.g. Dumux::FVAssembler)
+ *
+ * The residual is returned as a reference to the vector owned by the assembler
+ * (NumPy access without copying, see registerSolutionVector).
+ * \note The previous solution passed to the constructor for instationary problems is stored
+ *       by reference and has to be kept alive (and updated) by the caller.
+ */
+template <class Assembler, class... options>
+void registerFVAssembler(pybind11::handle scope, pybind11::class_<Assembler, options...> cls)
+{
+    using pybind11::operator""_a;
+
+    using Problem = typename Assembler::Problem;
+    using GridGeometry = typename Assembler::GridGeometry;
+    using GridVariables = typename Assembler::GridVariables;
+    using SolutionVector = typename Assembler::ResidualType;
+    using Scalar = typename Assembler::Scalar;
+    registerSolutionVector<SolutionVector>(scope);
+
+    cls.def(pybind11::init([](std::shared_ptr<const Problem> problem,
+                              std::shared_ptr<const GridGeometry> gridGeometry,
+                              std::shared_ptr<GridVariables> gridVariables){
+        return std::make_shared<Assembler>(problem, gridGeometry, gridVariables);
+    }), "problem"_a, "gridGeometry"_a, "gridVariables"_a);
+
+    cls.def(pybind11::init([](std::shared_ptr<const Problem> problem,
+                              std::shared_ptr<const GridGeometry> gridGeometry,
+                              std::shared_ptr<GridVariables> gridVariables,
+                              std::shared_ptr<const CheckPointTimeLoop<Scalar>> timeLoop,
+                              const SolutionVector& prevSol){
+        return std::make_shared<Assembler>(problem, gridGeometry, gridVariables, timeLoop, prevSol);
+    }), "problem"_a, "gridGeometry"_a, "gridVariables"_a, "timeLoop"_a, "prevSol"_a,
+        pybind11::keep_alive<1, 6>());
+
+    cls.def_property_readonly("numDofs", &Assembler::numDofs);
+    cls.def_property_readonly("isStationaryProblem", &Assembler::isStationaryProblem);
+    cls.def("residual", [](Assembler& self) -> SolutionVector& { return self.residual(); },
+            pybind11::return_value_policy::reference_internal);
+    cls.def("prevSol", &Assembler::prevSol, pybind11::return_value_policy::reference_internal);
+    cls.def("setPreviousSolution", &Assembler::setPreviousSolution, "sol"_a, pybind11::keep_alive<1, 2>());
+    cls.def("residualNorm", &Assembler::residualNorm, "sol"_a);
+    cls.def("assembleResidual", [](Assembler& self, const SolutionVector& sol){ self.assembleResidual(sol); }, "sol"_a);
+    cls.def("assembleJacobianAndResidual", [](Assembler& self, const SolutionVector& sol){
+        self.assembleJacobianAndResidual(sol);
+    }, "sol"_a);
+    cls.def("updateGridVariables", &Assembler::updateGridVariables, "sol"_a);
+    cls.def("resetTimeStep", &Assembler::resetTimeStep, "sol"_a);
+}
+
+} // end namespace Dumux::Python
+
+#endif
@@ -27,10 +27,13 @@
 #include <string>
 #include <memory>
 #include <tuple>
+#include <vector>
+#include <numeric>
 
 #include <dune/common/fvector.hh>
 #include <dune/common/exceptions.hh>
 #include <dune/python/pybind11/pybind11.h>
+#include <dune/python/pybind11/numpy.h>
 
 #include <dumux/common/boundarytypes.hh>
 #include <dumux/discretization/method.hh>
@@ -41,6 +44,19 @@ namespace Dumux::Python {
 /*!
  * \ingroup Common
  * \brief A C++ wrapper for a Python problem
+ *
+ * Calling into Python for every sub control volume (face) is expensive. The Python problem may
+ * therefore implement the vectorized methods
+ *  - boundaryTypesAtPosBatch(points) -> array (numPoints x numEq) of bool (true for Dirichlet)
+ *  - dirichletAtPosBatch(points) -> array (numPoints x numEq)
+ *  - neumannAtPosBatch(points) -> array (numPoints x numEq)
+ *  - sourceAtPosBatch(points) -> array (numPoints x numEq)
+ * which take a NumPy array (numPoints x dimWorld) of positions. If present, they are evaluated
+ * once for all dofs (box) / boundary faces (cell-centered), all boundary faces and all
+ * sub control volume centers when the problem is constructed and whenever update() is called
+ * (e.g. after the grid geometry changed). The per-entity interface is then served from the cached
+ * arrays (read via the buffer protocol without copying) instead of calling Python.
+ * Arrays of shape (numPoints,) are accepted for numEq = 1.
  */
 template<class GridGeometry_, class PrimaryVariables>
 class FVProblem
@@ -61,7 +77,86 @@ public:
 
     FVProblem(std::shared_ptr<const GridGeometry> gridGeometry, pybind11::object pyProblem)
     : gridGeometry_(gridGeometry), pyProblem_(pyProblem)
-    {}
+    , hasSource_(pybind11::hasattr(pyProblem, "source"))
+    , hasBoundaryTypesBatch_(pybind11::hasattr(pyProblem, "boundaryTypesAtPosBatch"))
+    , hasDirichletBatch_(pybind11::hasattr(pyProblem, "dirichletAtPosBatch"))
+    , hasNeumannBatch_(pybind11::hasattr(pyProblem, "neumannAtPosBatch"))
+    , hasSourceBatch_(pybind11::hasattr(pyProblem, "sourceAtPosBatch"))
+    {
+        update();
+    }
+
+    /*!
+     * \brief Evaluate the batch methods of the Python problem (if any) and cache the results
+     * \note Has to be called after the grid geometry has been updated
+     */
+    void update()
+    {
+        if (!hasBoundaryTypesBatch_ && !hasDirichletBatch_ && !hasNeumannBatch_ && !hasSourceBatch_)
+            return;
+
+        const auto& gg = *gridGeometry_;
+        const auto& gridView = gg.gridView();
+
+        // the scvs of an element are stored consecutively in the caches (the box scvfs as well,
+        // the cell-centered scvfs are identified by their global index)
+        scvOffset_.assign(gridView.size(0) + 1, 0);
+        scvfOffset_.assign(gridView.size(0) + 1, 0);
+        auto fvGeometry = localView(gg);
+        for (const auto& element : elements(gridView))
+        {
+            const auto eIdx = gg.elementMapper().index(element);
+            fvGeometry.bindElement(element);
+            scvOffset_[eIdx+1] = fvGeometry.numScv();
+            scvfOffset_[eIdx+1] = fvGeometry.numScvf();
+        }
+        std::partial_sum(scvOffset_.begin(), scvOffset_.end(), scvOffset_.begin());
+        std::partial_sum(scvfOffset_.begin(), scvfOffset_.end(), scvfOffset_.begin());
+
+        std::vector<GlobalPosition> scvCenters(scvOffset_.back()), boundaryFacePositions;
+        std::vector<GlobalPosition> dofPositions(isBox ? gg.numDofs() : 0);
+        boundaryScvfIdx_.assign(isBox ? scvfOffset_.back() : gg.numScvf(), -1);
+        for (const auto& element : elements(gridView))
+        {
+            fvGeometry.bindElement(element);
+            for (const auto& scv : scvs(fvGeometry))
+            {
+                scvCenters[scvCacheIndex_(element, scv)] = scv.center();
+                if constexpr (isBox)
+                    dofPositions[scv.dofIndex()] = scv.dofPosition();
+            }
+
+            for (const auto& scvf : scvfs(fvGeometry))
+            {
+                if (scvf.boundary())
+                {
+                    boundaryScvfIdx_[scvfCacheIndex_(element, scvf)] = boundaryFacePositions.size();
+                    boundaryFacePositions.push_back(scvf.ipGlobal());
+                }
+            }
+        }
+
+        // boundary types and Dirichlet values are evaluated at all dofs (box) or on the boundary faces (cell-centered)
+        const auto& boundaryPositions = isBox ? dofPositions : boundaryFacePositions;
+        if (hasBoundaryTypesBatch_)
+        {
+            const auto isDirichlet = evalBatch_("boundaryTypesAtPosBatch", boundaryPositions);
+            boundaryTypes_.assign(boundaryPositions.size(), BoundaryTypes{});
+            for (std::size_t i = 0; i < boundaryPositions.size(); ++i)
+                for (std::size_t eqIdx = 0; eqIdx < numEq; ++eqIdx)
+                    if (isDirichlet.value(i, eqIdx) != 0.0)
+                        boundaryTypes_[i].setDirichlet(eqIdx);
+                    else
+                        boundaryTypes_[i].setNeumann(eqIdx);
+        }
+
+        if (hasDirichletBatch_)
+            dirichlet_ = evalBatch_("dirichletAtPosBatch", boundaryPositions);
+        if (hasNeumannBatch_)
+            neumann_ = evalBatch_("neumannAtPosBatch", boundaryFacePositions);
+        if (hasSourceBatch_)
+            source_ = evalBatch_("sourceAtPosBatch", scvCenters);
+    }
 
     std::string name() const
     {
@@ -74,7 +169,11 @@ public:
         if constexpr (!isBox)
             DUNE_THROW(Dune::InvalidStateException, "boundaryTypes(..., scv) called for cell-centered method.");
         else
+        {
+            if (hasBoundaryTypesBatch_)
+                return boundaryTypes_[scv.dofIndex()];
             return pyProblem_.attr("boundaryTypes")(element, scv).template cast<BoundaryTypes>();
+        }
     }
 
     BoundaryTypes boundaryTypes(const Element &element,
@@ -83,7 +182,11 @@ public:
         if constexpr (isBox)
             DUNE_THROW(Dune::InvalidStateException, "boundaryTypes(..., scvf) called for box method.");
         else
+        {
+            if (hasBoundaryTypesBatch_)
+                return boundaryTypes_[boundaryScvfIdx_[scvfCacheIndex_(element, scvf)]];
             return pyProblem_.attr("boundaryTypes")(element, scvf).template cast<BoundaryTypes>();
+        }
     }
 
     PrimaryVariables dirichlet(const Element &element,
@@ -92,7 +195,11 @@ public:
         if constexpr (!isBox)
             DUNE_THROW(Dune::InvalidStateException, "dirichlet(scv) called for cell-centered method.");
         else
+        {
+            if (hasDirichletBatch_)
+                return dirichlet_.template get<PrimaryVariables>(scv.dofIndex());
             return pyProblem_.attr("dirichlet")(element, scv).template cast<PrimaryVariables>();
+        }
     }
 
     PrimaryVariables dirichlet(const Element &element,
@@ -101,7 +208,11 @@ public:
         if constexpr (isBox)
             DUNE_THROW(Dune::InvalidStateException, "dirichlet(scvf) called for box method.");
         else
+        {
+            if (hasDirichletBatch_)
+                return dirichlet_.template get<PrimaryVariables>(boundaryScvfIdx_[scvfCacheIndex_(element, scvf)]);
             return pyProblem_.attr("dirichlet")(element, scvf).template cast<PrimaryVariables>();
+        }
     }
 
     template<class ElementVolumeVariables, class ElementFluxVariablesCache>
@@ -111,6 +222,8 @@ public:
                         const ElementFluxVariablesCache& elemFluxVarsCache,
                         const SubControlVolumeFace& scvf) const
     {
+        if (hasNeumannBatch_)
+            return neumann_.template get<NumEqVector>(boundaryScvfIdx_[scvfCacheIndex_(element, scvf)]);
         return pyProblem_.attr("neumann")(element, fvGeometry, scvf).template cast<NumEqVector>();
     }
 
@@ -120,7 +233,12 @@ public:
                        const ElementVolumeVariables& elemVolVars,
                        const SubControlVolume &scv) const
     {
-        return pyProblem_.attr("source")(element, fvGeometry, scv).template cast<NumEqVector>();
+        if (hasSourceBatch_)
+            return source_.template get<NumEqVector>(scvCacheIndex_(element, scv));
+        else if (hasSource_)
+            return pyProblem_.attr("source")(element, fvGeometry, scv).template cast<NumEqVector>();
+        else
+            return sourceAtPos(scv.center());
     }
 
     NumEqVector sourceAtPos(const GlobalPosition &globalPos) const
@@ -146,8 +264,85 @@ public:
     { return *gridGeometry_; }
 
 private:
+    //! the result of a batch method (numPoints x numEq), accessed without copying
+    class BatchValues
+    {
+        using Array = pybind11::array_t<Scalar, pybind11::array::c_style | pybind11::array::forcecast>;
+    public:
+        BatchValues() = default;
+
+        BatchValues(pybind11::object values, std::size_t numPoints, const std::string& name)
+        : values_(Array::ensure(values))
+        {
+            if (!values_)
+                DUNE_THROW(Dune::InvalidStateException, name << " has to return an array");
+
+            const auto shape = [&](int i){ return static_cast<std::size_t>(values_.shape(i)); };
+            const bool validShape = values_.ndim() == 2 ? (shape(0) == numPoints && shape(1) == numEq)
+                                  : values_.ndim() == 1 && numEq == 1 && shape(0) == numPoints;
+            if (!validShape)
+                DUNE_THROW(Dune::InvalidStateException, name << " has to return an array of shape ("
+                                                        << numPoints << ", " << numEq << ")");
+            data_ = values_.data();
+        }
+
+        Scalar value(std::size_t i, std::size_t eqIdx) const
+        { return data_[i*numEq + eqIdx]; }
+
+        template<class Vector>
+        Vector get(std::size_t i) const
+        {
+            Vector v;
+            for (std::size_t eqIdx = 0; eqIdx < numEq; ++eqIdx)
+                v[eqIdx] = value(i, eqIdx);
+            return v;
+        }
+
+    private:
+        Array values_;
+        const Scalar* data_ = nullptr;
+    };
+
+    //! call a batch method of the Python problem with an array of positions
+    BatchValues evalBatch_(const std::string& name, const std::vector<GlobalPosition>& positions) const
+    {
+        static constexpr std::size_t dimWorld = GlobalPosition::dimension;
+        pybind11::array_t<Scalar> points(std::vector<std::size_t>{ positions.size(), dimWorld });
+        auto p = points.template mutable_unchecked<2>();
+        for (std::size_t i = 0; i < positions.size(); ++i)
+            for (std::size_t dimIdx = 0; dimIdx < dimWorld; ++dimIdx)
+                p(i, dimIdx) = positions[i][dimIdx];
+
+        return { pyProblem_.attr(name.c_str())(points), positions.size(), name };
+    }
+
+    //! the index of an scv in the caches
+    std::size_t scvCacheIndex_(const Element& element, const SubControlVolume& scv) const
+    { return scvOffset_[gridGeometry_->elementMapper().index(element)] + scv.indexInElement(); }
+
+    //! the index of an scvf in the caches
+    std::size_t scvfCacheIndex_(const Element& element, const SubControlVolumeFace& scvf) const
+    {
+        if constexpr (isBox)
+            return scvfOffset_[gridGeometry_->elementMapper().index(element)] + scvf.index();
+        else
+            return scvf.index();
+    }
+
     std::shared_ptr<const GridGeometry> gridGeometry_;
     pybind11::object pyProblem_;
+
+    bool hasSource_;
+    bool hasBoundaryTypesBatch_;
+    bool hasDirichletBatch_;
+    bool hasNeumannBatch_;
+    bool hasSourceBatch_;
+
+    std::vector<std::size_t> scvOffset_;
+    std::vector<std::size_t> scvfOffset_;
+    std::vector<long> boundaryScvfIdx_; //!< index among the boundary faces (-1 for interior faces)
+    std::vector<BoundaryTypes> boundaryTypes_;
+    BatchValues dirichlet_, neumann_, source_;
 };
 
 // Python wrapper for the above FVProblem C++ class
@@ -164,6 +359,7 @@ void registerFVProblem(pybind11::handle scope, pybind11::class_<Problem, options
 
     cls.def_property_readonly("name", &Problem::name);
     cls.def_property_readonly("numEq", [](Problem&){ return Problem::numEq; });
+    cls.def("update", &Problem::update);
 
     using GridView = typename GridGeometry::GridView;
     using Element = typename GridView::template Codim<0>::Entity;
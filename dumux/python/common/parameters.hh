@@ -0,0 +1,62 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/****************************************************************************
+ *   See the file COPYING for full copying permissions.                      *
+ *                                                                           *
+ *   This program is free software: you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by    *
+ *   the Free Software Foundation, either version 3 of the License, or       *
+ *   (at your option) any later version.                                     *
+ *                                                                           *
+ *   This program is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the            *
+ *   GNU General Public License for more details.                            *
+ *                                                                           *
+ *   You should have received a copy of the GNU General Public License       *
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.   *
+ *****************************************************************************/
+/*!
+ * \file
+ * \ingroup Common
+ * \brief Python bindings for the initialization of the runtime parameters
+ */
+
+#ifndef DUMUX_PYTHON_COMMON_PARAMETERS_HH
+#define DUMUX_PYTHON_COMMON_PARAMETERS_HH
+
+#include <map>
+#include <string>
+
+#include <dune/python/pybind11/pybind11.h>
+#include <dune/python/pybind11/stl.h>
+
+#include <dumux/common/parameters.hh>
+
+namespace Dumux::Python {
+
+/*!
+ * \ingroup Common
+ * \brief Register initParameters(file, params), initializing the runtime parameters
+ *        from an input file (optional) and a dictionary (taking precedence over the file)
+ */
+inline void registerParameters(pybind11::module& module)
+{
+    using pybind11::operator""_a;
+
+    module.def("initParameters", [](const std::string& file, const std::map<std::string, std::string>& params){
+        const auto setParams = [&](Dune::ParameterTree& tree){
+            for (const auto& [key, value] : params)
+                tree[key] = value;
+        };
+
+        if (file.empty())
+            Parameters::init(setParams);
+        else
+            Parameters::init(file, setParams, /*inputFileOverwritesParams=*/false);
+    }, "file"_a = "", "params"_a = std::map<std::string, std::string>{});
+}
+
+} // namespace Dumux::Python
+
+#endif
@@ -0,0 +1,73 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/****************************************************************************
+ *   See the file COPYING for full copying permissions.                      *
+ *                                                                           *
+ *   This program is free software: you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by    *
+ *   the Free Software Foundation, either version 3 of the License, or       *
+ *   (at your option) any later version.                                     *
+ *                                                                           *
+ *   This program is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the            *
+ *   GNU General Public License for more details.                            *
+ *                                                                           *
+ *   You should have received a copy of the GNU General Public License       *
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.   *
+ *****************************************************************************/
+/*!
+ * \file
+ * \ingroup Common
+ * \brief Python bindings for problems implemented in C++
+ */
+
+#ifndef DUMUX_PYTHON_COMMON_PROBLEM_HH
+#define DUMUX_PYTHON_COMMON_PROBLEM_HH
+
+#include <memory>
+#include <string>
+#include <type_traits>
+
+#include <dune/istl/bvector.hh>
+#include <dune/python/pybind11/pybind11.h>
+
+#include <dumux/python/common/solutionvector.hh>
+
+namespace Dumux::Python {
+
+/*!
+ * \ingroup Common
+ * \brief Register a problem implemented in C++ (derived from Dumux::FVProblem)
+ *        that is constructible from the grid geometry
+ */
+template<class Problem, class... options>
+void registerProblem(pybind11::handle scope, pybind11::class_<Problem, options...> cls)
+{
+    using pybind11::operator""_a;
+
+    using GridGeometry = std::decay_t<decltype(std::declval<const Problem&>().gridGeometry())>;
+    using Element = typename GridGeometry::GridView::template Codim<0>::Entity;
+    using PrimaryVariables = std::decay_t<decltype(std::declval<const Problem&>().initial(std::declval<const Element&>()))>;
+    using SolutionVector = Dune::BlockVector<PrimaryVariables>;
+    registerSolutionVector<SolutionVector>(scope);
+
+    cls.def(pybind11::init([](std::shared_ptr<const GridGeometry> gridGeometry){
+        return std::make_shared<Problem>(gridGeometry);
+    }), "gridGeometry"_a);
+
+    cls.def_property_readonly("name", [](const Problem& self){ return self.name(); });
+    cls.def("gridGeometry", &Problem::gridGeometry);
+    cls.def("applyInitialSolution", [](const Problem& self, SolutionVector& sol){
+        self.applyInitialSolution(sol);
+    }, "sol"_a);
+    cls.def("initialSolution", [](const Problem& self){
+        SolutionVector sol(self.gridGeometry().numDofs());
+        self.applyInitialSolution(sol);
+        return sol;
+    });
+}
+
+} // end namespace Dumux::Python
+
+#endif
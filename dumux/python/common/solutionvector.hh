@@ -0,0 +1,96 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/****************************************************************************
+ *   See the file COPYING for full copying permissions.                      *
+ *                                                                           *
+ *   This program is free software: you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by    *
+ *   the Free Software Foundation, either version 3 of the License, or       *
+ *   (at your option) any later version.                                     *
+ *                                                                           *
+ *   This program is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the            *
+ *   GNU General Public License for more details.                            *
+ *                                                                           *
+ *   You should have received a copy of the GNU General Public License       *
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.   *
+ *****************************************************************************/
+/*!
+ * \file
+ * \ingroup Common
+ * \brief Python bindings for solution vectors (Dune::BlockVector) with NumPy access without copying
+ */
+
+#ifndef DUMUX_PYTHON_COMMON_SOLUTIONVECTOR_HH
+#define DUMUX_PYTHON_COMMON_SOLUTIONVECTOR_HH
+
+#include <dune/common/classname.hh>
+#include <dune/python/pybind11/pybind11.h>
+#include <dune/python/pybind11/numpy.h>
+#include <dune/python/common/typeregistry.hh>
+
+namespace Dumux::Python {
+
+/*!
+ * \ingroup Common
+ * \brief The buffer info of a block vector, a two-dimensional array (number of blocks x block size)
+ *        referencing the memory of the vector
+ */
+template<class SolutionVector>
+pybind11::buffer_info solutionVectorBufferInfo(SolutionVector& v)
+{
+    using Block = typename SolutionVector::block_type;
+    using Scalar = typename Block::value_type;
+    static constexpr std::size_t blockSize = Block::dimension;
+
+    return pybind11::buffer_info(
+        v.size() > 0 ? &v[0][0] : nullptr, sizeof(Scalar), pybind11::format_descriptor<Scalar>::format(), 2,
+        { v.size(), blockSize }, { sizeof(Block), sizeof(Scalar) }
+    );
+}
+
+/*!
+ * \ingroup Common
+ * \brief Register a solution vector of the type Dune::BlockVector<Dune::FieldVector<Scalar, n>>
+ *
+ * The vector implements the buffer protocol, i.e. numpy.asarray(x) or x.asarray() return a
+ * NumPy array of shape (number of dofs, number of equations) sharing the memory of the vector.
+ * Changes of the array entries modify the vector. The array is invalidated if the vector is resized.
+ */
+template <class SolutionVector, class... Options>
+void registerSolutionVector(pybind11::handle scope, pybind11::class_<SolutionVector, Options...> cls)
+{
+    using pybind11::operator""_a;
+
+    cls.def(pybind11::init([](std::size_t size){ return new SolutionVector(size); }), "size"_a = 0);
+    cls.def(pybind11::init([](const SolutionVector& other){ return new SolutionVector(other); }), "other"_a);
+    cls.def_buffer([](SolutionVector& self){ return solutionVectorBufferInfo(self); });
+    cls.def("asarray", [](pybind11::object self){
+        return pybind11::array(solutionVectorBufferInfo(self.cast<SolutionVector&>()), self);
+    });
+    cls.def("__len__", [](const SolutionVector& self){ return self.size(); });
+    cls.def("resize", [](SolutionVector& self, std::size_t size){ self.resize(size); }, "size"_a);
+    cls.def("assign", [](SolutionVector& self, const SolutionVector& other){ self = other; }, "other"_a);
+    cls.def("two_norm", [](const SolutionVector& self){ return self.two_norm(); });
+}
+
+template <class SolutionVector>
+void registerSolutionVector(pybind11::handle scope)
+{
+    using namespace Dune::Python;
+
+    auto [cls, addedToRegistry] = insertClass<SolutionVector>(
+        scope, "SolutionVector",
+        pybind11::buffer_protocol(),
+        GenerateTypeName(Dune::className<SolutionVector>()),
+        IncludeFiles{"dumux/python/common/solutionvector.hh"}
+    );
+
+    if (addedToRegistry)
+        registerSolutionVector(scope, cls);
+}
+
+} // namespace Dumux::Python
+
+#endif
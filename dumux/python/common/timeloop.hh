@@ -24,6 +24,8 @@
 #ifndef DUMUX_PYTHON_COMMON_TIMELOOP_HH
 #define DUMUX_PYTHON_COMMON_TIMELOOP_HH
 
+#include <memory>
+
 #include <dumux/common/timeloop.hh>
 
 #include <dune/python/pybind11/pybind11.h>
@@ -62,7 +64,8 @@ void registerTimeLoop(pybind11::handle scope,
 template<class Scalar>
 void registerTimeLoop(pybind11::handle scope, const char *clsName = "TimeLoop")
 {
-    pybind11::class_<CheckPointTimeLoop<Scalar>> cls(scope, clsName);
+    // shared ownership, such that the time loop can be shared with C++ objects (e.g. the assembler)
+    pybind11::class_<CheckPointTimeLoop<Scalar>, std::shared_ptr<CheckPointTimeLoop<Scalar>>> cls(scope, clsName);
     registerTimeLoop(scope, cls);
 }
 
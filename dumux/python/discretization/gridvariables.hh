@@ -0,0 +1,67 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/****************************************************************************
+ *   See the file COPYING for full copying permissions.                      *
+ *                                                                           *
+ *   This program is free software: you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by    *
+ *   the Free Software Foundation, either version 3 of the License, or       *
+ *   (at your option) any later version.                                     *
+ *                                                                           *
+ *   This program is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the            *
+ *   GNU General Public License for more details.                            *
+ *                                                                           *
+ *   You should have received a copy of the GNU General Public License       *
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.   *
+ *****************************************************************************/
+/*!
+ * \file
+ * \ingroup Discretization
+ * \brief Python bindings for the grid variables
+ */
+
+#ifndef DUMUX_PYTHON_DISCRETIZATION_GRIDVARIABLES_HH
+#define DUMUX_PYTHON_DISCRETIZATION_GRIDVARIABLES_HH
+
+#include <memory>
+
+#include <dune/istl/bvector.hh>
+#include <dune/python/pybind11/pybind11.h>
+
+#include <dumux/python/common/solutionvector.hh>
+
+namespace Dumux::Python {
+
+/*!
+ * \ingroup Discretization
+ * \brief Register the grid variables (e.g. Dumux::FVGridVariables)
+ */
+template <class GridVariables, class... options>
+void registerGridVariables(pybind11::handle scope, pybind11::class_<GridVariables, options...> cls)
+{
+    using pybind11::operator""_a;
+
+    using Problem = typename GridVariables::GridVolumeVariables::Problem;
+    using GridGeometry = typename GridVariables::GridGeometry;
+    using SolutionVector = Dune::BlockVector<typename GridVariables::PrimaryVariables>;
+    registerSolutionVector<SolutionVector>(scope);
+
+    cls.def(pybind11::init([](std::shared_ptr<Problem> problem, std::shared_ptr<const GridGeometry> gridGeometry){
+        return std::make_shared<GridVariables>(problem, gridGeometry);
+    }), "problem"_a, "gridGeometry"_a);
+
+    cls.def("init", [](GridVariables& self, const SolutionVector& sol){ self.init(sol); }, "sol"_a);
+    cls.def("update", [](GridVariables& self, const SolutionVector& sol){ self.update(sol); }, "sol"_a);
+    cls.def("updateAfterGridAdaption", [](GridVariables& self, const SolutionVector& sol){
+        self.updateAfterGridAdaption(sol);
+    }, "sol"_a);
+    cls.def("advanceTimeStep", &GridVariables::advanceTimeStep);
+    cls.def("resetTimeStep", [](GridVariables& self, const SolutionVector& sol){ self.resetTimeStep(sol); }, "sol"_a);
+    cls.def("gridGeometry", &GridVariables::gridGeometry);
+}
+
+} // end namespace Dumux::Python
+
+#endif
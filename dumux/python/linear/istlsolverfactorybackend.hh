@@ -0,0 +1,54 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/****************************************************************************
+ *   See the file COPYING for full copying permissions.                      *
+ *                                                                           *
+ *   This program is free software: you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by    *
+ *   the Free Software Foundation, either version 3 of the License, or       *
+ *   (at your option) any later version.                                     *
+ *                                                                           *
+ *   This program is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the            *
+ *   GNU General Public License for more details.                            *
+ *                                                                           *
+ *   You should have received a copy of the GNU General Public License       *
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.   *
+ *****************************************************************************/
+/*!
+ * \file
+ * \ingroup Linear
+ * \brief Python bindings for the linear solver backend using the dune-istl solver factory
+ */
+
+#ifndef DUMUX_PYTHON_LINEAR_ISTLSOLVERFACTORYBACKEND_HH
+#define DUMUX_PYTHON_LINEAR_ISTLSOLVERFACTORYBACKEND_HH
+
+#include <memory>
+#include <string>
+
+#include <dune/python/pybind11/pybind11.h>
+
+namespace Dumux::Python {
+
+/*!
+ * \ingroup Linear
+ * \brief Register a linear solver backend (e.g. Dumux::IstlSolverFactoryBackend)
+ *        constructible from a parameter group (sequential solvers)
+ */
+template <class LinearSolver, class... options>
+void registerIstlSolverFactoryBackend(pybind11::handle scope, pybind11::class_<LinearSolver, options...> cls)
+{
+    using pybind11::operator""_a;
+
+    cls.def(pybind11::init([](const std::string& paramGroup){
+        return std::make_shared<LinearSolver>(paramGroup);
+    }), "paramGroup"_a = "");
+
+    cls.def_property_readonly("name", &LinearSolver::name);
+}
+
+} // end namespace Dumux::Python
+
+#endif
@@ -0,0 +1,81 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/****************************************************************************
+ *   See the file COPYING for full copying permissions.                      *
+ *                                                                           *
+ *   This program is free software: you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by    *
+ *   the Free Software Foundation, either version 3 of the License, or       *
+ *   (at your option) any later version.                                     *
+ *                                                                           *
+ *   This program is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the            *
+ *   GNU General Public License for more details.                            *
+ *                                                                           *
+ *   You should have received a copy of the GNU General Public License       *
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.   *
+ *****************************************************************************/
+/*!
+ * \file
+ * \ingroup Nonlinear
+ * \brief Python bindings for the Newton solver
+ */
+
+#ifndef DUMUX_PYTHON_NONLINEAR_NEWTONSOLVER_HH
+#define DUMUX_PYTHON_NONLINEAR_NEWTONSOLVER_HH
+
+#include <memory>
+#include <iostream>
+
+#include <dune/python/pybind11/pybind11.h>
+#include <dune/python/pybind11/iostream.h>
+
+#include <dumux/common/timeloop.hh>
+
+namespace Dumux::Python {
+
+/*!
+ * \ingroup Nonlinear
+ * \brief Register a Newton solver (e.g. Dumux::NewtonSolver)
+ *
+ * The solution vector is updated in place, i.e. NumPy views of the vector
+ * (see registerSolutionVector) observe the new solution without copying.
+ */
+template <class NewtonSolver, class... options>
+void registerNewtonSolver(pybind11::handle scope, pybind11::class_<NewtonSolver, options...> cls)
+{
+    using pybind11::operator""_a;
+
+    using Assembler = typename NewtonSolver::Assembler;
+    using LinearSolver = typename NewtonSolver::LinearSolver;
+    using SolutionVector = typename Assembler::ResidualType;
+    using Scalar = typename Assembler::Scalar;
+
+    cls.def(pybind11::init([](std::shared_ptr<Assembler> assembler, std::shared_ptr<LinearSolver> linearSolver){
+        return std::make_shared<NewtonSolver>(assembler, linearSolver);
+    }), "assembler"_a, "linearSolver"_a);
+
+    // the output of the solver is redirected to the Python output stream
+    cls.def("solve", [](NewtonSolver& self, SolutionVector& sol){
+        pybind11::scoped_ostream_redirect stream(std::cout, pybind11::module::import("sys").attr("stdout"));
+        self.solve(sol);
+    }, "sol"_a);
+    cls.def("solve", [](NewtonSolver& self, SolutionVector& sol, CheckPointTimeLoop<Scalar>& timeLoop){
+        pybind11::scoped_ostream_redirect stream(std::cout, pybind11::module::import("sys").attr("stdout"));
+        self.solve(sol, timeLoop);
+    }, "sol"_a, "timeLoop"_a);
+
+    cls.def("suggestTimeStepSize", &NewtonSolver::suggestTimeStepSize, "oldTimeStep"_a);
+    cls.def("setVerbosity", &NewtonSolver::setVerbosity, "verbosity"_a);
+    cls.def("setMaxSteps", &NewtonSolver::setMaxSteps, "maxSteps"_a);
+    cls.def("setMaxRelativeShift", &NewtonSolver::setMaxRelativeShift, "tolerance"_a);
+    cls.def("report", [](const NewtonSolver& self){
+        pybind11::scoped_ostream_redirect stream(std::cout, pybind11::module::import("sys").attr("stdout"));
+        self.report();
+    });
+}
+
+} // end namespace Dumux::Python
+
+#endif
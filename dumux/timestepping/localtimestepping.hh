@@ -0,0 +1,370 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*****************************************************************************
+ *   See the file COPYING for full copying permissions.                      *
+ *                                                                           *
+ *   This program is free software: you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by    *
+ *   the Free Software Foundation, either version 3 of the License, or       *
+ *   (at your option) any later version.                                     *
+ *                                                                           *
+ *   This program is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the            *
+ *   GNU General Public License for more details.                            *
+ *                                                                           *
+ *   You should have received a copy of the GNU General Public License       *
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.   *
+ *****************************************************************************/
+/*!
+ * \file
+ * \brief Local time stepping (multirate explicit Euler) for cell-centered finite volume schemes
+ */
+#ifndef DUMUX_TIMESTEPPING_LOCAL_TIMESTEPPING_HH
+#define DUMUX_TIMESTEPPING_LOCAL_TIMESTEPPING_HH
+
+#include <cmath>
+#include <memory>
+#include <vector>
+#include <string>
+#include <algorithm>
+
+#include <dune/common/exceptions.hh>
+#include <dune/common/fmatrix.hh>
+#include <dune/common/fvector.hh>
+
+#include <dumux/common/exceptions.hh>
+#include <dumux/common/parameters.hh>
+#include <dumux/discretization/method.hh>
+#include <dumux/discretization/extrusion.hh>
+#include <dumux/discretization/elementsolution.hh>
+#include <dumux/assembly/numericepsilon.hh>
+
+namespace Dumux::Experimental {
+
+/*!
+ * \brief Local time stepping (multirate explicit Euler) for cell-centered finite volume schemes
+ *
+ * Instead of advancing all cells with the smallest stable time step size, the cells are grouped into
+ * levels \f$ l = 0, \dots, L-1 \f$ with time step sizes \f$ 2^l \Delta t_\text{min} \f$, where the level
+ * of a cell is the largest one not exceeding its stable time step size (e.g. given by a CFL condition).
+ * The levels of neighboring cells differ by at most one. A macro step of size
+ * \f$ 2^{L-1} \Delta t_\text{min} \f$ consists of \f$ 2^{L-1} \f$ substeps. In substep \f$ k \f$, the fluxes
+ * over all faces whose level (the smaller level of the two adjacent cells) divides \f$ k \f$ are
+ * evaluated with the current states and accumulated, multiplied by the time step size of the face,
+ * in both adjacent cells. A cell is updated at the end of its own time step from the accumulated fluxes
+ * and sources. Since the flux over a face is integrated with the same time steps and states in both
+ * adjacent cells, the scheme is conservative also at the interfaces of the levels
+ * (see Osher, Sanders. Numerical approximations to nonlinear conservation laws with locally varying
+ * time and space grids, Math. Comp. 41, 1983).
+ *
+ * The local time stepping replaces the assemble-and-solve cycle of the explicit assembler
+ * (FVAssembler with isImplicit = false) whose problem, grid variables and local residual it uses.
+ * The fluxes are evaluated with the local residual (including boundary conditions), the
+ * primary variables of an updated cell are found by a local Newton method on the storage term.
+ *
+ * \note The problem time is not updated during the substeps.
+ * \note Only sequential runs are supported.
+ * \tparam Assembler the explicit assembler of a cell-centered scheme
+ */
+template<class Assembler>
+class LocalTimeStepping
+{
+    using Scalar = typename Assembler::Scalar;
+    using GridGeometry = typename Assembler::GridGeometry;
+    using GridVariables = typename Assembler::GridVariables;
+    using SolutionVector = typename Assembler::ResidualType;
+    using PrimaryVariables = typename SolutionVector::block_type;
+    using GridVolumeVariables = typename GridVariables::GridVolumeVariables;
+    using VolumeVariables = typename GridVolumeVariables::VolumeVariables;
+    using Extrusion = Extrusion_t<GridGeometry>;
+
+    static_assert(GridGeometry::discMethod != DiscretizationMethod::box,
+                  "Local time stepping is implemented for cell-centered schemes");
+
+    static constexpr int numEq = PrimaryVariables::dimension;
+    using EqVector = Dune::FieldVector<Scalar, numEq>;
+    using EqMatrix = Dune::FieldMatrix<Scalar, numEq, numEq>;
+
+public:
+    /*!
+     * \brief The constructor
+     * \param assembler the explicit assembler
+     * \param paramGroup the parameter group (for LocalTimeStepping.MaxNumLevels)
+     */
+    explicit LocalTimeStepping(std::shared_ptr<Assembler> assembler, const std::string& paramGroup = "")
+    : assembler_(assembler)
+    {
+        maxNumLevels_ = getParamFromGroup<int>(paramGroup, "LocalTimeStepping.MaxNumLevels", 10);
+        if (maxNumLevels_ < 1)
+            DUNE_THROW(Dune::InvalidStateException, "Local time stepping needs at least one level");
+
+        updateConnectivity();
+    }
+
+    /*!
+     * \brief Update the cell neighbors (has to be called after the grid geometry changed)
+     */
+    void updateConnectivity()
+    {
+        const auto& gridGeometry = assembler_->gridGeometry();
+        const auto numCells = gridGeometry.gridView().size(0);
+
+        neighbors_.assign(numCells, {});
+        auto fvGeometry = localView(gridGeometry);
+        for (const auto& element : elements(gridGeometry.gridView()))
+        {
+            const auto eIdx = gridGeometry.elementMapper().index(element);
+            fvGeometry.bindElement(element);
+            for (const auto& scvf : scvfs(fvGeometry))
+                if (!scvf.boundary())
+                    for (std::size_t i = 0; i < scvf.numOutsideScvs(); ++i)
+                        neighbors_[eIdx].push_back(scvf.outsideScvIdx(i));
+        }
+
+        level_.assign(numCells, 0);
+        updateLevelLists_();
+    }
+
+    /*!
+     * \brief Set the levels of the cells from their stable time step sizes
+     * \param stableTimeStepSizes the largest stable time step size of each cell (by element index)
+     */
+    void setStableTimeStepSizes(const std::vector<Scalar>& stableTimeStepSizes)
+    {
+        using std::floor; using std::log2;
+        if (stableTimeStepSizes.size() != level_.size())
+            DUNE_THROW(Dune::InvalidStateException, "Wrong number of stable time step sizes");
+
+        dtMin_ = *std::min_element(stableTimeStepSizes.begin(), stableTimeStepSizes.end());
+        if (!(dtMin_ > 0.0))
+            DUNE_THROW(NumericalProblem, "The stable time step sizes have to be positive");
+
+        for (std::size_t eIdx = 0; eIdx < level_.size(); ++eIdx)
+        {
+            const int level = static_cast<int>(floor(log2(stableTimeStepSizes[eIdx]/dtMin_)));
+            level_[eIdx] = std::clamp(level, 0, maxNumLevels_-1);
+        }
+
+        // the levels of neighboring cells differ by at most one
+        bool changed = true;
+        while (changed)
+        {
+            changed = false;
+            for (std::size_t eIdx = 0; eIdx < level_.size(); ++eIdx)
+            {
+                for (const auto nIdx : neighbors_[eIdx])
+                {
+                    if (level_[eIdx] > level_[nIdx] + 1)
+                    {
+                        level_[eIdx] = level_[nIdx] + 1;
+                        changed = true;
+                    }
+                }
+            }
+        }
+
+        updateLevelLists_();
+    }
+
+    //! The size of a macro step (the largest time step size of the levels)
+    Scalar timeStepSize() const
+    { return dtMin_*(1 << (numLevels_-1)); }
+
+    //! The number of levels
+    int numLevels() const
+    { return numLevels_; }
+
+    //! The level of a cell
+    int level(std::size_t eIdx) const
+    { return level_[eIdx]; }
+
+    //! The number of cell updates of the last macro step (the global scheme needs numCells*2^(L-1))
+    std::size_t numCellUpdates() const
+    { return numCellUpdates_; }
+
+    /*!
+     * \brief Advance the solution by one macro step (see timeStepSize())
+     * \param x the solution, overwritten with the solution at the end of the macro step
+     */
+    void advance(SolutionVector& x)
+    {
+        const auto& gridGeometry = assembler_->gridGeometry();
+        const auto& problem = assembler_->problem();
+        auto& gridVariables = assembler_->gridVariables();
+        const auto localResidual = assembler_->localResidual();
+
+        auto fvGeometry = localView(gridGeometry);
+        auto elemVolVars = localView(gridVariables.curGridVolVars());
+        auto elemFluxVarsCache = localView(gridVariables.gridFluxVarsCache());
+
+        accumulated_.assign(level_.size(), EqVector(0.0));
+        numCellUpdates_ = 0;
+
+        const std::size_t numSubSteps = 1 << (numLevels_-1);
+        for (std::size_t k = 0; k < numSubSteps; ++k)
+        {
+            // accumulate the fluxes of the faces and the sources of the cells starting a step
+            for (int minLevel = 0; minLevel < numLevels_ && k % (1 << minLevel) == 0; ++minLevel)
+            {
+                for (const auto eIdx : cellsByMinFaceLevel_[minLevel])
+                {
+                    const auto element = gridGeometry.element(eIdx);
+                    fvGeometry.bind(element);
+                    elemVolVars.bind(element, fvGeometry, x);
+                    elemFluxVarsCache.bind(element, fvGeometry, elemVolVars);
+
+                    auto& acc = accumulated_[eIdx];
+                    for (const auto& scvf : scvfs(fvGeometry))
+                    {
+                        const int faceLevel = scvf.boundary() ? level_[eIdx]
+                                                              : std::min(level_[eIdx], level_[scvf.outsideScvIdx()]);
+                        if (k % (1 << faceLevel) == 0)
+                        {
+                            auto flux = localResidual.evalFlux(problem, element, fvGeometry, elemVolVars, elemFluxVarsCache, scvf);
+                            flux *= dtMin_*(1 << faceLevel);
+                            acc += flux;
+                        }
+                    }
+
+                    if (k % (1 << level_[eIdx]) == 0)
+                    {
+                        for (const auto& scv : scvs(fvGeometry))
+                        {
+                            auto source = localResidual.computeSource(problem, element, fvGeometry, elemVolVars, scv);
+                            source *= Extrusion::volume(scv)*elemVolVars[scv].extrusionFactor()*dtMin_*(1 << level_[eIdx]);
+                            acc -= source;
+                        }
+                    }
+                }
+            }
+
+            // update the cells whose step ends with this substep
+            for (int level = 0; level < numLevels_ && (k+1) % (1 << level) == 0; ++level)
+            {
+                for (const auto eIdx : cellsByLevel_[level])
+                {
+                    updateCell_(x, eIdx, gridVariables);
+                    accumulated_[eIdx] = 0.0;
+                    ++numCellUpdates_;
+                }
+            }
+        }
+    }
+
+private:
+    // solve storage(x_i) = storage(x_i^old) - accumulated/volume with a local Newton method
+    void updateCell_(SolutionVector& x, std::size_t eIdx, GridVariables& gridVariables) const
+    {
+        using std::abs; using std::max;
+        const auto& acc = accumulated_[eIdx];
+        if (acc.infinity_norm() == 0.0)
+            return;
+
+        const auto& gridGeometry = assembler_->gridGeometry();
+        const auto& problem = assembler_->problem();
+        const auto localResidual = assembler_->localResidual();
+        const auto element = gridGeometry.element(eIdx);
+        auto fvGeometry = localView(gridGeometry);
+        fvGeometry.bindElement(element);
+        const auto& scv = fvGeometry.scv(eIdx);
+
+        auto elemSol = elementSolution(PrimaryVariables(x[eIdx]));
+        VolumeVariables volVars;
+        volVars.update(elemSol, problem, element, scv);
+
+        const auto storage = [&](const PrimaryVariables& priVars)
+        {
+            elemSol[0] = priVars;
+            volVars.update(elemSol, problem, element, scv);
+            EqVector s(localResidual.computeStorage(problem, scv, volVars));
+            return s;
+        };
+
+        EqVector target(localResidual.computeStorage(problem, scv, volVars));
+        auto delta = acc;
+        delta /= Extrusion::volume(scv)*volVars.extrusionFactor();
+        target -= delta;
+
+        static const NumericEpsilon<Scalar, numEq> eps{problem.paramGroup()};
+        PrimaryVariables priVars = x[eIdx];
+        EqVector firstIncrement(0.0);
+        for (int iter = 0; iter < 20; ++iter)
+        {
+            const auto s = storage(priVars);
+            auto residual = s; residual -= target;
+
+            EqMatrix jacobian;
+            for (int pvIdx = 0; pvIdx < numEq; ++pvIdx)
+            {
+                auto deflected = priVars;
+                const Scalar h = eps(priVars[pvIdx], pvIdx);
+                deflected[pvIdx] += h;
+                const auto sDeflected = storage(deflected);
+                for (int eqIdx = 0; eqIdx < numEq; ++eqIdx)
+                    jacobian[eqIdx][pvIdx] = (sDeflected[eqIdx] - s[eqIdx])/h;
+            }
+
+            EqVector increment;
+            try { jacobian.solve(increment, residual); }
+            catch (const Dune::FMatrixError& e)
+            { DUNE_THROW(NumericalProblem, "Local time stepping: singular storage derivative in cell " << eIdx); }
+
+            for (int pvIdx = 0; pvIdx < numEq; ++pvIdx)
+                priVars[pvIdx] -= increment[pvIdx];
+
+            if (iter == 0)
+                firstIncrement = increment;
+            else
+            {
+                bool converged = true;
+                for (int pvIdx = 0; pvIdx < numEq; ++pvIdx)
+                    if (abs(increment[pvIdx]) > 1e-12*max(abs(priVars[pvIdx]), abs(firstIncrement[pvIdx])))
+                        converged = false;
+                if (converged)
+                    break;
+            }
+        }
+
+        x[eIdx] = priVars;
+
+        // keep cached volume variables consistent with the solution
+        if constexpr (GridVolumeVariables::cachingEnabled)
+        {
+            elemSol[0] = priVars;
+            gridVariables.curGridVolVars().volVars(scv).update(elemSol, problem, element, scv);
+        }
+    }
+
+    void updateLevelLists_()
+    {
+        numLevels_ = level_.empty() ? 1 : *std::max_element(level_.begin(), level_.end()) + 1;
+        cellsByLevel_.assign(numLevels_, {});
+        cellsByMinFaceLevel_.assign(numLevels_, {});
+        for (std::size_t eIdx = 0; eIdx < level_.size(); ++eIdx)
+        {
+            int minFaceLevel = level_[eIdx];
+            for (const auto nIdx : neighbors_[eIdx])
+                minFaceLevel = std::min(minFaceLevel, level_[nIdx]);
+
+            cellsByLevel_[level_[eIdx]].push_back(eIdx);
+            cellsByMinFaceLevel_[minFaceLevel].push_back(eIdx);
+        }
+    }
+
+    std::shared_ptr<Assembler> assembler_;
+    int maxNumLevels_;
+    int numLevels_ = 1;
+    Scalar dtMin_ = 0.0;
+
+    std::vector<std::vector<std::size_t>> neighbors_;
+    std::vector<int> level_;
+    std::vector<std::vector<std::size_t>> cellsByLevel_;
+    std::vector<std::vector<std::size_t>> cellsByMinFaceLevel_; //!< cells by the smallest level of their faces
+    std::vector<EqVector> accumulated_; //!< the time-integrated fluxes minus sources of the current step
+    std::size_t numCellUpdates_ = 0;
+};
+
+} // end namespace Dumux::Experimental
+
+#endif
@@ -64,6 +64,10 @@ namespace Dumux::Experimental {
  * where \f$ x^{(k)} \f$ denotes the intermediate solution at stage \f$ k \f$.
  * Dependent on the number of stages \f$ m \f$, and the coefficients \f$ \alpha, \beta, d\f$,
  * schemes with different properties and order of accuracy can be constructed.
+ *
+ * Methods with an embedded solution \f$ \hat{x}^{n+1} \f$ of different order (for local error estimation)
+ * provide its coefficients as an additional (explicit) stage \f$ m+1 \f$, i.e.
+ * \f$ \hat{x}^{n+1} = x^{(m+1)} \f$ with \f$ \alpha_{m+1,m+1} = 1 \f$ and \f$ \beta_{m+1,m+1} = 0 \f$.
  */
 template<class Scalar>
 class MultiStageMethod
@@ -84,6 +88,14 @@ public:
 
     virtual std::string name () const = 0;
 
+    //! if the method provides an embedded solution (as stage numStages()+1) for local error estimation
+    virtual bool hasEmbeddedMethod () const
+    { return false; }
+
+    //! the order of the embedded solution (the local error estimate is of order embeddedOrder()+1)
+    virtual std::size_t embeddedOrder () const
+    { return 0; }
+
     virtual ~MultiStageMethod() = default;
 };
 
@@ -199,6 +211,157 @@ private:
     std::array<Scalar, 5> paramD_;
 };
 
+/*!
+ * \brief Explicit second order Runge-Kutta scheme (Heun) with embedded first order (explicit Euler) solution
+ */
+template<class Scalar>
+class HeunEuler final : public MultiStageMethod<Scalar>
+{
+public:
+    HeunEuler()
+    : paramAlpha_{{{-1.0, 1.0, 0.0, 0.0},
+                   {-1.0, 0.0, 1.0, 0.0},
+                   {-1.0, 0.0, 0.0, 1.0}}}
+    , paramBeta_{{{1.0, 0.0, 0.0, 0.0},
+                  {0.5, 0.5, 0.0, 0.0},
+                  {1.0, 0.0, 0.0, 0.0}}}
+    , paramD_{{0.0, 1.0, 1.0, 1.0}}
+    {}
+
+    bool implicit () const final
+    { return false; }
+
+    std::size_t numStages () const final
+    { return 2; }
+
+    Scalar temporalWeight (std::size_t i, std::size_t k) const final
+    { return paramAlpha_[i-1][k]; }
+
+    Scalar spatialWeight (std::size_t i, std::size_t k) const final
+    { return paramBeta_[i-1][k]; }
+
+    Scalar timeStepWeight (std::size_t k) const final
+    { return paramD_[k]; }
+
+    std::string name () const final
+    { return "explicit Heun-Euler 2(1)"; }
+
+    bool hasEmbeddedMethod () const final
+    { return true; }
+
+    std::size_t embeddedOrder () const final
+    { return 1; }
+
+private:
+    std::array<std::array<Scalar, 4>, 3> paramAlpha_;
+    std::array<std::array<Scalar, 4>, 3> paramBeta_;
+    std::array<Scalar, 4> paramD_;
+};
+
+/*!
+ * \brief Explicit third order Runge-Kutta scheme with embedded second order solution
+ * \note P. Bogacki and L.F. Shampine. A 3(2) pair of Runge-Kutta formulas.
+ *       Appl. Math. Lett., 2(4):321-325, 1989. https://doi.org/10.1016/0893-9659(89)90079-7
+ */
+template<class Scalar>
+class BogackiShampine final : public MultiStageMethod<Scalar>
+{
+public:
+    BogackiShampine()
+    : paramAlpha_{{{-1.0, 1.0, 0.0, 0.0, 0.0},
+                   {-1.0, 0.0, 1.0, 0.0, 0.0},
+                   {-1.0, 0.0, 0.0, 1.0, 0.0},
+                   {-1.0, 0.0, 0.0, 0.0, 1.0}}}
+    , paramBeta_{{{0.5, 0.0, 0.0, 0.0, 0.0},
+                  {0.0, 0.75, 0.0, 0.0, 0.0},
+                  {2.0/9.0, 1.0/3.0, 4.0/9.0, 0.0, 0.0},
+                  {7.0/24.0, 0.25, 1.0/3.0, 0.125, 0.0}}}
+    , paramD_{{0.0, 0.5, 0.75, 1.0, 1.0}}
+    {}
+
+    bool implicit () const final
+    { return false; }
+
+    std::size_t numStages () const final
+    { return 3; }
+
+    Scalar temporalWeight (std::size_t i, std::size_t k) const final
+    { return paramAlpha_[i-1][k]; }
+
+    Scalar spatialWeight (std::size_t i, std::size_t k) const final
+    { return paramBeta_[i-1][k]; }
+
+    Scalar timeStepWeight (std::size_t k) const final
+    { return paramD_[k]; }
+
+    std::string name () const final
+    { return "explicit Bogacki-Shampine 3(2)"; }
+
+    bool hasEmbeddedMethod () const final
+    { return true; }
+
+    std::size_t embeddedOrder () const final
+    { return 2; }
+
+private:
+    std::array<std::array<Scalar, 5>, 4> paramAlpha_;
+    std::array<std::array<Scalar, 5>, 4> paramBeta_;
+    std::array<Scalar, 5> paramD_;
+};
+
+/*!
+ * \brief Two-stage, L-stable, stiffly accurate, singly diagonally implicit
+ *        second order Runge-Kutta scheme (SDIRK) with embedded first order solution
+ * \note R. Alexander. Diagonally implicit Runge-Kutta methods for stiff O.D.E.'s.
+ *       SIAM J. Numer. Anal., 14(6):1006-1021, 1977. https://doi.org/10.1137/0714068
+ *       The embedded solution \f$ \hat{x}^{n+1} = x^n + \Delta t f(x^{(1)}) \f$ only
+ *       requires an explicit stage.
+ */
+template<class Scalar>
+class SDIRKTwo final : public MultiStageMethod<Scalar>
+{
+    static constexpr Scalar gamma = 1.0 - 0.7071067811865475244;
+public:
+    SDIRKTwo()
+    : paramAlpha_{{{-1.0, 1.0, 0.0, 0.0},
+                   {-1.0, 0.0, 1.0, 0.0},
+                   {-1.0, 0.0, 0.0, 1.0}}}
+    , paramBeta_{{{0.0, gamma, 0.0, 0.0},
+                  {0.0, 1.0 - gamma, gamma, 0.0},
+                  {0.0, 1.0, 0.0, 0.0}}}
+    , paramD_{{0.0, gamma, 1.0, 1.0}}
+    {}
+
+    bool implicit () const final
+    { return true; }
+
+    std::size_t numStages () const final
+    { return 2; }
+
+    Scalar temporalWeight (std::size_t i, std::size_t k) const final
+    { return paramAlpha_[i-1][k]; }
+
+    Scalar spatialWeight (std::size_t i, std::size_t k) const final
+    { return paramBeta_[i-1][k]; }
+
+    Scalar timeStepWeight (std::size_t k) const final
+    { return paramD_[k]; }
+
+    std::string name () const final
+    { return "diagonally implicit Runge-Kutta SDIRK 2(1)"; }
+
+    bool hasEmbeddedMethod () const final
+    { return true; }
+
+    std::size_t embeddedOrder () const final
+    { return 1; }
+
+private:
+    std::array<std::array<Scalar, 4>, 3> paramAlpha_;
+    std::array<std::array<Scalar, 4>, 3> paramBeta_;
+    std::array<Scalar, 4> paramD_;
+};
+
 } // end namespace MultiStage
 } // end namespace Dumux::Experimental
 
@@ -26,6 +26,13 @@
 #include <memory>
 #include <vector>
 #include <cmath>
+#include <string>
+#include <iostream>
+
+#include <dune/common/exceptions.hh>
+
+#include <dumux/common/exceptions.hh>
+#include <dumux/common/parameters.hh>
 
 namespace Dumux::Experimental {
 
@@ -112,13 +119,16 @@ public:
      * \brief The constructor
      * \param pdeSolver Solver class for solving a PDE in each stage
      * \param msMethod The multi-stage method which is to be used for time integration
-     * \todo TODO: Add time step control if the pde solver doesn't converge
+     * \param paramGroup The parameter group in which to look for the verbosity (TimeStepControl.Verbosity)
      */
     MultiStageTimeStepper(std::shared_ptr<PDESolver> pdeSolver,
-                          std::shared_ptr<const MultiStageMethod<Scalar>> msMethod)
+                          std::shared_ptr<const MultiStageMethod<Scalar>> msMethod,
+                          const std::string& paramGroup = "")
     : pdeSolver_(pdeSolver)
     , msMethod_(msMethod)
-    {}
+    {
+        verbosity_ = getParamFromGroup<int>(paramGroup, "TimeStepControl.Verbosity", 1);
+    }
 
     /*!
      * \brief Advance one time step of the given time loop
@@ -126,13 +136,106 @@ public:
      * \param t The current time level
      * \param dt The time step size to be used
      * \note We expect the time level in vars to correspond to the given time `t`
-     * \todo: TODO: Add time step control if the pde solver doesn't converge
+     * \note This step has no time step control, use the overload with a step size controller
+     *       to repeat failed or rejected steps with a smaller time step size
      */
     void step(Variables& vars, const Scalar t, const Scalar dt)
     {
         // make sure there are no traces of previous stages
         pdeSolver_->assembler().clearStages();
 
+        solveStages_(vars, t, dt);
+
+        // clear traces of previously registered stages
+        pdeSolver_->assembler().clearStages();
+    }
+
+    /*!
+     * \brief Advance one time step of the given time loop with local error control
+     * \param vars The variables object at the current time level.
+     * \param timeLoop The time loop providing the current time and the time step size to try
+     * \param controller The step size controller (e.g. PIStepSizeController)
+     *
+     * The local error is estimated with the embedded solution of the time stepping method.
+     * Rejected steps (or steps in which the PDE solver failed) are repeated with the step size
+     * proposed by the controller. On return, the time step size of the time loop is set to the
+     * step size that was actually used (so that it can be advanced) and the step size proposed
+     * for the next step is available via suggestedTimeStepSize(). If the step is still rejected
+     * after controller.maxRejections() repetitions (i.e. maxRejections()+1 attempts), a NumericalProblem is thrown.
+     */
+    template<class TimeLoop, class StepSizeController>
+    void step(Variables& vars, TimeLoop& timeLoop, StepSizeController& controller)
+    {
+        if (!msMethod_->hasEmbeddedMethod())
+            DUNE_THROW(Dune::InvalidStateException,
+                       "Error controlled time stepping requires a method with embedded solution, "
+                       << msMethod_->name() << " has none!");
+
+        const auto t = timeLoop.time();
+        auto dt = timeLoop.timeStepSize();
+        const auto varsOld = vars;
+
+        for (std::size_t rejections = 0; rejections <= controller.maxRejections(); ++rejections)
+        {
+            try
+            {
+                const auto errorNorm = stepWithErrorEstimate_(vars, t, dt, controller);
+                const auto nextDt = controller.suggestTimeStepSize(dt, errorNorm);
+                if (controller.accept(errorNorm))
+                {
+                    timeLoop.setTimeStepSize(dt);
+                    suggestedDt_ = nextDt;
+                    return;
+                }
+
+                if (verbosity_ >= 1)
+                    std::cout << "Rejected time step of size " << dt << " (error norm: " << errorNorm
+                              << "). Retrying with time step size " << nextDt << std::endl;
+                dt = nextDt;
+            }
+            catch (const NumericalProblem& e)
+            {
+                pdeSolver_->assembler().clearStages();
+                dt *= controller.minFactor();
+                if (verbosity_ >= 1)
+                    std::cout << "Solver did not converge (" << e.what() << "). "
+                              << "Retrying with time step size " << dt << std::endl;
+            }
+
+            vars = varsOld;
+        }
+
+        DUNE_THROW(NumericalProblem, "Time step was rejected more than " << controller.maxRejections() << " times!");
+    }
+
+    /*!
+     * \brief The time step size proposed by the step size controller in the last error controlled step
+     */
+    Scalar suggestedTimeStepSize() const
+    { return suggestedDt_; }
+
+    /*!
+     * \brief Set/change the time step method
+     */
+    void setMethod(std::shared_ptr<const MultiStageMethod<Scalar>> msMethod)
+    { msMethod_ = msMethod; }
+
+    /*!
+     * \brief Specifies the verbosity level (0: no output, >= 1: report rejected and failed time steps)
+     */
+    void setVerbosity(int val)
+    { verbosity_ = val; }
+
+    /*!
+     * \brief Return the verbosity level
+     */
+    int verbosity() const
+    { return verbosity_; }
+
+private:
+    //! solve all stages of the method (without clearing the registered stages)
+    void solveStages_(Variables& vars, const Scalar t, const Scalar dt)
+    {
         for (auto stageIdx = 1UL; stageIdx <= msMethod_->numStages(); ++stageIdx)
         {
             // extract parameters for this stage from the time stepping method
@@ -144,20 +247,31 @@ public:
             // assemble & solve
             pdeSolver_->solve(vars);
         }
+    }
 
-        // clear traces of previously registered stages
+    //! do a step and compute the embedded solution (the additional stage) to estimate the local error
+    template<class StepSizeController>
+    Scalar stepWithErrorEstimate_(Variables& vars, const Scalar t, const Scalar dt,
+                                  const StepSizeController& controller)
+    {
         pdeSolver_->assembler().clearStages();
-    }
+        solveStages_(vars, t, dt);
 
-    /*!
-     * \brief Set/change the time step method
-     */
-    void setMethod(std::shared_ptr<const MultiStageMethod<Scalar>> msMethod)
-    { msMethod_ = msMethod; }
+        // the embedded solution is an explicit stage using all previous stages
+        auto embeddedVars = vars;
+        const auto embeddedStageIdx = msMethod_->numStages() + 1;
+        auto stageParams = std::make_shared<StageParams>(*msMethod_, embeddedStageIdx, t, dt);
+        pdeSolver_->assembler().prepareStage(embeddedVars, stageParams);
+        pdeSolver_->solve(embeddedVars);
+
+        pdeSolver_->assembler().clearStages();
+        return controller.errorNorm(vars.dofs(), embeddedVars.dofs());
+    }
 
-private:
     std::shared_ptr<PDESolver> pdeSolver_;
     std::shared_ptr<const MultiStageMethod<Scalar>> msMethod_;
+    Scalar suggestedDt_ = 0.0;
+    int verbosity_;
 };
 
 } // end namespace Dumux::Experimental
@@ -0,0 +1,161 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*****************************************************************************
+ *   See the file COPYING for full copying permissions.                      *
+ *                                                                           *
+ *   This program is free software: you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by    *
+ *   the Free Software Foundation, either version 3 of the License, or       *
+ *   (at your option) any later version.                                     *
+ *                                                                           *
+ *   This program is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the            *
+ *   GNU General Public License for more details.                            *
+ *                                                                           *
+ *   You should have received a copy of the GNU General Public License       *
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.   *
+ *****************************************************************************/
+/*!
+ * \file
+ * \brief Time step size control based on local error estimates
+ */
+#ifndef DUMUX_TIMESTEPPING_STEPSIZE_CONTROLLER_HH
+#define DUMUX_TIMESTEPPING_STEPSIZE_CONTROLLER_HH
+
+#include <cmath>
+#include <string>
+#include <algorithm>
+
+#include <dune/common/typetraits.hh>
+#include <dune/common/hybridutilities.hh>
+#include <dune/common/rangeutilities.hh>
+
+#include <dumux/common/parameters.hh>
+
+namespace Dumux::Experimental {
+
+/*!
+ * \brief A proportional-integral (PI) step size controller
+ *
+ * The local error of a time step is measured by the weighted root-mean-square norm
+ * \f[
+ *   \| e \| = \sqrt{\frac{1}{N} \sum_{i=1}^N \left( \frac{x_i - \hat{x}_i}{\epsilon_\text{abs} + \epsilon_\text{rel} \max(|x_i|, |\hat{x}_i|)} \right)^2 }
+ * \f]
+ * of the difference between the solution \f$ x \f$ and an embedded solution \f$ \hat{x} \f$.
+ * A step is accepted if \f$ \| e \| \leq 1 \f$ and the next step size is chosen as
+ * \f[
+ *   \Delta t^{n+1} = \Delta t^n \, \rho \, \| e_n \|^{-\beta_1/k} \, \| e_{n-1} \|^{\beta_2/k},
+ * \f]
+ * where \f$ k \f$ is the order of the error estimate and \f$ \rho \f$ a safety factor
+ * (see Hairer, Wanner. Solving ordinary differential equations II, Sec. IV.2, Springer, 1996).
+ * The factor is bounded by a minimum and maximum factor. Setting \f$ \beta_2 = 0 \f$ results
+ * in the classical (I-)controller.
+ */
+template<class Scalar>
+class PIStepSizeController
+{
+public:
+    /*!
+     * \brief Constructor
+     * \param errorOrder the order of the local error estimate (e.g. MultiStageMethod::embeddedOrder()+1)
+     * \param paramGroup the parameter group in which to look for the controller parameters
+     */
+    explicit PIStepSizeController(std::size_t errorOrder, const std::string& paramGroup = "")
+    : errorOrder_(errorOrder)
+    {
+        absTol_ = getParamFromGroup<Scalar>(paramGroup, "TimeStepControl.AbsoluteTolerance", 1e-6);
+        relTol_ = getParamFromGroup<Scalar>(paramGroup, "TimeStepControl.RelativeTolerance", 1e-4);
+        safetyFactor_ = getParamFromGroup<Scalar>(paramGroup, "TimeStepControl.SafetyFactor", 0.9);
+        minFactor_ = getParamFromGroup<Scalar>(paramGroup, "TimeStepControl.MinFactor", 0.2);
+        maxFactor_ = getParamFromGroup<Scalar>(paramGroup, "TimeStepControl.MaxFactor", 5.0);
+        beta1_ = getParamFromGroup<Scalar>(paramGroup, "TimeStepControl.Beta1", 0.7);
+        beta2_ = getParamFromGroup<Scalar>(paramGroup, "TimeStepControl.Beta2", 0.4);
+        maxRejections_ = getParamFromGroup<std::size_t>(paramGroup, "TimeStepControl.MaxRejections", 10);
+    }
+
+    /*!
+     * \brief Compute the weighted norm of the local error estimate
+     * \param x the solution
+     * \param xEmbedded the embedded solution
+     */
+    template<class SolutionVector>
+    Scalar errorNorm(const SolutionVector& x, const SolutionVector& xEmbedded) const
+    {
+        Scalar sum = 0.0;
+        std::size_t numEntries = 0;
+        forEachEntry_(x, xEmbedded, [&](const auto a, const auto b)
+        {
+            using std::abs; using std::max;
+            const auto scaledError = (a - b)/(absTol_ + relTol_*max(abs(a), abs(b)));
+            sum += scaledError*scaledError;
+            ++numEntries;
+        });
+
+        using std::sqrt;
+        return numEntries > 0 ? sqrt(sum/numEntries) : 0.0;
+    }
+
+    //! if a step with the given error norm is accepted
+    bool accept(Scalar errorNorm) const
+    { return errorNorm <= 1.0; }
+
+    /*!
+     * \brief Suggest the next time step size
+     * \param dt the time step size used in the step with the given error
+     * \param errorNorm the error norm of the step
+     * \note The error history is only updated for accepted steps
+     */
+    Scalar suggestTimeStepSize(Scalar dt, Scalar errorNorm)
+    {
+        using std::pow; using std::max; using std::min;
+        const Scalar k = errorOrder_;
+        const Scalar error = max(errorNorm, 1e-10);
+
+        Scalar factor = safetyFactor_*pow(error, -beta1_/k);
+        if (accept(errorNorm))
+        {
+            factor *= pow(prevErrorNorm_, beta2_/k);
+            prevErrorNorm_ = error;
+        }
+        // do not increase the step size directly after a rejection
+        else
+            factor = min(factor, 1.0);
+
+        return dt*min(maxFactor_, max(minFactor_, factor));
+    }
+
+    //! the maximum number of rejected attempts of a single time step
+    std::size_t maxRejections() const
+    { return maxRejections_; }
+
+    //! the minimum step size reduction factor (also used when the nonlinear solver fails)
+    Scalar minFactor() const
+    { return minFactor_; }
+
+    //! reset the error history (e.g. after a discontinuity)
+    void reset()
+    { prevErrorNorm_ = 1.0; }
+
+private:
+    template<class V, class F>
+    static void forEachEntry_(const V& a, const V& b, const F& f)
+    {
+        if constexpr (Dune::IsNumber<V>::value)
+            f(a, b);
+        else
+            Dune::Hybrid::forEach(Dune::range(Dune::Hybrid::size(a)), [&](auto i)
+            { forEachEntry_(a[i], b[i], f); });
+    }
+
+    std::size_t errorOrder_;
+    Scalar absTol_, relTol_;
+    Scalar safetyFactor_, minFactor_, maxFactor_;
+    Scalar beta1_, beta2_;
+    std::size_t maxRejections_;
+    Scalar prevErrorNorm_ = 1.0;
+};
+
+} // end namespace Dumux::Experimental
+
+#endif
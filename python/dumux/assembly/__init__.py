@@ -0,0 +1,27 @@
+from dune.generator.generator import SimpleGenerator
+from dune.common.hashit import hashIt
+
+# construct an FVAssembler (JIT compiled)
+#
+# stationary problems: FVAssembler(problem=problem, gridVariables=gridVariables, typeTag=typeTag)
+# instationary problems: additionally pass timeLoop and prevSol (the previous solution is stored by reference)
+#
+def FVAssembler(*, problem, gridVariables, typeTag, diffMethod="numeric", isImplicit=True, timeLoop=None, prevSol=None):
+    if diffMethod not in ("numeric", "analytic"):
+        raise ValueError("Unknown diffMethod {}".format(diffMethod))
+
+    includes = typeTag._includes + ["dumux/assembly/fvassembler.hh", "dumux/python/assembly/fvassembler.hh"]
+    typeName = "Dumux::FVAssembler<{}, Dumux::DiffMethod::{}, {}>".format(
+        typeTag._typeName, diffMethod, "true" if isImplicit else "false"
+    )
+    moduleName = "fvassembler_" + hashIt(typeName)
+    holderType = "std::shared_ptr<{}>".format(typeName)
+    generator = SimpleGenerator("FVAssembler", "Dumux::Python")
+    module = generator.load(includes, typeName, moduleName, options=[holderType])
+
+    if timeLoop is None:
+        return module.FVAssembler(problem, problem.gridGeometry(), gridVariables)
+    else:
+        if prevSol is None:
+            raise ValueError("Instationary problems require the previous solution (prevSol)")
+        return module.FVAssembler(problem, problem.gridGeometry(), gridVariables, timeLoop, prevSol)
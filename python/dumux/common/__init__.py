@@ -10,6 +10,12 @@ from dune.common.hashit import hashIt
 # class MyProblem:
 #    ...
 #
+# Instead of the per-entity methods (boundaryTypes, dirichlet, neumann, source),
+# the Python class may implement vectorized versions taking a NumPy array of positions
+# (boundaryTypesAtPosBatch, dirichletAtPosBatch, neumannAtPosBatch, sourceAtPosBatch),
+# which are evaluated once when the problem is created and on problem.update()
+# (see dumux/python/common/fvproblem.hh)
+#
 def FVProblem(gridGeometry):
 
     def createModule(numEq):
@@ -46,3 +52,31 @@ def BoundaryTypes(numEq=1):
         module = generator.load(includes, typeName, moduleName)
         globals().update({cacheKey : module.BoundaryTypes})
     return globals()[cacheKey]()
+
+
+# A type tag of a model defined in C++ (e.g. in a properties header)
+#
+# from dumux.common import TypeTag
+# typeTag = TypeTag("OnePCompressibleTpfa", includes=["test/porousmediumflow/1p/compressible/properties.hh"])
+#
+# The grid type of the type tag has to coincide with the grid created in Python.
+class TypeTag:
+    def __init__(self, name, includes):
+        self.name = name
+        self._typeName = "Dumux::Properties::TTag::" + name
+        self._includes = list(includes)
+
+    # the C++ type name of a property of this type tag
+    def getPropType(self, property):
+        return "Dumux::GetPropType<{}, Dumux::Properties::{}>".format(self._typeName, property)
+
+
+# Function for JIT compilation of a problem implemented in C++ (the Problem property of a type tag)
+def Problem(gridGeometry, typeTag):
+    typeName = typeTag.getPropType("Problem")
+    includes = typeTag._includes + gridGeometry._includes + ["dumux/python/common/problem.hh"]
+    moduleName = "problem_" + hashIt(typeName)
+    holderType = "std::shared_ptr<{}>".format(typeName)
+    generator = SimpleGenerator("Problem", "Dumux::Python")
+    module = generator.load(includes, typeName, moduleName, options=[holderType])
+    return module.Problem(gridGeometry)
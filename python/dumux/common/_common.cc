@@ -19,9 +19,13 @@
 
 #include <dune/python/pybind11/pybind11.h>
 #include <dumux/python/common/timeloop.hh>
+#include <dumux/python/common/parameters.hh>
 
 PYBIND11_MODULE(_common, module)
 {
     // export time loop
     Dumux::Python::registerTimeLoop<double>(module);
+
+    // export the initialization of the runtime parameters
+    Dumux::Python::registerParameters(module);
 }
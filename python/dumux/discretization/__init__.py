@@ -3,10 +3,14 @@ from dune.common.hashit import hashIt
 
 # construct a GridGeometry from a gridView
 # the grid geometry is JIT compiled
-def GridGeometry(gridView, discMethod="cctpfa"):
+# if a type tag is given, its GridGeometry property is used
+def GridGeometry(gridView, discMethod="cctpfa", typeTag=None):
     includes = gridView._includes + ["dumux/python/discretization/gridgeometry.hh"]
 
-    if discMethod == "cctpfa":
+    if typeTag is not None:
+        includes += typeTag._includes
+        typeName = typeTag.getPropType("GridGeometry")
+    elif discMethod == "cctpfa":
         includes += ["dumux/discretization/cellcentered/tpfa/fvgridgeometry.hh"]
         typeName = "Dumux::CCTpfaFVGridGeometry<" + gridView._typeName + ">"
     elif discMethod == "box":
@@ -20,3 +24,14 @@ def GridGeometry(gridView, discMethod="cctpfa"):
     generator = SimpleGenerator("GridGeometry", "Dumux::Python")
     module = generator.load(includes, typeName, moduleName, options=[holderType])
     return module.GridGeometry(gridView)
+
+
+# construct the GridVariables of a type tag (JIT compiled)
+def GridVariables(problem, typeTag):
+    includes = typeTag._includes + problem._includes + ["dumux/python/discretization/gridvariables.hh"]
+    typeName = typeTag.getPropType("GridVariables")
+    moduleName = "gridvariables_" + hashIt(typeName)
+    holderType = "std::shared_ptr<{}>".format(typeName)
+    generator = SimpleGenerator("GridVariables", "Dumux::Python")
+    module = generator.load(includes, typeName, moduleName, options=[holderType])
+    return module.GridVariables(problem, problem.gridGeometry())
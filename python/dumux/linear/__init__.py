@@ -0,0 +1,17 @@
+from dune.generator.generator import SimpleGenerator
+from dune.common.hashit import hashIt
+
+# construct a (sequential) linear solver backend using the dune-istl solver factory (JIT compiled)
+# the solver is configured with the runtime parameters (LinearSolver.Type, ...)
+def IstlSolverFactoryBackend(gridGeometry, paramGroup=""):
+    includes = gridGeometry._includes + [
+        "dumux/linear/linearsolvertraits.hh",
+        "dumux/linear/istlsolverfactorybackend.hh",
+        "dumux/python/linear/istlsolverfactorybackend.hh"
+    ]
+    typeName = "Dumux::IstlSolverFactoryBackend<Dumux::LinearSolverTraits<{}>>".format(gridGeometry._typeName)
+    moduleName = "istlsolverfactorybackend_" + hashIt(typeName)
+    holderType = "std::shared_ptr<{}>".format(typeName)
+    generator = SimpleGenerator("IstlSolverFactoryBackend", "Dumux::Python")
+    module = generator.load(includes, typeName, moduleName, options=[holderType])
+    return module.IstlSolverFactoryBackend(paramGroup)
@@ -0,0 +1,15 @@
+from dune.generator.generator import SimpleGenerator
+from dune.common.hashit import hashIt
+
+# construct a Newton solver for an assembler and a linear solver (JIT compiled)
+def NewtonSolver(assembler, linearSolver):
+    includes = assembler._includes + linearSolver._includes + [
+        "dumux/nonlinear/newtonsolver.hh",
+        "dumux/python/nonlinear/newtonsolver.hh"
+    ]
+    typeName = "Dumux::NewtonSolver<{}, {}>".format(assembler._typeName, linearSolver._typeName)
+    moduleName = "newtonsolver_" + hashIt(typeName)
+    holderType = "std::shared_ptr<{}>".format(typeName)
+    generator = SimpleGenerator("NewtonSolver", "Dumux::Python")
+    module = generator.load(includes, typeName, moduleName, options=[holderType])
+    return module.NewtonSolver(assembler, linearSolver)
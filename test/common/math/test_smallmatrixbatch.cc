@@ -0,0 +1,126 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*****************************************************************************
+ *   See the file COPYING for full copying permissions.                      *
+ *                                                                           *
+ *   This program is free software: you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by    *
+ *   the Free Software Foundation, either version 3 of the License, or       *
+ *   (at your option) any later version.                                     *
+ *                                                                           *
+ *   This program is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the            *
+ *   GNU General Public License for more details.                            *
+ *                                                                           *
+ *   You should have received a copy of the GNU General Public License       *
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.   *
+ *****************************************************************************/
+/*!
+ * \file
+ * \brief Test the batched small matrix kernels against Dune::FieldMatrix
+ */
+#include <config.h>
+
+#include <random>
+#include <vector>
+
+#include <dune/common/exceptions.hh>
+#include <dune/common/float_cmp.hh>
+#include <dune/common/fmatrix.hh>
+#include <dune/common/fvector.hh>
+
+#include <dumux/common/exceptions.hh>
+#include <dumux/common/smallmatrixbatch.hh>
+
+namespace Dumux::Test {
+
+template<int n>
+void testBatch(std::size_t numMatrices, std::mt19937& gen)
+{
+    using Matrix = Dune::FieldMatrix<double, n, n>;
+    using Vector = Dune::FieldVector<double, n>;
+
+    // random matrices, some of them require pivoting (zero on the diagonal)
+    std::uniform_real_distribution<double> dist(-1.0, 1.0);
+    std::vector<Matrix> matrices(numMatrices);
+    std::vector<Vector> vectors(numMatrices);
+    for (std::size_t k = 0; k < numMatrices; ++k)
+    {
+        for (int i = 0; i < n; ++i)
+        {
+            vectors[k][i] = dist(gen);
+            for (int j = 0; j < n; ++j)
+                matrices[k][i][j] = dist(gen);
+            matrices[k][i][i] += (k % 3 == 0) ? -matrices[k][i][i] : n;
+        }
+    }
+
+    SmallMatrixBatch<double, n> batch(numMatrices);
+    SmallVectorBatch<double, n> x(numMatrices), y(numMatrices);
+    for (std::size_t k = 0; k < numMatrices; ++k)
+    {
+        batch.set(k, matrices[k]);
+        x.set(k, vectors[k]);
+    }
+
+    // matrix-vector product
+    batch.mv(x, y);
+    for (std::size_t k = 0; k < numMatrices; ++k)
+    {
+        Vector ref; matrices[k].mv(vectors[k], ref);
+        Vector result; y.get(k, result);
+        if (!Dune::FloatCmp::eq(ref, result, 1e-12))
+            DUNE_THROW(Dune::Exception, "mv (n = " << n << ") failed for matrix " << k << ": " << result << ", expected " << ref);
+    }
+
+    // solve
+    auto factorized = batch;
+    factorized.factorize();
+    factorized.solve(x);
+    for (std::size_t k = 0; k < numMatrices; ++k)
+    {
+        Vector ref; matrices[k].solve(ref, vectors[k]);
+        Vector result; x.get(k, result);
+        if (!Dune::FloatCmp::eq(ref, result, 1e-8))
+            DUNE_THROW(Dune::Exception, "solve (n = " << n << ") failed for matrix " << k << ": " << result << ", expected " << ref);
+    }
+
+    // inverse
+    batch.invert();
+    auto inverses = matrices;
+    for (auto& m : inverses)
+        m.invert();
+
+    for (std::size_t k = 0; k < numMatrices; ++k)
+    {
+        Matrix result; batch.get(k, result);
+        if (!Dune::FloatCmp::eq(inverses[k], result, 1e-8))
+            DUNE_THROW(Dune::Exception, "invert (n = " << n << ") failed for matrix " << k);
+    }
+
+    // singular matrices are detected (the second matrix of the batch is zero)
+    SmallMatrixBatch<double, n> singular(2);
+    singular.set(0, matrices[1]);
+    bool caught = false;
+    try { singular.factorize(); }
+    catch (const NumericalProblem&) { caught = true; }
+    if (!caught)
+        DUNE_THROW(Dune::Exception, "Singular matrix (n = " << n << ") not detected");
+}
+
+} // end namespace Dumux::Test
+
+int main()
+{
+    std::mt19937 gen(42);
+    const std::size_t numMatrices = 1000;
+    Dumux::Test::testBatch<2>(numMatrices, gen);
+    Dumux::Test::testBatch<3>(numMatrices, gen);
+    Dumux::Test::testBatch<4>(numMatrices, gen);
+    Dumux::Test::testBatch<5>(numMatrices, gen);
+    Dumux::Test::testBatch<6>(numMatrices, gen);
+    Dumux::Test::testBatch<8>(numMatrices, gen);
+
+    return 0;
+}
@@ -0,0 +1,175 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*****************************************************************************
+ *   See the file COPYING for full copying permissions.                      *
+ *                                                                           *
+ *   This program is free software: you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by    *
+ *   the Free Software Foundation, either version 3 of the License, or       *
+ *   (at your option) any later version.                                     *
+ *                                                                           *
+ *   This program is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the            *
+ *   GNU General Public License for more details.                            *
+ *                                                                           *
+ *   You should have received a copy of the GNU General Public License       *
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.   *
+ *****************************************************************************/
+/*!
+ * \file
+ * \ingroup Common
+ * \brief Test for the element-indexed point source lookup structure
+ */
+#include <config.h>
+
+#include <cmath>
+#include <iostream>
+#include <map>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include <dune/common/exceptions.hh>
+#include <dune/common/fvector.hh>
+#include <dune/common/parallel/mpihelper.hh>
+#include <dune/grid/yaspgrid.hh>
+
+#include <dumux/common/pointsource.hh>
+#include <dumux/discretization/cellcentered/tpfa/fvgridgeometry.hh>
+#include <dumux/discretization/box/fvgridgeometry.hh>
+
+namespace Dumux::Test {
+
+template<class PointSource>
+std::vector<PointSource> makeSources(double shift)
+{
+    using GlobalPosition = typename PointSource::GlobalPosition;
+    using Values = typename PointSource::Values;
+
+    std::vector<PointSource> sources;
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<> dis(0.0, 1.0);
+    for (int i = 0; i < 50; ++i)
+    {
+        GlobalPosition pos({dis(gen), dis(gen)});
+        pos[0] = std::fmod(pos[0] + shift, 1.0);
+        sources.emplace_back(pos, Values(i + 1.0));
+    }
+
+    // sources on element faces and vertices are split among several elements / scvs
+    sources.emplace_back(GlobalPosition({0.5, 0.5}), Values(100.0));
+    sources.emplace_back(GlobalPosition({0.25 + shift, 0.3}), Values(200.0));
+    sources.emplace_back(GlobalPosition({0.1 + shift, 0.1 + shift}), Values(300.0));
+
+    return sources;
+}
+
+template<class PointSource, class PointSourceMap, class Range>
+void compareSources(const PointSourceMap& map, std::size_t eIdx, std::size_t scvIdx, const Range& indexedSources)
+{
+    std::vector<PointSource> reference;
+    const auto it = map.find(std::make_pair(eIdx, scvIdx));
+    if (it != map.end())
+        reference = it->second;
+
+    const std::vector<PointSource> indexed(indexedSources.begin(), indexedSources.end());
+    if (indexed.size() != reference.size())
+        DUNE_THROW(Dune::Exception, "Number of point sources in element " << eIdx << ", scv " << scvIdx
+                                    << " differs: " << indexed.size() << " (index) vs. " << reference.size() << " (map)");
+
+    for (std::size_t i = 0; i < indexed.size(); ++i)
+    {
+        if ((indexed[i].position() - reference[i].position()).two_norm() > 1e-14
+            || indexed[i].embeddings() != reference[i].embeddings()
+            || indexed[i].values() != reference[i].values())
+            DUNE_THROW(Dune::Exception, "Point source " << i << " in element " << eIdx << ", scv " << scvIdx
+                                        << " differs between index and map");
+    }
+}
+
+template<class GridGeometry>
+void testPointSourceIndex(const GridGeometry& gridGeometry)
+{
+    using GlobalPosition = typename GridGeometry::GlobalCoordinate;
+    using PointSource = Dumux::PointSource<GlobalPosition, Dune::FieldVector<double, 1>>;
+    using PointSourceMap = std::map<std::pair<std::size_t, std::size_t>, std::vector<PointSource>>;
+
+    PointSourceIndex<PointSource> pointSourceIndex;
+
+    // the index is updated in place when the sources move
+    for (const double shift : {0.0, 0.125, 0.5})
+    {
+        const auto sources = makeSources<PointSource>(shift);
+
+        PointSourceMap map;
+        BoundingBoxTreePointSourceHelper::computePointSourceMap(gridGeometry, sources, map);
+        pointSourceIndex.update(gridGeometry.gridView().size(0), map);
+
+        std::size_t numSources = 0;
+        for (const auto& [key, scvSources] : map)
+            numSources += scvSources.size();
+        if (pointSourceIndex.size() != numSources)
+            DUNE_THROW(Dune::Exception, "Wrong number of point sources in the index: "
+                                        << pointSourceIndex.size() << ", expected " << numSources);
+
+        std::size_t numElementsWithSources = 0;
+        for (const auto& element : elements(gridGeometry.gridView()))
+        {
+            const auto eIdx = gridGeometry.elementMapper().index(element);
+            auto fvGeometry = localView(gridGeometry);
+            fvGeometry.bindElement(element);
+
+            bool hasSources = false;
+            for (const auto& scv : scvs(fvGeometry))
+            {
+                compareSources<PointSource>(map, eIdx, scv.indexInElement(), pointSourceIndex.sources(eIdx, scv.indexInElement()));
+                hasSources = hasSources || map.count(std::make_pair(eIdx, scv.indexInElement()));
+            }
+
+            if (hasSources != pointSourceIndex.hasSources(eIdx))
+                DUNE_THROW(Dune::Exception, "Wrong source flag for element " << eIdx);
+
+            numElementsWithSources += hasSources;
+        }
+
+        // the traversal visits exactly the map entries
+        std::size_t numScvs = 0;
+        pointSourceIndex.forEachScv([&](std::size_t eIdx, std::size_t scvIdx, const auto& scvSources){
+            compareSources<PointSource>(map, eIdx, scvIdx, scvSources);
+            ++numScvs;
+        });
+        if (numScvs != map.size())
+            DUNE_THROW(Dune::Exception, "Wrong number of scvs with point sources: " << numScvs << ", expected " << map.size());
+
+        std::cout << "-- " << pointSourceIndex.size() << " point sources in " << numElementsWithSources
+                  << " elements (shift " << shift << ") match the map" << std::endl;
+    }
+
+    pointSourceIndex.clear();
+    for (const auto& element : elements(gridGeometry.gridView()))
+        if (pointSourceIndex.hasSources(gridGeometry.elementMapper().index(element)))
+            DUNE_THROW(Dune::Exception, "Cleared index still has point sources");
+}
+
+} // end namespace Dumux::Test
+
+int main(int argc, char* argv[])
+{
+    using namespace Dumux;
+
+    Dune::MPIHelper::instance(argc, argv);
+
+    using Grid = Dune::YaspGrid<2>;
+    Grid grid({1.0, 1.0}, {8, 8});
+    const auto leafGridView = grid.leafGridView();
+    using GridView = std::decay_t<decltype(leafGridView)>;
+
+    std::cout << "Testing the point source index (cctpfa)" << std::endl;
+    Test::testPointSourceIndex(CCTpfaFVGridGeometry<GridView>(leafGridView));
+
+    std::cout << "Testing the point source index (box)" << std::endl;
+    Test::testPointSourceIndex(BoxFVGridGeometry<double, GridView>(leafGridView));
+
+    return 0;
+}
@@ -0,0 +1,152 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*****************************************************************************
+ *   See the file COPYING for full copying permissions.                      *
+ *                                                                           *
+ *   This program is free software: you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by    *
+ *   the Free Software Foundation, either version 3 of the License, or       *
+ *   (at your option) any later version.                                     *
+ *                                                                           *
+ *   This program is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the            *
+ *   GNU General Public License for more details.                            *
+ *                                                                           *
+ *   You should have received a copy of the GNU General Public License       *
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.   *
+ *****************************************************************************/
+/*!
+ * \file
+ * \brief Test comparing the compact box sub control volume faces
+ *        (BoxCompactGridGeometryTraits) with the default box sub control volume faces
+ */
+#include <config.h>
+
+#include <algorithm>
+#include <array>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <dune/common/exceptions.hh>
+#include <dune/common/float_cmp.hh>
+#include <dune/common/fvector.hh>
+#include <dune/common/parallel/mpihelper.hh>
+#include <dune/grid/yaspgrid.hh>
+
+#include <dumux/discretization/box/fvgridgeometry.hh>
+
+namespace Dumux::Test {
+
+template<class Position>
+bool equal(const Position& a, const Position& b)
+{
+    auto diff = a; diff -= b;
+    return diff.two_norm() < 1e-12*std::max(1.0, b.two_norm());
+}
+
+template<class GridView>
+void compareBoxGridGeometries(const GridView& gridView)
+{
+    constexpr int dim = GridView::dimension;
+    using DefaultGridGeometry = BoxFVGridGeometry<double, GridView, ENABLE_CACHING>;
+    using CompactGridGeometry = BoxFVGridGeometry<double, GridView, ENABLE_CACHING, BoxCompactGridGeometryTraits<GridView>>;
+
+    DefaultGridGeometry defaultGridGeometry(gridView);
+    CompactGridGeometry compactGridGeometry(gridView);
+    defaultGridGeometry.update();
+    compactGridGeometry.update();
+
+    std::size_t numInnerScvfs = 0, numBoundaryScvfs = 0;
+    for (const auto& element : elements(gridView))
+    {
+        auto defaultFvGeometry = localView(defaultGridGeometry);
+        auto compactFvGeometry = localView(compactGridGeometry);
+        defaultFvGeometry.bind(element);
+        compactFvGeometry.bind(element);
+
+        if (defaultFvGeometry.numScvf() != compactFvGeometry.numScvf())
+            DUNE_THROW(Dune::Exception, "Different number of scvfs: " << defaultFvGeometry.numScvf() << " vs. " << compactFvGeometry.numScvf());
+
+        if (defaultFvGeometry.hasBoundaryScvf() != compactFvGeometry.hasBoundaryScvf())
+            DUNE_THROW(Dune::Exception, "hasBoundaryScvf() differs");
+
+        std::vector<typename DefaultGridGeometry::SubControlVolumeFace> defaultScvfs;
+        for (const auto& scvf : scvfs(defaultFvGeometry))
+            defaultScvfs.push_back(scvf);
+
+        std::size_t i = 0;
+        for (const auto& scvf : scvfs(compactFvGeometry))
+        {
+            const auto& ref = defaultScvfs[i++];
+            const auto onError = [&](const std::string& what){
+                DUNE_THROW(Dune::Exception, "dim " << dim << ": " << what << " of "
+                                            << (ref.boundary() ? "boundary" : "inner") << " scvf " << ref.index()
+                                            << " in element " << defaultGridGeometry.elementMapper().index(element) << " differs");
+            };
+
+            if (scvf.index() != ref.index()) onError("index");
+            if (scvf.boundary() != ref.boundary()) onError("boundary flag");
+            if (!equal(scvf.center(), ref.center())) onError("center");
+            if (!equal(scvf.ipGlobal(), ref.ipGlobal())) onError("integration point");
+            if (Dune::FloatCmp::ne(scvf.area(), ref.area(), 1e-12)) onError("area");
+            if (!equal(scvf.unitOuterNormal(), ref.unitOuterNormal())) onError("unit outer normal");
+            if (scvf.insideScvIdx() != ref.insideScvIdx()) onError("inside scv index");
+            if (scvf.numOutsideScvs() != ref.numOutsideScvs()) onError("number of outside scvs");
+            if (!ref.boundary() && scvf.outsideScvIdx() != ref.outsideScvIdx()) onError("outside scv index");
+            if (ref.boundary() && scvf.boundaryFlag() != ref.boundaryFlag()) onError("boundary flag value");
+
+            // the corners of the compact face are reconstructed from the element geometry
+            const auto geometry = compactFvGeometry.geometry(scvf);
+            const auto refGeometry = defaultFvGeometry.geometry(ref);
+            if (geometry.corners() != refGeometry.corners()) onError("number of corners");
+            for (int c = 0; c < refGeometry.corners(); ++c)
+                if (!equal(geometry.corner(c), refGeometry.corner(c))) onError("corner " + std::to_string(c));
+            if (!equal(geometry.center(), ref.center())) onError("geometry center");
+            if (Dune::FloatCmp::ne(geometry.volume(), ref.area(), 1e-12)) onError("geometry volume");
+
+            if (ref.boundary())
+                ++numBoundaryScvfs;
+            else
+                ++numInnerScvfs;
+        }
+    }
+
+    if (numInnerScvfs == 0 || numBoundaryScvfs == 0)
+        DUNE_THROW(Dune::Exception, "Expected inner and boundary scvfs");
+
+    std::cout << "-- dim " << dim << ": " << numInnerScvfs << " inner and " << numBoundaryScvfs
+              << " boundary scvfs coincide" << std::endl;
+}
+
+template<int dim>
+void testBoxCompactGridGeometry()
+{
+    // a grid with anisotropic cells, offset from the origin
+    using Grid = Dune::YaspGrid<dim, Dune::EquidistantOffsetCoordinates<double, dim>>;
+    Dune::FieldVector<double, dim> lowerLeft, upperRight;
+    std::array<int, dim> cells;
+    for (int i = 0; i < dim; ++i)
+    {
+        lowerLeft[i] = -0.5*(i+1);
+        upperRight[i] = 1.0 + 0.3*i;
+        cells[i] = 3 + i;
+    }
+
+    Grid grid(lowerLeft, upperRight, cells);
+    compareBoxGridGeometries(grid.leafGridView());
+}
+
+} // end namespace Dumux::Test
+
+int main(int argc, char* argv[])
+{
+    Dune::MPIHelper::instance(argc, argv);
+
+    Dumux::Test::testBoxCompactGridGeometry<1>();
+    Dumux::Test::testBoxCompactGridGeometry<2>();
+    Dumux::Test::testBoxCompactGridGeometry<3>();
+
+    return 0;
+}
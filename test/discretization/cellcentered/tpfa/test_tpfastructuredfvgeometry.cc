@@ -0,0 +1,159 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*****************************************************************************
+ *   See the file COPYING for full copying permissions.                      *
+ *                                                                           *
+ *   This program is free software: you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by    *
+ *   the Free Software Foundation, either version 3 of the License, or       *
+ *   (at your option) any later version.                                     *
+ *                                                                           *
+ *   This program is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the            *
+ *   GNU General Public License for more details.                            *
+ *                                                                           *
+ *   You should have received a copy of the GNU General Public License       *
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.   *
+ *****************************************************************************/
+/*!
+ * \file
+ * \brief Test for the structured tpfa grid geometry (compares with the unstructured grid geometry)
+ */
+#include <config.h>
+
+#include <algorithm>
+#include <iostream>
+#include <bitset>
+
+#include <dune/common/fvector.hh>
+#include <dune/common/float_cmp.hh>
+#include <dune/grid/yaspgrid.hh>
+
+#include <dumux/discretization/cellcentered/tpfa/fvgridgeometry.hh>
+#include <dumux/discretization/cellcentered/tpfa/structuredfvgridgeometry.hh>
+
+template<class Grid>
+void testStructuredGridGeometry(const Grid& grid, std::size_t expectedNumBoundaryScvf)
+{
+    using namespace Dumux;
+    using GridView = typename Grid::LeafGridView;
+    using GridGeometry = CCTpfaFVGridGeometry<GridView, false>;
+    using StructuredGridGeometry = CCTpfaStructuredFVGridGeometry<GridView>;
+
+    const auto gridView = grid.leafGridView();
+    GridGeometry gridGeometry(gridView);
+    gridGeometry.update();
+    StructuredGridGeometry structuredGridGeometry(gridView);
+    structuredGridGeometry.update();
+
+    if (structuredGridGeometry.numScv() != gridGeometry.numScv())
+        DUNE_THROW(Dune::Exception, "Number of scvs does not match");
+    if (structuredGridGeometry.numBoundaryScvf() != expectedNumBoundaryScvf
+        || structuredGridGeometry.numBoundaryScvf() != gridGeometry.numBoundaryScvf())
+        DUNE_THROW(Dune::Exception, "Number of boundary scvfs does not match: " << structuredGridGeometry.numBoundaryScvf());
+    if (structuredGridGeometry.isPeriodic() != gridGeometry.isPeriodic())
+        DUNE_THROW(Dune::Exception, "Periodicity does not match");
+
+    auto fvGeometry = localView(gridGeometry);
+    auto structuredFvGeometry = localView(structuredGridGeometry);
+    for (const auto& element : elements(gridView))
+    {
+        fvGeometry.bind(element);
+        structuredFvGeometry.bind(element);
+
+        if (fvGeometry.numScvf() != structuredFvGeometry.numScvf())
+            DUNE_THROW(Dune::Exception, "Number of scvfs does not match");
+
+        auto it = scvfs(structuredFvGeometry).begin();
+        for (const auto& scvf : scvfs(fvGeometry))
+        {
+            const auto& structuredScvf = *it++;
+            if (scvf.boundary() != structuredScvf.boundary())
+                DUNE_THROW(Dune::Exception, "Boundary flag of scvf does not match");
+            if (Dune::FloatCmp::ne(scvf.center(), structuredScvf.center())
+                || Dune::FloatCmp::ne(scvf.unitOuterNormal(), structuredScvf.unitOuterNormal())
+                || Dune::FloatCmp::ne(scvf.area(), structuredScvf.area()))
+                DUNE_THROW(Dune::Exception, "Geometry of scvf does not match");
+            if (scvf.insideScvIdx() != structuredScvf.insideScvIdx())
+                DUNE_THROW(Dune::Exception, "Inside scv index does not match");
+            if (!scvf.boundary() && scvf.outsideScvIdx() != structuredScvf.outsideScvIdx())
+                DUNE_THROW(Dune::Exception, "Outside scv index does not match");
+            if (structuredScvf.index() >= structuredGridGeometry.numScvf())
+                DUNE_THROW(Dune::Exception, "Scvf index exceeds the number of scvfs");
+
+            // the flipped scvf has to be found for inner scvfs (only available for periodic grids)
+            if (!scvf.boundary() && structuredGridGeometry.isPeriodic())
+            {
+                const auto& flipScvf = structuredFvGeometry.flipScvf(structuredScvf.index());
+                if (flipScvf.insideScvIdx() != structuredScvf.outsideScvIdx())
+                    DUNE_THROW(Dune::Exception, "Wrong flipped scvf");
+            }
+        }
+    }
+
+    // the arithmetic connectivity map has the same neighbors as the stored one,
+    // the scvfs of J are the faces of J facing I (the scvf indices differ between the grid geometries)
+    const auto& connectivityMap = gridGeometry.connectivityMap();
+    const auto& structuredConnectivityMap = structuredGridGeometry.connectivityMap();
+    for (const auto& element : elements(gridView))
+    {
+        const auto globalI = gridGeometry.elementMapper().index(element);
+        const auto structuredRow = structuredConnectivityMap[globalI];
+        if (structuredRow.size() != connectivityMap[globalI].size())
+            DUNE_THROW(Dune::Exception, "Number of connected elements of element " << globalI << " does not match");
+
+        for (const auto& dataJ : connectivityMap[globalI])
+        {
+            const auto it = std::find_if(structuredRow.begin(), structuredRow.end(),
+                                         [&](const auto& d){ return d.globalJ == dataJ.globalJ; });
+            if (it == structuredRow.end())
+                DUNE_THROW(Dune::Exception, "Element " << dataJ.globalJ << " missing in the connectivity of element " << globalI);
+            if (it->scvfsJ.size() != dataJ.scvfsJ.size() || !it->additionalScvfs.empty())
+                DUNE_THROW(Dune::Exception, "Wrong number of scvfs of element " << dataJ.globalJ << " for element " << globalI);
+
+            structuredFvGeometry.bindElement(gridGeometry.element(dataJ.globalJ));
+            for (const auto scvfIdx : it->scvfsJ)
+            {
+                const auto& scvf = structuredFvGeometry.scvf(scvfIdx);
+                if (scvf.boundary() || scvf.insideScvIdx() != dataJ.globalJ || scvf.outsideScvIdx() != globalI)
+                    DUNE_THROW(Dune::Exception, "Scvf " << scvfIdx << " of element " << dataJ.globalJ << " does not face element " << globalI);
+            }
+        }
+
+        // indexing a temporary row entry is valid (as used in the local assemblers)
+        for (std::size_t k = 0; k < structuredRow.size(); ++k)
+            for (const auto scvfIdx : structuredConnectivityMap[globalI][k].scvfsJ)
+                if (scvfIdx >= structuredGridGeometry.numScvf())
+                    DUNE_THROW(Dune::Exception, "Scvf index exceeds the number of scvfs");
+    }
+
+    std::cout << "-- checked structured grid geometry with " << structuredGridGeometry.numScv() << " elements" << std::endl;
+}
+
+int main (int argc, char *argv[])
+{
+    // maybe initialize mpi
+    Dune::MPIHelper::instance(argc, argv);
+
+    {
+        using Grid = Dune::YaspGrid<2>;
+        Grid grid({1.0, 2.0}, {4, 3});
+        testStructuredGridGeometry(grid, 2*4 + 2*3);
+    }
+
+    {
+        using Grid = Dune::YaspGrid<3, Dune::EquidistantOffsetCoordinates<double, 3>>;
+        Grid grid({-1.0, 0.0, 0.0}, {1.0, 1.0, 3.0}, {3, 2, 5});
+        testStructuredGridGeometry(grid, 2*(3*2 + 2*5 + 3*5));
+    }
+
+    {
+        using Grid = Dune::YaspGrid<2>;
+        std::bitset<2> periodic; periodic[0] = true;
+        Grid grid({1.0, 1.0}, {5, 2}, periodic, 1);
+        testStructuredGridGeometry(grid, 2*5);
+    }
+
+    return 0;
+}
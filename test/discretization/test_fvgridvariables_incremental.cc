@@ -0,0 +1,342 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*****************************************************************************
+ *   See the file COPYING for full copying permissions.                      *
+ *                                                                           *
+ *   This program is free software: you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by    *
+ *   the Free Software Foundation, either version 3 of the License, or       *
+ *   (at your option) any later version.                                     *
+ *                                                                           *
+ *   This program is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the            *
+ *   GNU General Public License for more details.                            *
+ *                                                                           *
+ *   You should have received a copy of the GNU General Public License       *
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.   *
+ *****************************************************************************/
+/*!
+ * \file
+ * \brief Test for the incremental update of the finite volume grid variables:
+ *        after changing a subset of dofs, the volume variables and flux variables caches
+ *        have to coincide with those of a full update (including those of the neighbours).
+ *        Dofs with a relative shift below the update tolerance are skipped unless their state switched.
+ */
+#include <config.h>
+
+#include <cmath>
+#include <type_traits>
+#include <iostream>
+#include <vector>
+
+#include <dune/grid/yaspgrid.hh>
+#include <dune/common/exceptions.hh>
+#include <dune/common/float_cmp.hh>
+#include <dune/common/parallel/mpihelper.hh>
+
+#include <dumux/common/properties.hh>
+#include <dumux/common/parameters.hh>
+
+#include <dumux/discretization/box.hh>
+#include <dumux/discretization/cctpfa.hh>
+#include <dumux/discretization/method.hh>
+
+#include <dumux/io/grid/gridmanager_yasp.hh>
+
+#include <dumux/porousmediumflow/problem.hh>
+#include <dumux/porousmediumflow/1p/model.hh>
+#include <dumux/porousmediumflow/compositional/switchableprimaryvariables.hh>
+#include <dumux/material/components/simpleh2o.hh>
+#include <dumux/material/fluidsystems/1pliquid.hh>
+#include <dumux/material/spatialparams/fv1p.hh>
+
+namespace Dumux {
+
+/*!
+ * \brief Spatial parameters with a permeability depending on the (element) solution,
+ *        such that the volume variables (box) and the transmissibilities (tpfa) depend
+ *        on the primary variables of the neighbouring dofs
+ */
+template<class GridGeometry, class Scalar>
+class IncrementalUpdateTestSpatialParams
+: public FVSpatialParamsOneP<GridGeometry, Scalar, IncrementalUpdateTestSpatialParams<GridGeometry, Scalar>>
+{
+    using ThisType = IncrementalUpdateTestSpatialParams<GridGeometry, Scalar>;
+    using ParentType = FVSpatialParamsOneP<GridGeometry, Scalar, ThisType>;
+    using GlobalPosition = typename GridGeometry::GridView::template Codim<0>::Geometry::GlobalCoordinate;
+
+public:
+    using PermeabilityType = Scalar;
+    using ParentType::ParentType;
+
+    template<class Element, class SubControlVolume, class ElementSolution>
+    PermeabilityType permeability(const Element& element,
+                                  const SubControlVolume& scv,
+                                  const ElementSolution& elemSol) const
+    {
+        Scalar p = 0.0;
+        for (std::size_t i = 0; i < elemSol.size(); ++i)
+            p += elemSol[i][0];
+        p /= elemSol.size();
+        return 1e-12*(1.0 + 1e-5*p);
+    }
+
+    Scalar porosityAtPos(const GlobalPosition& globalPos) const
+    { return 0.4; }
+};
+
+template<class TypeTag>
+class IncrementalUpdateTestProblem : public PorousMediumFlowProblem<TypeTag>
+{
+    using ParentType = PorousMediumFlowProblem<TypeTag>;
+    using Scalar = GetPropType<TypeTag, Properties::Scalar>;
+
+public:
+    using ParentType::ParentType;
+
+    Scalar temperature() const
+    { return 283.15; }
+};
+
+namespace Properties {
+
+// new type tags
+namespace TTag {
+struct IncrementalUpdateTest { using InheritsFrom = std::tuple<OneP>; };
+struct IncrementalUpdateTestTpfa { using InheritsFrom = std::tuple<IncrementalUpdateTest, CCTpfaModel>; };
+struct IncrementalUpdateTestBox { using InheritsFrom = std::tuple<IncrementalUpdateTest, BoxModel>; };
+} // end namespace TTag
+
+template<class TypeTag>
+struct Grid<TypeTag, TTag::IncrementalUpdateTest>
+{ using type = Dune::YaspGrid<2>; };
+
+template<class TypeTag>
+struct Problem<TypeTag, TTag::IncrementalUpdateTest>
+{ using type = IncrementalUpdateTestProblem<TypeTag>; };
+
+template<class TypeTag>
+struct SpatialParams<TypeTag, TTag::IncrementalUpdateTest>
+{
+private:
+    using Scalar = GetPropType<TypeTag, Scalar>;
+    using GG = GetPropType<TypeTag, GridGeometry>;
+public:
+    using type = IncrementalUpdateTestSpatialParams<GG, Scalar>;
+};
+
+template<class TypeTag>
+struct FluidSystem<TypeTag, TTag::IncrementalUpdateTest>
+{
+private:
+    using Scalar = GetPropType<TypeTag, Scalar>;
+public:
+    using type = FluidSystems::OnePLiquid<Scalar, Components::SimpleH2O<Scalar>>;
+};
+
+// primary variables with a state (e.g. a phase presence) to test the detection of switches
+template<class TypeTag>
+struct PrimaryVariables<TypeTag, TTag::IncrementalUpdateTest>
+{
+private:
+    using PrimaryVariablesVector = Dune::FieldVector<GetPropType<TypeTag, Properties::Scalar>,
+                                                     GetPropType<TypeTag, Properties::ModelTraits>::numEq()>;
+public:
+    using type = SwitchablePrimaryVariables<PrimaryVariablesVector, int>;
+};
+
+// the incremental update requires cached variables
+template<class TypeTag>
+struct EnableGridVolumeVariablesCache<TypeTag, TTag::IncrementalUpdateTest> { static constexpr bool value = true; };
+template<class TypeTag>
+struct EnableGridFluxVariablesCache<TypeTag, TTag::IncrementalUpdateTest> { static constexpr bool value = true; };
+
+} // end namespace Properties
+
+namespace Test {
+
+/*!
+ * \brief Compare the variables of the incrementally and the fully updated grid variables
+ * \return the number of compared values of unchanged dofs (or of scvfs not touching a changed dof)
+ *         which differ from those before the update, i.e. which have been refreshed as neighbours
+ */
+template<class GridVariables, class SolutionVector>
+std::size_t compare(const GridVariables& incremental,
+                    const GridVariables& reference,
+                    const GridVariables& before,
+                    const SolutionVector& x,
+                    const std::vector<bool>& dofIsChanged)
+{
+    const auto& gridGeometry = reference.gridGeometry();
+    using GridGeometry = std::decay_t<decltype(gridGeometry)>;
+
+    const auto eq = [](const auto a, const auto b){ return Dune::FloatCmp::eq(a, b, 1e-14); };
+
+    std::size_t numRefreshed = 0;
+    auto fvGeometry = localView(gridGeometry);
+    for (const auto& element : elements(gridGeometry.gridView()))
+    {
+        fvGeometry.bind(element);
+        for (const auto& scv : scvs(fvGeometry))
+        {
+            const auto& volVars = incremental.curGridVolVars().volVars(scv);
+            const auto& refVolVars = reference.curGridVolVars().volVars(scv);
+            if (!eq(volVars.pressure(0), x[scv.dofIndex()][0]) || !eq(volVars.pressure(0), refVolVars.pressure(0))
+                || !eq(volVars.density(0), refVolVars.density(0)) || !eq(volVars.permeability(), refVolVars.permeability()))
+                DUNE_THROW(Dune::Exception, "Volume variables of dof " << scv.dofIndex() << " differ from a full update: p = "
+                                             << volVars.pressure(0) << " (" << refVolVars.pressure(0) << "), K = "
+                                             << volVars.permeability() << " (" << refVolVars.permeability() << ")");
+
+            if (!dofIsChanged[scv.dofIndex()] && !eq(refVolVars.permeability(), before.curGridVolVars().volVars(scv).permeability()))
+                ++numRefreshed;
+        }
+
+        if constexpr (GridGeometry::discMethod == DiscretizationMethod::cctpfa)
+        {
+            for (const auto& scvf : scvfs(fvGeometry))
+            {
+                const auto tij = incremental.gridFluxVarsCache()[scvf].advectionTij();
+                const auto refTij = reference.gridFluxVarsCache()[scvf].advectionTij();
+                if (!eq(tij, refTij))
+                    DUNE_THROW(Dune::Exception, "Transmissibility of scvf " << scvf.index() << " differs from a full update: "
+                                                 << tij << " (" << refTij << ")");
+
+                const bool touchesChanged = dofIsChanged[scvf.insideScvIdx()]
+                                            || (!scvf.boundary() && dofIsChanged[scvf.outsideScvIdx()]);
+                if (!dofIsChanged[scvf.insideScvIdx()] && touchesChanged
+                    && !eq(refTij, before.gridFluxVarsCache()[scvf].advectionTij()))
+                    ++numRefreshed;
+            }
+        }
+    }
+
+    return numRefreshed;
+}
+
+} // end namespace Test
+} // end namespace Dumux
+
+int main(int argc, char* argv[])
+{
+    using namespace Dumux;
+
+    Dune::MPIHelper::instance(argc, argv);
+
+    // the incremental update is enabled for the problem with parameter group "Incremental"
+    Parameters::init(argc, argv, [](Dune::ParameterTree& params){
+        params["Grid.UpperRight"] = "1 1";
+        params["Grid.Cells"] = "6 6";
+        params["Problem.EnableGravity"] = "false";
+        params["Incremental.GridVariables.IncrementalUpdate"] = "true";
+        params["Tolerant.GridVariables.IncrementalUpdate"] = "true";
+        params["Tolerant.GridVariables.IncrementalUpdateTolerance"] = "1e-6";
+    });
+
+    using TypeTag = Properties::TTag::TYPETAG;
+    GridManager<GetPropType<TypeTag, Properties::Grid>> gridManager;
+    gridManager.init();
+
+    using GridGeometry = GetPropType<TypeTag, Properties::GridGeometry>;
+    auto gridGeometry = std::make_shared<GridGeometry>(gridManager.grid().leafGridView());
+    gridGeometry->update();
+
+    using Problem = GetPropType<TypeTag, Properties::Problem>;
+    auto problem = std::make_shared<Problem>(gridGeometry);
+    auto incrementalProblem = std::make_shared<Problem>(gridGeometry, "Incremental");
+    auto tolerantProblem = std::make_shared<Problem>(gridGeometry, "Tolerant");
+
+    // an initial pressure field
+    using SolutionVector = GetPropType<TypeTag, Properties::SolutionVector>;
+    SolutionVector x(gridGeometry->numDofs());
+    for (std::size_t dofIdx = 0; dofIdx < x.size(); ++dofIdx)
+    {
+        x[dofIdx][0] = 1e5 + 1e3*std::sin(0.7*dofIdx);
+        x[dofIdx].setState(1);
+    }
+
+    using GridVariables = GetPropType<TypeTag, Properties::GridVariables>;
+    GridVariables incremental(incrementalProblem, gridGeometry);
+    GridVariables reference(problem, gridGeometry);
+    GridVariables before(problem, gridGeometry);
+    incremental.init(x);
+    reference.init(x);
+
+    // change different subsets of dofs
+    for (std::size_t offset = 0; offset < 3; ++offset)
+    {
+        before.init(x);
+
+        std::vector<bool> dofIsChanged(x.size(), false);
+        for (std::size_t dofIdx = offset; dofIdx < x.size(); dofIdx += 5)
+        {
+            x[dofIdx][0] += 2e4*(1.0 + offset);
+            dofIsChanged[dofIdx] = true;
+        }
+
+        incremental.update(x);
+        reference.update(x);
+
+        const auto numRefreshed = Test::compare(incremental, reference, before, x, dofIsChanged);
+        if (numRefreshed == 0)
+            DUNE_THROW(Dune::Exception, "No variables of neighbours of the changed dofs have been refreshed");
+
+        std::cout << "Changed every fifth dof starting at " << offset << ": incremental update coincides with the full update ("
+                  << numRefreshed << " refreshed neighbour values)" << std::endl;
+    }
+
+    // updating with an unchanged solution must not change anything
+    incremental.update(x);
+    Test::compare(incremental, reference, reference, x, std::vector<bool>(x.size(), false));
+
+    // with a tolerance, dofs with a small relative shift (here 1e-7 < 1e-6) keep their variables
+    // while the shift accumulates, unless their state switched (e.g. a phase appeared)
+    GridVariables tolerant(tolerantProblem, gridGeometry);
+    tolerant.init(x);
+    before.init(x);
+
+    // the solution the tolerant grid variables are expected to be updated with
+    auto y = x;
+    auto xExpected = x;
+    std::vector<bool> dofIsChanged(x.size(), false);
+    for (std::size_t dofIdx = 0; dofIdx < x.size(); ++dofIdx)
+    {
+        if (dofIdx % 4 == 0)
+            y[dofIdx][0] += 1e-2;
+        else if (dofIdx % 4 == 1)
+        {
+            y[dofIdx][0] += 1e3;
+            xExpected[dofIdx] = y[dofIdx];
+            dofIsChanged[dofIdx] = true;
+        }
+        else if (dofIdx % 4 == 2)
+        {
+            y[dofIdx][0] += 1e-2;
+            y[dofIdx].setState(2);
+            xExpected[dofIdx] = y[dofIdx];
+            dofIsChanged[dofIdx] = true;
+        }
+    }
+
+    tolerant.update(y);
+    reference.update(xExpected);
+    Test::compare(tolerant, reference, before, xExpected, dofIsChanged);
+    std::cout << "Shifts below the tolerance are skipped, state switches and shifts above the tolerance are updated" << std::endl;
+
+    // the small shifts accumulate (with respect to the last update) until they exceed the tolerance
+    before.init(xExpected);
+    dofIsChanged.assign(x.size(), false);
+    for (std::size_t dofIdx = 0; dofIdx < x.size(); dofIdx += 4)
+    {
+        y[dofIdx][0] += 0.2;
+        dofIsChanged[dofIdx] = true;
+    }
+
+    tolerant.update(y);
+    reference.update(y);
+    Test::compare(tolerant, reference, before, y, dofIsChanged);
+    std::cout << "Accumulated shifts above the tolerance are updated" << std::endl;
+
+    std::cout << "\nAll tests passed" << std::endl;
+    return 0;
+}
@@ -38,9 +38,11 @@
 #include <dumux/io/grid/gridmanager.hh>
 #include <dumux/linear/linearsolvertraits.hh>
 #include <dumux/linear/amgbackend.hh>
+#include <dumux/linear/activesetsolver.hh>
 #include <dumux/nonlinear/newtonsolver.hh>
 
 #include <dumux/assembly/fvassembler.hh>
+#include <dumux/freeflow/shallowwater/wetdryactiveset.hh>
 
 #include "properties.hh"
 
@@ -198,9 +200,22 @@ int main(int argc, char** argv)
     using Assembler = FVAssembler<TypeTag, DiffMethod::numeric>;
     auto assembler = std::make_shared<Assembler>(problem, gridGeometry, gridVariables, timeLoop, xOld);
 
-    // the linear solver
-    using LinearSolver = AMGBiCGSTABBackend<LinearSolverTraits<GridGeometry>>;
-    auto linearSolver = std::make_shared<LinearSolver>(leafGridView, gridGeometry->dofMapper());
+    // the linear solver (restricted to the active set if enabled)
+    using AMGSolver = AMGBiCGSTABBackend<LinearSolverTraits<GridGeometry>>;
+    using LinearSolver = ActiveSetLinearSolver<AMGSolver, typename Assembler::JacobianMatrix>;
+    auto linearSolver = std::make_shared<LinearSolver>(std::make_shared<AMGSolver>(leafGridView, gridGeometry->dofMapper()));
+
+    // optionally restrict assembly and linear solve to the wet cells and a halo of dry cells
+    std::unique_ptr<ShallowWaterWetDryActiveSet<GridGeometry>> activeSet;
+    if (getParam<bool>("Problem.EnableWetDryActiveSet", false))
+    {
+        if (mpiHelper.size() > 1)
+            DUNE_THROW(Dune::NotImplemented, "The wet/dry active set for parallel runs");
+
+        activeSet = std::make_unique<ShallowWaterWetDryActiveSet<GridGeometry>>(gridGeometry);
+        assembler->setActiveElements(activeSet->activeElements());
+        linearSolver->setActiveDofs(activeSet->activeElements());
+    }
 
     // the non-linear solver
     using NewtonSolver = Dumux::NewtonSolver<Assembler, LinearSolver>;
@@ -212,8 +227,23 @@ int main(int argc, char** argv)
     // time loop
     timeLoop->start(); do
     {
+        if (activeSet)
+            activeSet->update(xOld);
+
         nonLinearSolver.solve(x,*timeLoop);
 
+        // repeat the time step if the front moved beyond the active set
+        while (activeSet && !activeSet->frontContained(x))
+        {
+            activeSet->extend(x);
+            x = xOld;
+            gridVariables->resetTimeStep(x);
+            nonLinearSolver.solve(x,*timeLoop);
+        }
+
+        if (activeSet)
+            std::cout << "Active cells: " << activeSet->numActiveElements() << " of " << gridGeometry->numDofs() << std::endl;
+
         // make the new solution the old solution
         xOld = x;
         gridVariables->advanceTimeStep();
@@ -0,0 +1,161 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*****************************************************************************
+ *   See the file COPYING for full copying permissions.                      *
+ *                                                                           *
+ *   This program is free software: you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by    *
+ *   the Free Software Foundation, either version 3 of the License, or       *
+ *   (at your option) any later version.                                     *
+ *                                                                           *
+ *   This program is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the            *
+ *   GNU General Public License for more details.                            *
+ *                                                                           *
+ *   You should have received a copy of the GNU General Public License       *
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.   *
+ *****************************************************************************/
+/*!
+ * \file
+ * \ingroup ShallowWaterTests
+ * \brief The wet dam break solved with the explicit shallow water kernel.
+ *        The residual of the kernel is compared to the one of the generic assembler.
+ */
+#include <config.h>
+
+#include <cmath>
+#include <iostream>
+#include <algorithm>
+
+#include <dune/common/parallel/mpihelper.hh>
+#include <dune/common/timer.hh>
+
+#include <dumux/common/properties.hh>
+#include <dumux/common/parameters.hh>
+#include <dumux/common/dumuxmessage.hh>
+
+#include <dumux/io/grid/gridmanager.hh>
+#include <dumux/assembly/fvassembler.hh>
+#include <dumux/freeflow/shallowwater/explicitkernel.hh>
+
+#include "problem.hh"
+
+namespace Dumux {
+
+// the maximum difference of two residuals relative to the maximum absolute entry of the reference
+template<class SolutionVector>
+double residualDifference(const SolutionVector& residual, const SolutionVector& reference)
+{
+    double diff = 0.0, scale = 1e-100;
+    for (std::size_t i = 0; i < reference.size(); ++i)
+    {
+        for (std::size_t eqIdx = 0; eqIdx < reference[i].size(); ++eqIdx)
+        {
+            diff = std::max(diff, std::abs(residual[i][eqIdx] - reference[i][eqIdx]));
+            scale = std::max(scale, std::abs(reference[i][eqIdx]));
+        }
+    }
+    return diff/scale;
+}
+
+} // end namespace Dumux
+
+int main(int argc, char** argv)
+{
+    using namespace Dumux;
+
+    using TypeTag = Properties::TTag::DamBreakWet;
+
+    const auto& mpiHelper = Dune::MPIHelper::instance(argc, argv);
+    if (mpiHelper.rank() == 0)
+        DumuxMessage::print(/*firstCall=*/true);
+
+    Parameters::init(argc, argv);
+
+    GridManager<GetPropType<TypeTag, Properties::Grid>> gridManager;
+    gridManager.init();
+    const auto& leafGridView = gridManager.grid().leafGridView();
+
+    using GridGeometry = GetPropType<TypeTag, Properties::GridGeometry>;
+    auto gridGeometry = std::make_shared<GridGeometry>(leafGridView);
+    gridGeometry->update();
+
+    using Problem = GetPropType<TypeTag, Properties::Problem>;
+    auto problem = std::make_shared<Problem>(gridGeometry);
+
+    using SolutionVector = GetPropType<TypeTag, Properties::SolutionVector>;
+    SolutionVector x(gridGeometry->numDofs());
+    problem->applyInitialSolution(x);
+
+    using GridVariables = GetPropType<TypeTag, Properties::GridVariables>;
+    auto gridVariables = std::make_shared<GridVariables>(problem, gridGeometry);
+    gridVariables->init(x);
+
+    // the generic assembler (stationary, i.e. without storage term) as reference for the residual
+    using Assembler = FVAssembler<TypeTag, DiffMethod::numeric>;
+    auto assembler = std::make_shared<Assembler>(problem, gridGeometry, gridVariables);
+
+    ShallowWaterExplicitKernel<TypeTag> kernel(problem, gridGeometry, gridVariables);
+    SolutionVector residual;
+
+    const auto compareResidual = [&](double time)
+    {
+        Dune::Timer timer;
+        assembler->assembleResidual(x);
+        const auto assemblerTime = timer.elapsed();
+
+        timer.reset();
+        kernel.evalResidual(x, residual);
+        const auto kernelTime = timer.elapsed();
+
+        const auto diff = residualDifference(residual, assembler->residual());
+        std::cout << "t = " << time << ": relative residual difference " << diff
+                  << " (assembler " << assemblerTime << "s, explicit kernel " << kernelTime << "s)" << std::endl;
+        if (!(diff < 1e-10))
+            DUNE_THROW(Dune::Exception, "The residual of the explicit kernel differs from the assembled residual");
+    };
+
+    const auto totalVolume = [&]
+    {
+        double volume = 0.0;
+        for (const auto& element : elements(leafGridView))
+            volume += x[gridGeometry->elementMapper().index(element)][0]*element.geometry().volume();
+        return volume;
+    };
+
+    using Scalar = GetPropType<TypeTag, Properties::Scalar>;
+    const auto tEnd = getParam<Scalar>("TimeLoop.TEnd");
+    const auto courantNumber = getParam<Scalar>("TimeLoop.CourantNumber", 0.5);
+    const auto initialVolume = totalVolume();
+
+    compareResidual(0.0);
+
+    Scalar time = 0.0;
+    std::size_t numSteps = 0;
+    Dune::Timer timer;
+    while (time < tEnd)
+    {
+        const auto dt = std::min(kernel.maxTimeStepSize(x, courantNumber), tEnd - time);
+        kernel.explicitEulerStep(x, dt);
+        time += dt;
+        ++numSteps;
+    }
+    std::cout << "Computed " << numSteps << " explicit time steps in " << timer.elapsed() << "s" << std::endl;
+
+    compareResidual(time);
+
+    // the dam break domain is closed, the water volume is conserved
+    const auto volumeError = std::abs(totalVolume() - initialVolume)/initialVolume;
+    std::cout << "Relative change of the water volume: " << volumeError << std::endl;
+    if (!(volumeError < 1e-12))
+        DUNE_THROW(Dune::Exception, "The water volume is not conserved");
+
+    if (mpiHelper.rank() == 0)
+    {
+        Parameters::print();
+        DumuxMessage::print(/*firstCall=*/false);
+    }
+
+    return 0;
+}
@@ -86,5 +86,27 @@ int main(int argc, char* argv[])
     Test::solveWithFactory(A, x, b, "AMGCG");
     Test::solveWithFactory(A, x, b, "SSORCG");
 
+    // the batched block Jacobi preconditioner has to give the same solution as the per-block Jacobi
+    {
+        // couple the unknowns of the diagonal blocks (full, non-symmetric blocks)
+        auto B = A;
+        for (std::size_t i = 0; i < B.N(); ++i)
+        {
+            B[i][i][0][1] += 1.0;
+            B[i][i][1][0] += 0.5;
+        }
+
+        Vector xJac(B.N()), xBatchedJac(B.N());
+        xJac = 0; xBatchedJac = 0;
+        Test::solveWithFactory(B, xJac, b, "JacBiCGSTAB");
+        Test::solveWithFactory(B, xBatchedJac, b, "BatchedJacBiCGSTAB");
+
+        auto diff = xJac;
+        diff -= xBatchedJac;
+        if (diff.infinity_norm() > 1e-10*xJac.infinity_norm())
+            DUNE_THROW(Dune::Exception, "The solutions with the batched and the per-block Jacobi preconditioner differ by "
+                                         << diff.infinity_norm());
+    }
+
     return 0;
 }
@@ -0,0 +1,152 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*****************************************************************************
+ *   See the file COPYING for full copying permissions.                      *
+ *                                                                           *
+ *   This program is free software: you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by    *
+ *   the Free Software Foundation, either version 3 of the License, or       *
+ *   (at your option) any later version.                                     *
+ *                                                                           *
+ *   This program is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the            *
+ *   GNU General Public License for more details.                            *
+ *                                                                           *
+ *   You should have received a copy of the GNU General Public License       *
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.   *
+ *****************************************************************************/
+/*!
+ * \file
+ * \ingroup MaterialTests
+ * \brief Test the tabulated material law wrapper against the original laws
+ *        and the sharing of the tables between laws with equal parameters
+ */
+#include <config.h>
+
+#include <cmath>
+#include <vector>
+#include <string>
+#include <iostream>
+#include <algorithm>
+
+#include <dune/common/exceptions.hh>
+#include <dune/common/timer.hh>
+
+#include <dumux/common/math.hh>
+#include <dumux/common/span.hh>
+
+#include <dumux/material/fluidmatrixinteractions/2p/vangenuchten.hh>
+#include <dumux/material/fluidmatrixinteractions/2p/brookscorey.hh>
+#include <dumux/material/fluidmatrixinteractions/2p/tabulatedmateriallaw.hh>
+
+namespace Dumux {
+
+// the maximum error relative to the maximum absolute value of the reference
+template<class Function>
+double maxRelativeError(const Function& f, const std::vector<double>& sw)
+{
+    double error = 0.0, scale = 1e-100;
+    for (const auto& s : sw)
+    {
+        const auto [value, reference] = f(s);
+        error = std::max(error, std::abs(value - reference));
+        scale = std::max(scale, std::abs(reference));
+    }
+    return error/scale;
+}
+
+template<class Law, class TabulatedLaw>
+void runTest(const std::string& name, const Law& law, const TabulatedLaw& tabulatedLaw, double tolerance)
+{
+    std::cout << "-----------------------\n"
+              << name << "\n"
+              << "-----------------------\n";
+
+    // the table interval is [0.1, 1.0] (effective saturation) and the residual saturation 0.05,
+    // the samples cover the table interval and the region below where the original law is used
+    const auto sw = linspace(0.06, 0.999, 10000);
+    // the derivatives are singular for sw -> 1 (van Genuchten), check them with some distance
+    const auto swDerivatives = linspace(0.06, 0.95, 10000);
+
+    const auto check = [&](const std::string& curve, const auto& f, const auto& samples, double tol)
+    {
+        const auto error = maxRelativeError(f, samples);
+        std::cout << curve << ": maximum relative error " << error << std::endl;
+        if (!(error < tol))
+            DUNE_THROW(Dune::Exception, name << " " << curve << ": maximum relative error " << error << " exceeds " << tol);
+    };
+
+    check("pc", [&](auto s){ return std::make_pair(tabulatedLaw.pc(s), law.pc(s)); }, sw, tolerance);
+    check("krw", [&](auto s){ return std::make_pair(tabulatedLaw.krw(s), law.krw(s)); }, sw, tolerance);
+    check("krn", [&](auto s){ return std::make_pair(tabulatedLaw.krn(s), law.krn(s)); }, sw, tolerance);
+    check("dpc_dsw", [&](auto s){ return std::make_pair(tabulatedLaw.dpc_dsw(s), law.dpc_dsw(s)); }, swDerivatives, 10*tolerance);
+    check("dkrw_dsw", [&](auto s){ return std::make_pair(tabulatedLaw.dkrw_dsw(s), law.dkrw_dsw(s)); }, swDerivatives, 10*tolerance);
+    check("dkrn_dsw", [&](auto s){ return std::make_pair(tabulatedLaw.dkrn_dsw(s), law.dkrn_dsw(s)); }, swDerivatives, 10*tolerance);
+
+    // the evaluation of many saturations gives the same results as the single evaluations
+    std::vector<double> values(sw.size());
+    tabulatedLaw.pc(Span<const double>(sw.data(), sw.size()), Span<double>(values.data(), values.size()));
+    for (std::size_t i = 0; i < sw.size(); ++i)
+        if (values[i] != tabulatedLaw.pc(sw[i]))
+            DUNE_THROW(Dune::Exception, name << " pc: evaluation of many saturations differs at sw = " << sw[i]);
+
+    tabulatedLaw.dkrw_dsw(Span<const double>(sw.data(), sw.size()), Span<double>(values.data(), values.size()));
+    for (std::size_t i = 0; i < sw.size(); ++i)
+        if (values[i] != tabulatedLaw.dkrw_dsw(sw[i]))
+            DUNE_THROW(Dune::Exception, name << " dkrw_dsw: evaluation of many saturations differs at sw = " << sw[i]);
+
+    // speed test (inside the table interval)
+    const auto swTest = linspace(0.2, 0.9, 1000000);
+    auto result = swTest;
+    Dune::Timer timer;
+    for (std::size_t i = 0; i < swTest.size(); ++i)
+        result[i] = law.krw(swTest[i]);
+    const auto lawTime = timer.elapsed();
+
+    timer.reset();
+    for (std::size_t i = 0; i < swTest.size(); ++i)
+        result[i] = tabulatedLaw.krw(swTest[i]);
+    const auto tabulatedTime = timer.elapsed();
+
+    timer.reset();
+    tabulatedLaw.krw(Span<const double>(swTest.data(), swTest.size()), Span<double>(result.data(), result.size()));
+    const auto manyTime = timer.elapsed();
+
+    std::cout << "krw of " << swTest.size() << " samples: original law " << lawTime << "s, "
+              << "tabulated law " << tabulatedTime << "s, tabulated law (many) " << manyTime << "s" << std::endl;
+}
+
+} // end namespace Dumux
+
+int main(int argc, char** argv)
+{
+    using namespace Dumux;
+    using namespace Dumux::FluidMatrix;
+
+    const std::array<double, 2> sweInterval{{ 0.1, 1.0 }};
+    const std::size_t numSwSamples = 1000;
+    const typename TwoPEffToAbsDefaultPolicy::template Params<double> effToAbsParams(0.05, 0.0);
+
+    using VG = VanGenuchtenNoReg<double>;
+    const VG vg(typename VG::BasicParams(2e-4, 2.5), effToAbsParams);
+    const TabulatedTwoPMaterialLaw<VG> vgTabulated(sweInterval, numSwSamples, VG(vg));
+    runTest("van Genuchten", vg, vgTabulated, 1e-3);
+
+    using BC = BrooksCoreyNoReg<double>;
+    const BC bc(typename BC::BasicParams(1e3, 2.0), effToAbsParams);
+    const TabulatedTwoPMaterialLaw<BC> bcTabulated(sweInterval, numSwSamples, BC(bc));
+    runTest("Brooks-Corey", bc, bcTabulated, 1e-3);
+
+    // laws with equal parameters share the table, laws with different parameters don't
+    const TabulatedTwoPMaterialLaw<VG> vgTabulated2(sweInterval, numSwSamples, VG(vg));
+    const TabulatedTwoPMaterialLaw<VG> vgTabulated3(sweInterval, numSwSamples, VG(typename VG::BasicParams(3e-4, 2.5), effToAbsParams));
+    const auto vgCopy = vgTabulated;
+    if (&vgTabulated2.table() != &vgTabulated.table() || &vgCopy.table() != &vgTabulated.table())
+        DUNE_THROW(Dune::Exception, "Laws with equal parameters do not share the table");
+    if (&vgTabulated3.table() == &vgTabulated.table())
+        DUNE_THROW(Dune::Exception, "Laws with different parameters share the table");
+
+    std::cout << "\nAll tests passed!" << std::endl;
+    return 0;
+}
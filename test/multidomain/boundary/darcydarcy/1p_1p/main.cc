@@ -49,6 +49,7 @@
 #include <dumux/multidomain/traits.hh>
 #include <dumux/multidomain/fvassembler.hh>
 #include <dumux/multidomain/newtonsolver.hh>
+#include <dumux/multidomain/partitionedsolver.hh>
 #include <dumux/multidomain/boundary/darcydarcy/couplingmanager.hh>
 
 #include "problem.hh"
@@ -57,6 +58,10 @@
 #define DOMAINSPLIT 0
 #endif
 
+#ifndef PARTITIONED
+#define PARTITIONED 0
+#endif
+
 namespace Dumux {
 namespace Properties {
 
@@ -256,15 +261,26 @@ int main(int argc, char** argv)
     auto linearSolver = std::make_shared<LinearSolver>();
 
     // the non-linear solver
+#if PARTITIONED
+    // solve the subdomains one after another, each with its own Newton and linear solver
+    using NonLinearSolver = MultiDomainPartitionedSolver<Assembler, CouplingManager, LinearSolver, LinearSolver>;
+    NonLinearSolver nonLinearSolver(assembler, std::make_tuple(linearSolver, std::make_shared<LinearSolver>()), couplingManager);
+#else
     using NewtonSolver = MultiDomainNewtonSolver<Assembler, LinearSolver, CouplingManager>;
     NewtonSolver nonLinearSolver(assembler, linearSolver, couplingManager);
+#endif
 
     // time loop
     timeLoop->start();
     while (!timeLoop->finished())
     {
+#if PARTITIONED
+        // solve the non-linear system with partitioned iterations
+        nonLinearSolver.solve(sol);
+#else
         // solve the non-linear system with time step control
         nonLinearSolver.solve(sol, *timeLoop);
+#endif
 
         // make the new solution the old solution
         oldSol = sol;
@@ -281,8 +297,10 @@ int main(int argc, char** argv)
         // report statistics of this time step
         timeLoop->reportTimeStep();
 
+#if !PARTITIONED
         // set new dt as suggested by newton controller
         timeLoop->setTimeStepSize(nonLinearSolver.suggestTimeStepSize(timeLoop->timeStepSize()));
+#endif
     }
 
     timeLoop->finalize(mpiHelper.getCollectiveCommunication());
@@ -0,0 +1,128 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*****************************************************************************
+ *   See the file COPYING for full copying permissions.                      *
+ *                                                                           *
+ *   This program is free software: you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by    *
+ *   the Free Software Foundation, either version 3 of the License, or       *
+ *   (at your option) any later version.                                     *
+ *                                                                           *
+ *   This program is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the            *
+ *   GNU General Public License for more details.                            *
+ *                                                                           *
+ *   You should have received a copy of the GNU General Public License       *
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.   *
+ *****************************************************************************/
+/*!
+ * \file
+ * \brief Test the interpolation operator of the embedded point source data:
+ *        compare the batched evaluation for all point sources and the update
+ *        for a deflected degree of freedom with the per-point interpolation
+ */
+#include <config.h>
+
+#include <iostream>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include <dune/common/exceptions.hh>
+#include <dune/common/fvector.hh>
+#include <dune/istl/bvector.hh>
+
+#include <dumux/multidomain/embedded/pointsourcedatastorage.hh>
+
+int main(int argc, char* argv[])
+{
+    using namespace Dumux;
+
+    using PriVars = Dune::FieldVector<double, 3>;
+    using SolutionVector = Dune::BlockVector<PriVars>;
+
+    constexpr std::size_t numDofs = 50;
+    constexpr std::size_t numPointSources = 200;
+
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<double> value(-1.0, 1.0);
+    std::uniform_int_distribution<std::size_t> dof(0, numDofs-1);
+    std::uniform_int_distribution<std::size_t> numEntries(1, 8);
+
+    SolutionVector x(numDofs);
+    for (auto& priVars : x)
+        for (auto& pv : priVars)
+            pv = value(gen);
+
+    // random interpolation stencils, some of them contain an index several times
+    EmbeddedCoupling::InterpolationOperator<double, std::size_t> interpolation;
+    std::vector<std::vector<std::pair<std::size_t, double>>> stencils(numPointSources);
+    for (auto& stencil : stencils)
+    {
+        const auto n = numEntries(gen);
+        for (std::size_t k = 0; k < n; ++k)
+            stencil.emplace_back(dof(gen), value(gen));
+        interpolation.addRow(stencil);
+    }
+
+    if (interpolation.size() != numPointSources)
+        DUNE_THROW(Dune::Exception, "Wrong number of rows: " << interpolation.size());
+
+    // the interpolation of a single point source
+    const auto interpolate = [&](const auto& stencil, const SolutionVector& sol)
+    {
+        PriVars priVars(0.0);
+        for (const auto& [idx, weight] : stencil)
+            priVars.axpy(weight, sol[idx]);
+        return priVars;
+    };
+
+    // the interpolated values are sums of values of both signs (compare absolutely)
+    const auto equal = [](const PriVars& a, const PriVars& b, double eps)
+    {
+        auto diff = a;
+        diff -= b;
+        return diff.infinity_norm() < eps;
+    };
+
+    // evaluate all point sources at once and compare with the per-point interpolation
+    std::vector<PriVars> priVars;
+    interpolation.apply(x, priVars);
+    if (priVars.size() != numPointSources)
+        DUNE_THROW(Dune::Exception, "Wrong size of the batched result: " << priVars.size());
+
+    for (std::size_t id = 0; id < numPointSources; ++id)
+    {
+        const auto ref = interpolate(stencils[id], x);
+        if (!equal(priVars[id], ref, 1e-13))
+            DUNE_THROW(Dune::Exception, "Batched interpolation for point source " << id << ": " << priVars[id] << ", expected " << ref);
+        if (!equal(interpolation.applyRow(id, x), ref, 1e-13))
+            DUNE_THROW(Dune::Exception, "Interpolation for point source " << id << ": " << interpolation.applyRow(id, x) << ", expected " << ref);
+    }
+
+    // deflect single degrees of freedom and update the batched result with the interpolation weights
+    for (std::size_t dofIdx = 0; dofIdx < numDofs; dofIdx += 7)
+    {
+        auto xDeflected = x;
+        PriVars delta;
+        for (auto& d : delta)
+            d = 1e-3*value(gen);
+        xDeflected[dofIdx] += delta;
+
+        for (std::size_t id = 0; id < numPointSources; ++id)
+        {
+            auto updated = priVars[id];
+            interpolation.applyIncrement(id, dofIdx, delta, updated);
+
+            const auto ref = interpolate(stencils[id], xDeflected);
+            if (!equal(updated, ref, 1e-13))
+                DUNE_THROW(Dune::Exception, "Updated interpolation for point source " << id << " after deflecting dof " << dofIdx
+                                             << ": " << updated << ", expected " << ref);
+        }
+    }
+
+    std::cout << "Interpolation operator test passed for " << numPointSources << " point sources and "
+              << interpolation.numEntries() << " entries." << std::endl;
+    return 0;
+}
@@ -0,0 +1,235 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*****************************************************************************
+ *   See the file COPYING for full copying permissions.                      *
+ *                                                                           *
+ *   This program is free software: you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by    *
+ *   the Free Software Foundation, either version 3 of the License, or       *
+ *   (at your option) any later version.                                     *
+ *                                                                           *
+ *   This program is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the            *
+ *   GNU General Public License for more details.                            *
+ *                                                                           *
+ *   You should have received a copy of the GNU General Public License       *
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.   *
+ *****************************************************************************/
+/*!
+ * \file
+ * \ingroup FacetTests
+ * \brief Test for the multithreaded assembly of the one-phase facet coupling model.
+ *        The system is assembled repeatedly with several threads and compared to the serial assembly.
+ */
+#include <config.h>
+
+#include <cmath>
+#include <iostream>
+
+#if _OPENMP
+#include <omp.h>
+#endif
+
+#include <dune/common/parallel/mpihelper.hh>
+#include <dune/common/timer.hh>
+
+#include <dumux/common/properties.hh>
+#include <dumux/common/parameters.hh>
+#include <dumux/common/dumuxmessage.hh>
+
+#include <dumux/assembly/diffmethod.hh>
+#include <dumux/linear/matrixconverter.hh>
+
+#include <dumux/multidomain/fvassembler.hh>
+#include <dumux/multidomain/traits.hh>
+
+#include <dumux/multidomain/facet/gridmanager.hh>
+#include <dumux/multidomain/facet/couplingmapper.hh>
+#include <dumux/multidomain/facet/couplingmanager.hh>
+
+#include "problem_bulk.hh"
+#include "problem_lowdim.hh"
+
+namespace Dumux {
+
+// obtain/define some types to be used below in the property definitions and in main
+template< class BulkTypeTag, class LowDimTypeTag >
+class TestTraits
+{
+    using BulkFVGridGeometry = GetPropType<BulkTypeTag, Properties::GridGeometry>;
+    using LowDimFVGridGeometry = GetPropType<LowDimTypeTag, Properties::GridGeometry>;
+public:
+    using MDTraits = Dumux::MultiDomainTraits<BulkTypeTag, LowDimTypeTag>;
+    using CouplingMapper = Dumux::FacetCouplingMapper<BulkFVGridGeometry, LowDimFVGridGeometry>;
+    using CouplingManager = Dumux::FacetCouplingManager<MDTraits, CouplingMapper>;
+};
+
+namespace Properties {
+
+// set cm property in the sub-problems
+using TpfaTraits = TestTraits<TTag::OnePBulkTpfa, TTag::OnePLowDimTpfa>;
+using MpfaTraits = TestTraits<TTag::OnePBulkMpfa, TTag::OnePLowDimMpfa>;
+template<class TypeTag> struct CouplingManager<TypeTag, TTag::OnePBulkTpfa> { using type = typename TpfaTraits::CouplingManager; };
+template<class TypeTag> struct CouplingManager<TypeTag, TTag::OnePLowDimTpfa> { using type = typename TpfaTraits::CouplingManager; };
+template<class TypeTag> struct CouplingManager<TypeTag, TTag::OnePBulkMpfa> { using type = typename MpfaTraits::CouplingManager; };
+template<class TypeTag> struct CouplingManager<TypeTag, TTag::OnePLowDimMpfa> { using type = typename MpfaTraits::CouplingManager; };
+} // end namespace Properties
+} // end namespace Dumux
+
+// main program
+int main(int argc, char** argv)
+{
+    using namespace Dumux;
+
+    //////////////////////////////////////////////////////
+    //////////////////////////////////////////////////////
+
+    // initialize MPI, finalize is done automatically on exit
+    const auto& mpiHelper = Dune::MPIHelper::instance(argc, argv);
+
+    // print dumux start message
+    if (mpiHelper.rank() == 0)
+        DumuxMessage::print(/*firstCall=*/true);
+
+    // initialize parameter tree
+    Parameters::init(argc, argv);
+
+    //////////////////////////////////////////////////////
+    // try to create the grids (from the given grid file)
+    //////////////////////////////////////////////////////
+    using BulkProblemTypeTag = Properties::TTag::BULKTYPETAG;
+    using LowDimProblemTypeTag = Properties::TTag::LOWDIMTYPETAG;
+    using BulkGrid = GetPropType<BulkProblemTypeTag, Properties::Grid>;
+    using LowDimGrid = GetPropType<LowDimProblemTypeTag, Properties::Grid>;
+
+    using GridManager = FacetCouplingGridManager<BulkGrid, LowDimGrid>;
+    GridManager gridManager;
+    gridManager.init();
+    gridManager.loadBalance();
+
+    ////////////////////////////////////////////////////////////
+    // run stationary, non-linear problem on this grid
+    ////////////////////////////////////////////////////////////
+
+    // we compute on the leaf grid views
+    const auto& bulkGridView = gridManager.template grid<0>().leafGridView();
+    const auto& lowDimGridView = gridManager.template grid<1>().leafGridView();
+
+    // create the finite volume grid geometries
+    using BulkFVGridGeometry = GetPropType<BulkProblemTypeTag, Properties::GridGeometry>;
+    using LowDimFVGridGeometry = GetPropType<LowDimProblemTypeTag, Properties::GridGeometry>;
+    auto bulkFvGridGeometry = std::make_shared<BulkFVGridGeometry>(bulkGridView);
+    auto lowDimFvGridGeometry = std::make_shared<LowDimFVGridGeometry>(lowDimGridView);
+    bulkFvGridGeometry->update();
+    lowDimFvGridGeometry->update();
+
+    // the coupling mapper
+    using TestTraits = TestTraits<BulkProblemTypeTag, LowDimProblemTypeTag>;
+    auto couplingMapper = std::make_shared<typename TestTraits::CouplingMapper>();
+    couplingMapper->update(*bulkFvGridGeometry, *lowDimFvGridGeometry, gridManager.getEmbeddings());
+
+    // the coupling manager
+    using CouplingManager = typename TestTraits::CouplingManager;
+    auto couplingManager = std::make_shared<CouplingManager>();
+
+    // the problems (boundary conditions)
+    using BulkProblem = GetPropType<BulkProblemTypeTag, Properties::Problem>;
+    using LowDimProblem = GetPropType<LowDimProblemTypeTag, Properties::Problem>;
+    auto bulkSpatialParams = std::make_shared<typename BulkProblem::SpatialParams>(bulkFvGridGeometry, "Bulk");
+    auto bulkProblem = std::make_shared<BulkProblem>(bulkFvGridGeometry, bulkSpatialParams, couplingManager, "Bulk");
+    auto lowDimSpatialParams = std::make_shared<typename LowDimProblem::SpatialParams>(lowDimFvGridGeometry, "LowDim");
+    auto lowDimProblem = std::make_shared<LowDimProblem>(lowDimFvGridGeometry, lowDimSpatialParams, couplingManager, "LowDim");
+
+    // the solution vector
+    using MDTraits = typename TestTraits::MDTraits;
+    using SolutionVector = typename MDTraits::SolutionVector;
+    SolutionVector x;
+
+    static const auto bulkId = typename MDTraits::template SubDomain<0>::Index();
+    static const auto lowDimId = typename MDTraits::template SubDomain<1>::Index();
+    x[bulkId].resize(bulkFvGridGeometry->numDofs());
+    x[lowDimId].resize(lowDimFvGridGeometry->numDofs());
+    bulkProblem->applyInitialSolution(x[bulkId]);
+    lowDimProblem->applyInitialSolution(x[lowDimId]);
+
+    // perturb the solution such that the residual does not vanish
+    for (std::size_t i = 0; i < x[bulkId].size(); ++i)
+        x[bulkId][i] += std::sin(0.7*i);
+    for (std::size_t i = 0; i < x[lowDimId].size(); ++i)
+        x[lowDimId][i] += std::cos(1.3*i);
+
+    // initialize coupling manager
+    couplingManager->init(bulkProblem, lowDimProblem, couplingMapper, x);
+
+    // the grid variables
+    using BulkGridVariables = GetPropType<BulkProblemTypeTag, Properties::GridVariables>;
+    using LowDimGridVariables = GetPropType<LowDimProblemTypeTag, Properties::GridVariables>;
+    auto bulkGridVariables = std::make_shared<BulkGridVariables>(bulkProblem, bulkFvGridGeometry);
+    auto lowDimGridVariables = std::make_shared<LowDimGridVariables>(lowDimProblem, lowDimFvGridGeometry);
+    bulkGridVariables->init(x[bulkId]);
+    lowDimGridVariables->init(x[lowDimId]);
+
+    // the assembler
+    using Assembler = MultiDomainFVAssembler<MDTraits, CouplingManager, DiffMethod::numeric, /*implicit?*/true>;
+    auto assembler = std::make_shared<Assembler>( std::make_tuple(bulkProblem, lowDimProblem),
+                                                  std::make_tuple(bulkFvGridGeometry, lowDimFvGridGeometry),
+                                                  std::make_tuple(bulkGridVariables, lowDimGridVariables),
+                                                  couplingManager);
+
+    if (!Multithreading::isThreaded || !assembler->isMultithreaded(bulkId) || !assembler->isMultithreaded(lowDimId))
+        DUNE_THROW(Dune::InvalidStateException, "This test requires a multithreading backend and cell-centered subdomains without caching");
+
+#if _OPENMP
+    omp_set_num_threads(8);
+#endif
+    std::cout << "Assembling with up to " << Multithreading::maxThreads() << " threads" << std::endl;
+
+    using JacobianMatrix = typename Assembler::JacobianMatrix;
+    using MatrixConverter = Dumux::MatrixConverter<JacobianMatrix>;
+    using VectorConverter = Dumux::VectorConverter<SolutionVector>;
+
+    // the reference: serial assembly
+    assembler->enableMultithreading(false);
+    couplingManager->updateSolution(x);
+    Dune::Timer timer;
+    assembler->assembleJacobianAndResidual(x);
+    const auto serialTime = timer.elapsed();
+    const auto refJacobian = MatrixConverter::multiTypeToBCRSMatrix(assembler->jacobian());
+    const auto refResidual = VectorConverter::multiTypeToBlockVector(assembler->residual());
+    const auto jacobianScale = refJacobian.infinity_norm();
+    const auto residualScale = refResidual.infinity_norm();
+
+    // assemble many times with several threads and compare
+    assembler->enableMultithreading(true);
+    const int numAssemblies = 20;
+    double threadedTime = 0.0;
+    for (int k = 0; k < numAssemblies; ++k)
+    {
+        timer.reset();
+        assembler->assembleJacobianAndResidual(x);
+        threadedTime += timer.elapsed();
+
+        auto jacobian = MatrixConverter::multiTypeToBCRSMatrix(assembler->jacobian());
+        auto residual = VectorConverter::multiTypeToBlockVector(assembler->residual());
+        jacobian -= refJacobian;
+        residual -= refResidual;
+
+        const auto jacobianError = jacobian.infinity_norm()/jacobianScale;
+        const auto residualError = residual.infinity_norm()/residualScale;
+        if (jacobianError > 1e-12 || residualError > 1e-12)
+            DUNE_THROW(Dune::Exception, "Multithreaded assembly " << k << " differs from the serial assembly"
+                                        << " (relative errors: Jacobian " << jacobianError << ", residual " << residualError << ")");
+    }
+
+    std::cout << numAssemblies << " multithreaded assemblies match the serial assembly"
+              << " (serial " << serialTime << "s, multithreaded " << threadedTime/numAssemblies << "s per assembly)" << std::endl;
+
+    if (mpiHelper.rank() == 0)
+    {
+        Parameters::print();
+        DumuxMessage::print(/*firstCall=*/false);
+    }
+
+    return 0;
+}
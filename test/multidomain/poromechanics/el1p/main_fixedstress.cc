@@ -0,0 +1,228 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*****************************************************************************
+ *   See the file COPYING for full copying permissions.                      *
+ *                                                                           *
+ *   This program is free software: you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by    *
+ *   the Free Software Foundation, either version 3 of the License, or       *
+ *   (at your option) any later version.                                     *
+ *                                                                           *
+ *   This program is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the            *
+ *   GNU General Public License for more details.                            *
+ *                                                                           *
+ *   You should have received a copy of the GNU General Public License       *
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.   *
+ *****************************************************************************/
+/*!
+ * \file
+ * \ingroup PoromechanicsTests
+ * \brief Test for the fixed-stress split solvers with the single-phase elastic coupled model.
+ *        The solution of the split iterations and the one of the monolithic Newton solver with the
+ *        fixed-stress preconditioner are compared to the monolithic solution.
+ */
+
+#include <config.h>
+
+#include <cmath>
+#include <iostream>
+#include <algorithm>
+
+#include <dune/common/parallel/mpihelper.hh>
+
+#include "problem_1p.hh"
+#include "problem_poroelastic.hh"
+
+#include <dumux/common/properties.hh>
+#include <dumux/common/parameters.hh>
+#include <dumux/common/dumuxmessage.hh>
+
+#include <dumux/assembly/diffmethod.hh>
+
+#include <dumux/linear/amgbackend.hh>
+#include <dumux/linear/linearsolvertraits.hh>
+#include <dumux/linear/seqsolverbackend.hh>
+#include <dumux/multidomain/newtonsolver.hh>
+#include <dumux/multidomain/fvassembler.hh>
+#include <dumux/multidomain/traits.hh>
+
+#include <dumux/geomechanics/poroelastic/couplingmanager.hh>
+#include <dumux/geomechanics/poroelastic/fixedstresssolver.hh>
+
+#include <dumux/io/grid/gridmanager.hh>
+
+// set the coupling manager property in the sub-problems
+namespace Dumux {
+namespace Properties {
+
+template<class TypeTag>
+struct CouplingManager<TypeTag, TTag::OnePSub>
+{
+private:
+    using Traits = MultiDomainTraits<TTag::OnePSub, TTag::PoroElasticSub>;
+public:
+    using type = PoroMechanicsCouplingManager< Traits >;
+};
+
+template<class TypeTag>
+struct CouplingManager<TypeTag, TTag::PoroElasticSub>
+{
+private:
+    using Traits = MultiDomainTraits<TTag::OnePSub, TTag::PoroElasticSub>;
+public:
+    using type = PoroMechanicsCouplingManager< Traits >;
+};
+} // end namespace Properties
+} // end namespace Dumux
+
+//! The maximum difference of two solutions relative to the maximum magnitude of the reference
+template<class SubSolutionVector>
+double relativeDifference(const SubSolutionVector& x, const SubSolutionVector& xRef)
+{
+    double diff = 0.0, scale = 1e-100;
+    for (std::size_t i = 0; i < x.size(); ++i)
+    {
+        for (std::size_t j = 0; j < x[i].size(); ++j)
+        {
+            diff = std::max(diff, std::abs(x[i][j] - xRef[i][j]));
+            scale = std::max(scale, std::abs(xRef[i][j]));
+        }
+    }
+    return diff/scale;
+}
+
+int main(int argc, char** argv)
+{
+    using namespace Dumux;
+
+    // initialize MPI, finalize is done automatically on exit
+    const auto& mpiHelper = Dune::MPIHelper::instance(argc, argv);
+
+    // print dumux start message
+    if (mpiHelper.rank() == 0)
+        DumuxMessage::print(/*firstCall=*/true);
+
+    // initialize parameter tree
+    Parameters::init(argc, argv);
+
+    using OnePTypeTag = Properties::TTag::OnePSub;
+    using PoroMechTypeTag = Properties::TTag::PoroElasticSub;
+
+    using GridManager = Dumux::GridManager<GetPropType<OnePTypeTag, Properties::Grid>>;
+    GridManager gridManager;
+    gridManager.init();
+    const auto& leafGridView = gridManager.grid().leafGridView();
+
+    // create the finite volume grid geometries
+    using OnePFVGridGeometry = GetPropType<OnePTypeTag, Properties::GridGeometry>;
+    using PoroMechFVGridGeometry = GetPropType<PoroMechTypeTag, Properties::GridGeometry>;
+    auto onePFvGridGeometry = std::make_shared<OnePFVGridGeometry>(leafGridView);
+    auto poroMechFvGridGeometry = std::make_shared<PoroMechFVGridGeometry>(leafGridView);
+    onePFvGridGeometry->update();
+    poroMechFvGridGeometry->update();
+
+    // the coupling manager
+    using Traits = MultiDomainTraits<OnePTypeTag, PoroMechTypeTag>;
+    using CouplingManager = PoroMechanicsCouplingManager<Traits>;
+    auto couplingManager = std::make_shared<CouplingManager>();
+
+    // the problems (boundary conditions)
+    using OnePProblem = GetPropType<OnePTypeTag, Properties::Problem>;
+    using PoroMechProblem = GetPropType<PoroMechTypeTag, Properties::Problem>;
+    auto onePSpatialParams = std::make_shared<typename OnePProblem::SpatialParams>(onePFvGridGeometry, couplingManager);
+    auto onePProblem = std::make_shared<OnePProblem>(onePFvGridGeometry, onePSpatialParams, "OneP");
+    auto poroMechProblem = std::make_shared<PoroMechProblem>(poroMechFvGridGeometry, couplingManager, "PoroElastic");
+
+    // the initial solution
+    using SolutionVector = typename Traits::SolutionVector;
+    SolutionVector x0;
+
+    static const auto onePId = Traits::template SubDomain<0>::Index();
+    static const auto poroMechId = Traits::template SubDomain<1>::Index();
+    x0[onePId].resize(onePFvGridGeometry->numDofs());
+    x0[poroMechId].resize(poroMechFvGridGeometry->numDofs());
+    onePProblem->applyInitialSolution(x0[onePId]);
+    poroMechProblem->applyInitialSolution(x0[poroMechId]);
+
+    // initialize the coupling manager
+    couplingManager->init(onePProblem, poroMechProblem, x0);
+
+    // the grid variables
+    using OnePGridVariables = GetPropType<OnePTypeTag, Properties::GridVariables>;
+    using PoroMechGridVariables = GetPropType<PoroMechTypeTag, Properties::GridVariables>;
+    auto onePGridVariables = std::make_shared<OnePGridVariables>(onePProblem, onePFvGridGeometry);
+    auto poroMechGridVariables = std::make_shared<PoroMechGridVariables>(poroMechProblem, poroMechFvGridGeometry);
+
+    // the assembler
+    using Assembler = MultiDomainFVAssembler<Traits, CouplingManager, DiffMethod::numeric, /*implicit?*/true>;
+    auto assembler = std::make_shared<Assembler>( std::make_tuple(onePProblem, poroMechProblem),
+                                                  std::make_tuple(onePFvGridGeometry, poroMechFvGridGeometry),
+                                                  std::make_tuple(onePGridVariables, poroMechGridVariables),
+                                                  couplingManager);
+
+    // (re-)initialize the coupling manager and the grid variables with the initial solution
+    const auto reset = [&](SolutionVector& x)
+    {
+        x = x0;
+        couplingManager->updateSolution(x);
+        onePGridVariables->init(x[onePId]);
+        poroMechGridVariables->init(x[poroMechId]);
+    };
+
+    // the reference: the monolithic Newton solver
+    SolutionVector xRef;
+    reset(xRef);
+    using RefLinearSolver = ILU0BiCGSTABBackend;
+    auto refLinearSolver = std::make_shared<RefLinearSolver>();
+    using RefNewtonSolver = MultiDomainNewtonSolver<Assembler, RefLinearSolver, CouplingManager>;
+    RefNewtonSolver refNewtonSolver(assembler, refLinearSolver, couplingManager);
+    refNewtonSolver.solve(xRef);
+
+    // the fixed-stress split iterations with an AMG solver per subdomain
+    SolutionVector x;
+    reset(x);
+    using OnePLinearSolver = AMGBiCGSTABBackend<LinearSolverTraits<OnePFVGridGeometry>>;
+    using PoroMechLinearSolver = AMGBiCGSTABBackend<LinearSolverTraits<PoroMechFVGridGeometry>>;
+    auto onePLinearSolver = std::make_shared<OnePLinearSolver>("FixedStress");
+    auto poroMechLinearSolver = std::make_shared<PoroMechLinearSolver>("FixedStress");
+    using SplitSolver = FixedStressSplitSolver<Assembler, OnePLinearSolver, PoroMechLinearSolver, CouplingManager>;
+    SplitSolver splitSolver(assembler, onePLinearSolver, poroMechLinearSolver, couplingManager);
+    splitSolver.solve(x);
+
+    const auto splitDiffOneP = relativeDifference(x[onePId], xRef[onePId]);
+    const auto splitDiffPoroMech = relativeDifference(x[poroMechId], xRef[poroMechId]);
+    std::cout << "Fixed-stress split: " << splitSolver.numIterations() << " iterations, relative difference to the monolithic solution "
+              << splitDiffOneP << " (pressure), " << splitDiffPoroMech << " (displacement)" << std::endl;
+    if (!(splitDiffOneP < 1e-6 && splitDiffPoroMech < 1e-6))
+        DUNE_THROW(Dune::Exception, "The fixed-stress split differs from the monolithic solution");
+
+    // the monolithic Newton solver with the fixed-stress preconditioner
+    reset(x);
+    using FixedStressLinearSolver = FixedStressBiCGSTABBackend<Assembler>;
+    auto fixedStressLinearSolver = std::make_shared<FixedStressLinearSolver>("FixedStress");
+    const auto beta = getParam<double>("FixedStress.StabilizationParameter");
+    fixedStressLinearSolver->setStabilization(computeFixedStressStabilization(*assembler, beta));
+    using NewtonSolver = MultiDomainNewtonSolver<Assembler, FixedStressLinearSolver, CouplingManager>;
+    NewtonSolver newtonSolver(assembler, fixedStressLinearSolver, couplingManager);
+    newtonSolver.solve(x);
+
+    const auto precDiffOneP = relativeDifference(x[onePId], xRef[onePId]);
+    const auto precDiffPoroMech = relativeDifference(x[poroMechId], xRef[poroMechId]);
+    std::cout << "Fixed-stress preconditioner: relative difference to the monolithic solution "
+              << precDiffOneP << " (pressure), " << precDiffPoroMech << " (displacement)" << std::endl;
+    if (!(precDiffOneP < 1e-6 && precDiffPoroMech < 1e-6))
+        DUNE_THROW(Dune::Exception, "The fixed-stress preconditioned solution differs from the monolithic solution");
+
+    ////////////////////////////////////////////////////////////
+    // finalize, print dumux message to say goodbye
+    ////////////////////////////////////////////////////////////
+    if (mpiHelper.rank() == 0)
+    {
+        Parameters::print();
+        DumuxMessage::print(/*firstCall=*/false);
+    }
+
+    return 0;
+}
@@ -0,0 +1,187 @@
+#include <config.h>
+
+#include <cmath>
+#include <memory>
+#include <vector>
+#include <iomanip>
+#include <iostream>
+#include <algorithm>
+
+#include <dune/common/exceptions.hh>
+#include <dune/common/float_cmp.hh>
+#include <dune/common/parallel/mpihelper.hh>
+#include <dune/istl/bvector.hh>
+#include <dumux/nonlinear/newtonsolver.hh>
+
+/*
+
+  This test solves a scalar non-linear equation with the inexact Newton method
+  (Newton.UseInexactNewton) and checks the Eisenstat-Walker forcing term,
+  i.e. the residual reduction set in the linear solver, in each Newton iteration.
+  The mock linear solver only reduces the linear residual by half the forcing term.
+  The forcing term is bounded from below by the residual reduction the linear solver
+  is configured with, which is restored after the solve. This is the value set by the
+  Newton solver on construction (LinearSolver.ResidualReduction) unless the backend
+  keeps its own configured value (linearSolverKeepsConfiguredResidualReduction).
+
+ */
+
+namespace Dumux {
+
+class MockScalarAssembler
+{
+public:
+    using Scalar = double;
+    using ResidualType = Scalar;
+    using JacobianMatrix = Scalar;
+    using SolutionVector = Scalar;
+    using Variables = Scalar;
+
+    void setLinearSystem() {}
+
+    ResidualType prevSol() { return ResidualType(0.0); }
+
+    void resetTimeStep(const ResidualType& sol) {}
+
+    void assembleResidual(const ResidualType& sol)
+    {
+        res_ = sol*sol - 5.0;
+    }
+
+    void assembleJacobianAndResidual (const ResidualType& sol)
+    {
+        assembleResidual(sol);
+        jac_ = 2.0*sol;
+    }
+
+    JacobianMatrix& jacobian() { return jac_; }
+
+    ResidualType& residual() { return res_; }
+
+private:
+    JacobianMatrix jac_;
+    ResidualType res_;
+};
+
+template<bool keepsConfiguredReduction>
+class MockInexactLinearSolver
+{
+public:
+    explicit MockInexactLinearSolver(double configuredReduction)
+    : reduction_(configuredReduction)
+    {}
+
+    void setResidualReduction(double residualReduction)
+    { reduction_ = residualReduction; }
+
+    template<class Vector>
+    bool solve(const double& A, Vector& x, const Vector& b)
+    {
+        residualNorms.push_back(norm(b[0]));
+        reductions.push_back(reduction_);
+
+        // leave a linear residual of half the requested reduction
+        x[0] = b[0]/A*(1.0 - 0.5*reduction_);
+        return true;
+    }
+
+    double norm(const double& residual) const
+    {
+        using std::abs;
+        return abs(residual);
+    }
+
+    double residReduction() const
+    { return reduction_; }
+
+    std::vector<double> residualNorms;
+    std::vector<double> reductions;
+
+private:
+    double reduction_;
+};
+
+//! the mock backend configured with its own tolerance (like e.g. the IstlSolverFactoryBackend)
+template<>
+struct linearSolverKeepsConfiguredResidualReduction<MockInexactLinearSolver<true>> : public std::true_type {};
+
+} // end namespace Dumux
+
+int main(int argc, char* argv[])
+{
+    using namespace Dumux;
+
+    // maybe initialize MPI
+    Dune::MPIHelper::instance(argc, argv);
+
+    // initialize parameters and enable the inexact Newton method
+    Parameters::init(argc, argv, [](Dune::ParameterTree& params){
+        params["Newton.UseInexactNewton"] = "true";
+        params["Newton.MaxRelativeShift"] = "1e-12";
+        params["LinearSolver.ResidualReduction"] = "1e-10";
+    });
+
+    using Assembler = MockScalarAssembler;
+
+    // the configured tolerance of the mock backend differs from LinearSolver.ResidualReduction
+    const auto testInexactNewton = [](auto linearSolver, double minForcingTerm)
+    {
+        using LinearSolver = typename decltype(linearSolver)::element_type;
+        using Solver = NewtonSolver<Assembler, LinearSolver, DefaultPartialReassembler>;
+
+        auto assembler = std::make_shared<Assembler>();
+        auto solver = std::make_shared<Solver>(assembler, linearSolver);
+
+        if (Dune::FloatCmp::ne(linearSolver->residReduction(), minForcingTerm))
+            DUNE_THROW(Dune::Exception, "Wrong linear solver tolerance after construction: " << linearSolver->residReduction()
+                                        << ", expected " << minForcingTerm);
+
+        double x = 0.1;
+        std::cout << "Solving: x^2 - 5 = 0 with the inexact Newton method (linear solver tolerance "
+                  << minForcingTerm << ")" << std::endl;
+        solver->solve(x);
+
+        if (Dune::FloatCmp::ne(x, std::sqrt(5.0), 1e-12))
+            DUNE_THROW(Dune::Exception, "Didn't find correct root: " << std::setprecision(15) << x << ", exact: " << std::sqrt(5.0));
+
+        // recompute the forcing terms (Eisenstat-Walker choice 2 with safeguards, default parameters)
+        const double gamma = 0.9, alpha = 2.0, maxForcingTerm = 0.9;
+        const auto& norms = linearSolver->residualNorms;
+        const auto& reductions = linearSolver->reductions;
+        if (norms.size() < 3)
+            DUNE_THROW(Dune::Exception, "Expected at least three Newton iterations, got " << norms.size());
+
+        double eta = maxForcingTerm;
+        for (std::size_t k = 0; k < norms.size(); ++k)
+        {
+            if (k > 0)
+            {
+                const double lastEta = eta;
+                eta = gamma*std::pow(norms[k]/norms[k-1], alpha);
+                const double etaSafeguard = gamma*std::pow(lastEta, alpha);
+                if (etaSafeguard > 0.1)
+                    eta = std::max(eta, etaSafeguard);
+                eta = std::min(eta, maxForcingTerm);
+            }
+            eta = std::max(eta, minForcingTerm);
+
+            std::cout << "Iteration " << k << ": residual norm " << norms[k] << ", forcing term " << reductions[k]
+                      << " (expected " << eta << ")" << std::endl;
+            if (Dune::FloatCmp::ne(reductions[k], eta, 1e-12))
+                DUNE_THROW(Dune::Exception, "Wrong forcing term " << reductions[k] << " in iteration " << k << ", expected " << eta);
+        }
+
+        // the configured tolerance is restored after the solve
+        if (Dune::FloatCmp::ne(linearSolver->residReduction(), minForcingTerm))
+            DUNE_THROW(Dune::Exception, "The linear solver tolerance was not restored: " << linearSolver->residReduction()
+                                        << ", expected " << minForcingTerm);
+    };
+
+    // the Newton solver sets LinearSolver.ResidualReduction on construction
+    testInexactNewton(std::make_shared<MockInexactLinearSolver<false>>(1e-8), 1e-10);
+
+    // the backend keeps its own configured tolerance
+    testInexactNewton(std::make_shared<MockInexactLinearSolver<true>>(1e-8), 1e-8);
+
+    return 0;
+}
@@ -0,0 +1,177 @@
+#include <config.h>
+
+#include <cmath>
+#include <memory>
+#include <iomanip>
+#include <vector>
+#include <iostream>
+
+#include <dune/common/exceptions.hh>
+#include <dune/common/float_cmp.hh>
+#include <dune/common/parallel/mpihelper.hh>
+#include <dune/istl/bvector.hh>
+#include <dumux/common/timeloop.hh>
+#include <dumux/nonlinear/newtonsolver.hh>
+
+/*
+
+  This test solves the scalar non-linear ordinary differential equation
+  du/dt + u^3 = 2 + sin(t) with the implicit Euler method, once with the
+  solution of the last time step as initial guess of the Newton method and
+  once with the extrapolation predictor (Newton.PredictorOrder). The predictor
+  must not increase the number of Newton iterations and has to yield the same solution.
+
+ */
+
+namespace Dumux {
+
+class MockInstationaryScalarAssembler
+{
+public:
+    using Scalar = double;
+    using ResidualType = Scalar;
+    using JacobianMatrix = Scalar;
+    using SolutionVector = Scalar;
+    using Variables = Scalar;
+
+    MockInstationaryScalarAssembler(std::shared_ptr<const TimeLoop<Scalar>> timeLoop)
+    : timeLoop_(timeLoop)
+    {}
+
+    void setLinearSystem() {}
+
+    void setPreviousSolution(const SolutionVector& sol)
+    { prevSol_ = sol; }
+
+    const SolutionVector& prevSol() const
+    { return prevSol_; }
+
+    void resetTimeStep(const ResidualType& sol) {}
+
+    void assembleResidual(const ResidualType& sol)
+    {
+        using std::sin;
+        const auto dt = timeLoop_->timeStepSize();
+        const auto t = timeLoop_->time() + dt;
+        res_ = (sol - prevSol_)/dt + sol*sol*sol - 2.0 - sin(t);
+    }
+
+    void assembleJacobianAndResidual(const ResidualType& sol)
+    {
+        assembleResidual(sol);
+        jac_ = 1.0/timeLoop_->timeStepSize() + 3.0*sol*sol;
+    }
+
+    JacobianMatrix& jacobian() { return jac_; }
+
+    ResidualType& residual() { return res_; }
+
+private:
+    std::shared_ptr<const TimeLoop<Scalar>> timeLoop_;
+    SolutionVector prevSol_ = 0.0;
+    JacobianMatrix jac_;
+    ResidualType res_;
+};
+
+class MockCountingScalarLinearSolver
+{
+public:
+    void setResidualReduction(double residualReduction) {}
+
+    template<class Vector>
+    bool solve(const double& A, Vector& x, const Vector& b)
+    {
+        ++numSolves_;
+        x[0] = b[0]/A;
+        return true;
+    }
+
+    double norm(const double& residual) const
+    {
+        using std::abs;
+        return abs(residual);
+    }
+
+    //! the number of linear solves, i.e. the number of Newton iterations
+    std::size_t numSolves() const
+    { return numSolves_; }
+
+private:
+    std::size_t numSolves_ = 0;
+};
+
+namespace Test {
+
+struct Result
+{
+    std::vector<double> solutions;
+    std::size_t numIterations;
+};
+
+//! solve the time-dependent problem with the given predictor order
+Result solve(std::size_t predictorOrder)
+{
+    using Assembler = MockInstationaryScalarAssembler;
+    using LinearSolver = MockCountingScalarLinearSolver;
+    using Solver = NewtonSolver<Assembler, LinearSolver, DefaultPartialReassembler>;
+
+    auto timeLoop = std::make_shared<TimeLoop<double>>(0.0, 0.1, 2.0, false);
+    auto assembler = std::make_shared<Assembler>(timeLoop);
+    auto linearSolver = std::make_shared<LinearSolver>();
+    auto solver = std::make_shared<Solver>(assembler, linearSolver);
+    solver->predictor().setOrder(predictorOrder);
+
+    Result result;
+    double u = 1.0;
+    timeLoop->start(); do
+    {
+        assembler->setPreviousSolution(u);
+        solver->solve(u, *timeLoop);
+        result.solutions.push_back(u);
+
+        timeLoop->advanceTimeStep();
+    } while (!timeLoop->finished());
+
+    result.numIterations = linearSolver->numSolves();
+    return result;
+}
+
+} // end namespace Test
+} // end namespace Dumux
+
+int main(int argc, char* argv[])
+{
+    using namespace Dumux;
+
+    // maybe initialize MPI
+    Dune::MPIHelper::instance(argc, argv);
+
+    // initialize parameters with a tight convergence criterion to compare the solutions
+    Parameters::init(argc, argv, [](Dune::ParameterTree& params){
+        params["Newton.MaxRelativeShift"] = "1e-12";
+        params["Newton.Verbosity"] = "0";
+    });
+
+    const auto reference = Test::solve(0);
+    for (std::size_t order : {1, 2})
+    {
+        const auto predicted = Test::solve(order);
+        std::cout << "Newton iterations with predictor order " << order << ": " << predicted.numIterations
+                  << " (without predictor: " << reference.numIterations << ")" << std::endl;
+
+        if (predicted.numIterations > reference.numIterations)
+            DUNE_THROW(Dune::Exception, "The predictor of order " << order << " increased the number of Newton iterations from "
+                                         << reference.numIterations << " to " << predicted.numIterations);
+
+        if (predicted.solutions.size() != reference.solutions.size())
+            DUNE_THROW(Dune::Exception, "Different number of time steps with predictor of order " << order);
+
+        for (std::size_t i = 0; i < reference.solutions.size(); ++i)
+            if (Dune::FloatCmp::ne(predicted.solutions[i], reference.solutions[i], 1e-10))
+                DUNE_THROW(Dune::Exception, "Different solution in time step " << i << " with predictor of order " << order << ": "
+                                             << std::setprecision(15) << predicted.solutions[i] << ", without predictor: "
+                                             << reference.solutions[i]);
+    }
+
+    return 0;
+}
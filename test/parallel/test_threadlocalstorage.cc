@@ -0,0 +1,152 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*****************************************************************************
+ *   See the file COPYING for full copying permissions.                      *
+ *                                                                           *
+ *   This program is free software: you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by    *
+ *   the Free Software Foundation, either version 3 of the License, or       *
+ *   (at your option) any later version.                                     *
+ *                                                                           *
+ *   This program is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the            *
+ *   GNU General Public License for more details.                            *
+ *                                                                           *
+ *   You should have received a copy of the GNU General Public License       *
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.   *
+ *****************************************************************************/
+/*!
+ * \file
+ * \ingroup Parallel
+ * \brief Test for the storage of one object per thread
+ */
+#include <config.h>
+
+#include <atomic>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <thread>
+
+#include <dune/common/exceptions.hh>
+#include <dune/common/parallel/mpihelper.hh>
+
+#include <dumux/parallel/multithreading.hh>
+#include <dumux/parallel/parallel_for.hh>
+#include <dumux/parallel/threadlocalstorage.hh>
+
+namespace Dumux::Test {
+
+//! a workspace remembering the thread that created it
+struct Workspace
+{
+    std::thread::id owner;
+    std::size_t numUses = 0;
+};
+
+} // end namespace Dumux::Test
+
+int main(int argc, char* argv[])
+{
+    using namespace Dumux;
+
+    Dune::MPIHelper::instance(argc, argv);
+
+    std::atomic<std::size_t> numFactoryCalls(0);
+    ThreadLocalStorage<Test::Workspace> storage([&]{
+        ++numFactoryCalls;
+        return Test::Workspace{std::this_thread::get_id()};
+    });
+
+    if (storage.size() != 0)
+        DUNE_THROW(Dune::Exception, "Objects created before the first call to local()");
+
+    // the objects seen by each thread
+    std::mutex mutex;
+    std::map<std::thread::id, const Test::Workspace*> objects;
+    std::atomic<bool> failed(false);
+
+    const auto useStorage = [&](std::size_t count)
+    {
+        Dumux::parallelFor(count, [&](const std::size_t i)
+        {
+            auto& workspace = storage.local();
+
+            // the object is created by (and thus belongs to) the calling thread,
+            // in the serial backend there is a single object for the calling thread
+            if (workspace.owner != std::this_thread::get_id())
+                failed = true;
+
+            // repeated calls of the same thread return the same object
+            if (&storage.local() != &workspace)
+                failed = true;
+
+            ++workspace.numUses;
+
+            std::lock_guard<std::mutex> lock(mutex);
+            const auto [it, inserted] = objects.emplace(std::this_thread::get_id(), &workspace);
+            if (!inserted && it->second != &workspace)
+                failed = true;
+        });
+    };
+
+    const std::size_t count = 10000;
+    useStorage(count);
+    if (failed)
+        DUNE_THROW(Dune::Exception, "A thread obtained an object that is not its own");
+
+    // the objects are reused in successive loops (new threads of a pool get a new object)
+    useStorage(count);
+    if (failed)
+        DUNE_THROW(Dune::Exception, "A thread obtained a different object in a successive loop");
+
+    // the factory runs exactly once per thread
+    if (numFactoryCalls != objects.size() || storage.size() != objects.size())
+        DUNE_THROW(Dune::Exception, "The factory was called " << numFactoryCalls << " times and " << storage.size()
+                                    << " objects were created for " << objects.size() << " threads");
+
+    if (!Multithreading::isThreaded && storage.size() != 1)
+        DUNE_THROW(Dune::Exception, "Expected a single object with the serial backend, got " << storage.size());
+
+    // per-thread objects are distinct
+    std::map<const Test::Workspace*, std::thread::id> owners;
+    for (const auto& [id, workspace] : objects)
+        if (!owners.emplace(workspace, id).second)
+            DUNE_THROW(Dune::Exception, "Two threads share an object");
+
+    std::size_t numUses = 0;
+    storage.forEach([&](const Test::Workspace& workspace){ numUses += workspace.numUses; });
+    if (numUses != 2*count)
+        DUNE_THROW(Dune::Exception, "Expected " << 2*count << " uses of the objects, got " << numUses);
+
+    // after clearing, the objects are created again
+    storage.clear();
+    if (storage.size() != 0)
+        DUNE_THROW(Dune::Exception, "Objects left after clear()");
+    const auto& workspace = storage.local();
+    if (storage.size() != 1 || numFactoryCalls != objects.size() + 1 || workspace.numUses != 0)
+        DUNE_THROW(Dune::Exception, "Object was not recreated after clear()");
+
+    // alternating between two storages of the same type yields the objects of the respective storage
+    ThreadLocalStorage<Test::Workspace> otherStorage([]{ return Test::Workspace{std::this_thread::get_id()}; });
+    Dumux::parallelFor(count, [&](const std::size_t i)
+    {
+        auto& workspace = storage.local();
+        auto& otherWorkspace = otherStorage.local();
+        if (&workspace == &otherWorkspace || &storage.local() != &workspace || &otherStorage.local() != &otherWorkspace)
+            failed = true;
+        ++otherWorkspace.numUses;
+    });
+    if (failed)
+        DUNE_THROW(Dune::Exception, "Two storages of the same type returned the same object");
+
+    numUses = 0;
+    otherStorage.forEach([&](const Test::Workspace& workspace){ numUses += workspace.numUses; });
+    if (numUses != count)
+        DUNE_THROW(Dune::Exception, "Expected " << count << " uses of the other storage, got " << numUses);
+
+    std::cout << "-- " << objects.size() << " thread(s) used their own object" << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,149 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*****************************************************************************
+ *   See the file COPYING for full copying permissions.                      *
+ *                                                                           *
+ *   This program is free software: you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by    *
+ *   the Free Software Foundation, either version 3 of the License, or       *
+ *   (at your option) any later version.                                     *
+ *                                                                           *
+ *   This program is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the            *
+ *   GNU General Public License for more details.                            *
+ *                                                                           *
+ *   You should have received a copy of the GNU General Public License       *
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.   *
+ *****************************************************************************/
+/*!
+ * \file
+ * \ingroup TwoPTests
+ * \brief Compares the analytic Jacobian of the immiscible two-phase model
+ *        with the Jacobian obtained by numeric differentiation.
+ */
+#include <config.h>
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+#include <dune/common/exceptions.hh>
+#include <dune/common/parallel/mpihelper.hh>
+
+#include <dumux/common/properties.hh>
+#include <dumux/common/parameters.hh>
+#include <dumux/common/timeloop.hh>
+
+#include <dumux/assembly/fvassembler.hh>
+#include <dumux/assembly/diffmethod.hh>
+
+#include <dumux/io/grid/gridmanager.hh>
+
+#include "properties.hh"
+
+int main(int argc, char** argv)
+{
+    using namespace Dumux;
+
+    using TypeTag = Properties::TTag::TYPETAG;
+
+    // initialize MPI, finalize is done automatically on exit
+    Dune::MPIHelper::instance(argc, argv);
+
+    // parse command line arguments and input file
+    Parameters::init(argc, argv);
+
+    // create the grid
+    GridManager<GetPropType<TypeTag, Properties::Grid>> gridManager;
+    gridManager.init();
+    const auto& leafGridView = gridManager.grid().leafGridView();
+
+    // create the finite volume grid geometry
+    using GridGeometry = GetPropType<TypeTag, Properties::GridGeometry>;
+    auto gridGeometry = std::make_shared<GridGeometry>(leafGridView);
+    gridGeometry->update();
+
+    // the problem (initial and boundary conditions)
+    using Problem = GetPropType<TypeTag, Properties::Problem>;
+    auto problem = std::make_shared<Problem>(gridGeometry);
+
+    // the previous solution is the initial solution
+    using SolutionVector = GetPropType<TypeTag, Properties::SolutionVector>;
+    SolutionVector xOld(gridGeometry->numDofs());
+    problem->applyInitialSolution(xOld);
+
+    // evaluate the Jacobian for a non-hydrostatic pressure field and a non-uniform
+    // DNAPL saturation, such that the phase fluxes do not vanish
+    using Indices = typename GetPropType<TypeTag, Properties::ModelTraits>::Indices;
+    auto x = xOld;
+    auto fvGeometry = localView(*gridGeometry);
+    for (const auto& element : elements(leafGridView))
+    {
+        fvGeometry.bindElement(element);
+        for (const auto& scv : scvs(fvGeometry))
+        {
+            const auto& pos = scv.dofPosition();
+            x[scv.dofIndex()][Indices::pressureIdx] += 2e3*(6.0 - pos[0]) + 500.0*std::sin(pos[1]);
+            x[scv.dofIndex()][Indices::saturationIdx] = 0.1 + 0.25*(1.0 + std::sin(1.3*pos[0])*std::cos(0.9*pos[1]));
+        }
+    }
+
+    // the grid variables
+    using GridVariables = GetPropType<TypeTag, Properties::GridVariables>;
+    auto gridVariables = std::make_shared<GridVariables>(problem, gridGeometry);
+    gridVariables->init(x);
+
+    // the time loop (only used for the time step size in the storage term)
+    using Scalar = GetPropType<TypeTag, Properties::Scalar>;
+    const auto dt = getParam<Scalar>("TimeLoop.DtInitial");
+    auto timeLoop = std::make_shared<TimeLoop<Scalar>>(0.0, dt, 10.0*dt);
+
+    // assemble the Jacobian with numeric and with analytic differentiation
+    using NumericAssembler = FVAssembler<TypeTag, DiffMethod::numeric>;
+    auto numericAssembler = std::make_shared<NumericAssembler>(problem, gridGeometry, gridVariables, timeLoop, xOld);
+    numericAssembler->setLinearSystem();
+    numericAssembler->assembleJacobianAndResidual(x);
+
+    using AnalyticAssembler = FVAssembler<TypeTag, DiffMethod::analytic>;
+    auto analyticAssembler = std::make_shared<AnalyticAssembler>(problem, gridGeometry, gridVariables, timeLoop, xOld);
+    analyticAssembler->setLinearSystem();
+    analyticAssembler->assembleJacobianAndResidual(x);
+
+    const auto& numericJacobian = numericAssembler->jacobian();
+    const auto& analyticJacobian = analyticAssembler->jacobian();
+
+    // compare the entries relative to the largest entry of the (scalar) row
+    const auto tolerance = getParam<Scalar>("Test.RelativeTolerance");
+    Scalar maxDeviation = 0.0;
+    using BlockType = typename std::decay_t<decltype(numericJacobian)>::block_type;
+    for (auto row = numericJacobian.begin(); row != numericJacobian.end(); ++row)
+    {
+        for (int eqIdx = 0; eqIdx < BlockType::rows; ++eqIdx)
+        {
+            Scalar rowScale = 0.0;
+            for (auto col = row->begin(); col != row->end(); ++col)
+                for (int pvIdx = 0; pvIdx < BlockType::cols; ++pvIdx)
+                    rowScale = std::max(rowScale, std::abs((*col)[eqIdx][pvIdx]));
+
+            for (auto col = row->begin(); col != row->end(); ++col)
+            {
+                const auto& analyticBlock = analyticJacobian[row.index()][col.index()];
+                for (int pvIdx = 0; pvIdx < BlockType::cols; ++pvIdx)
+                {
+                    const auto deviation = std::abs(analyticBlock[eqIdx][pvIdx] - (*col)[eqIdx][pvIdx])/rowScale;
+                    maxDeviation = std::max(maxDeviation, deviation);
+                    if (deviation > tolerance)
+                        DUNE_THROW(Dune::Exception, "Analytic Jacobian entry (" << row.index() << ", " << col.index() << ")["
+                                                     << eqIdx << "][" << pvIdx << "] = " << analyticBlock[eqIdx][pvIdx]
+                                                     << " deviates from the numeric one " << (*col)[eqIdx][pvIdx]
+                                                     << " (relative deviation " << deviation << ")");
+                }
+            }
+        }
+    }
+
+    std::cout << "Maximum relative deviation of the analytic from the numeric Jacobian: " << maxDeviation << std::endl;
+
+    return 0;
+} // end main
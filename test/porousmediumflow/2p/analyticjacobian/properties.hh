@@ -0,0 +1,62 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*****************************************************************************
+ *   See the file COPYING for full copying permissions.                      *
+ *                                                                           *
+ *   This program is free software: you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by    *
+ *   the Free Software Foundation, either version 3 of the License, or       *
+ *   (at your option) any later version.                                     *
+ *                                                                           *
+ *   This program is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the            *
+ *   GNU General Public License for more details.                            *
+ *                                                                           *
+ *   You should have received a copy of the GNU General Public License       *
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.   *
+ *****************************************************************************/
+/*!
+ * \file
+ * \ingroup TwoPTests
+ * \brief The properties for the comparison of the analytic and the numeric Jacobian
+ *        of the two-phase model (compressible water, incompressible DNAPL).
+ */
+#ifndef DUMUX_TEST_TWOP_ANALYTIC_JACOBIAN_PROPERTIES_HH
+#define DUMUX_TEST_TWOP_ANALYTIC_JACOBIAN_PROPERTIES_HH
+
+#include <dumux/material/components/h2o.hh>
+#include <dumux/material/components/trichloroethene.hh>
+#include <dumux/material/fluidsystems/1pliquid.hh>
+#include <dumux/material/fluidsystems/2pimmiscible.hh>
+
+#include <dumux/porousmediumflow/immiscible/localresidual.hh>
+
+#include "../incompressible/problem.hh"
+
+namespace Dumux::Properties {
+
+// Create new type tags
+namespace TTag {
+struct TwoPAnalyticJacobian {};
+struct TwoPAnalyticJacobianTpfa { using InheritsFrom = std::tuple<TwoPAnalyticJacobian, TwoPIncompressibleTpfa>; };
+struct TwoPAnalyticJacobianBox { using InheritsFrom = std::tuple<TwoPAnalyticJacobian, TwoPIncompressibleBox>; };
+} // end namespace TTag
+
+// Use the immiscible local residual (and its derivatives) instead of the incompressible one
+template<class TypeTag>
+struct LocalResidual<TypeTag, TTag::TwoPAnalyticJacobian> { using type = ImmiscibleLocalResidual<TypeTag>; };
+
+// Compressible water with pressure-dependent viscosity
+template<class TypeTag>
+struct FluidSystem<TypeTag, TTag::TwoPAnalyticJacobian>
+{
+    using Scalar = GetPropType<TypeTag, Properties::Scalar>;
+    using WettingPhase = FluidSystems::OnePLiquid<Scalar, Components::H2O<Scalar>>;
+    using NonwettingPhase = FluidSystems::OnePLiquid<Scalar, Components::Trichloroethene<Scalar>>;
+    using type = FluidSystems::TwoPImmiscible<Scalar, WettingPhase, NonwettingPhase>;
+};
+
+} // end namespace Dumux::Properties
+
+#endif
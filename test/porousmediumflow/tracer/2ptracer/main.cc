@@ -162,19 +162,9 @@ int main(int argc, char** argv)
     auto tracerGridVariables = std::make_shared<TracerGridVariables>(tracerProblem, gridGeometry);
     tracerGridVariables->init(x);
 
-    // the linear solver
-    using TracerLinearSolver = AMGBiCGSTABBackend<LinearSolverTraits<GridGeometry>>;
-    auto tracerLinearSolver = std::make_shared<TracerLinearSolver>(leafGridView, gridGeometry->dofMapper());
-
-     //! the linear system
-    using JacobianMatrix = GetPropType<TracerTypeTag, Properties::JacobianMatrix>;
-    auto A = std::make_shared<JacobianMatrix>();
-    auto r = std::make_shared<TracerSolutionVector>();
-
     //! the assembler with time loop for instationary problem
     using TracerAssembler = FVAssembler<TracerTypeTag, DiffMethod::analytic, /*implicit=*/false>;
     auto tracerAssembler = std::make_shared<TracerAssembler>(tracerProblem, gridGeometry, tracerGridVariables, timeLoop, xOld);
-    tracerAssembler->setLinearSystem(A, r);
 
     // set the flux, density and saturation from the 2p problem
     tracerProblem->spatialParams().setVolumeFlux(volumeFlux_);
@@ -275,31 +265,10 @@ int main(int argc, char** argv)
         tracerProblem->spatialParams().setDensity(density_);
         tracerProblem->spatialParams().setSaturation(saturation_);
 
-        Dune::Timer tracerAssembleTimer;
-        tracerAssembler->assembleJacobianAndResidual(x);
-        tracerAssembleTimer.stop();
-
-        // solve the linear system A(xOld-xNew) = r
-        Dune::Timer solveTimer;
-        TracerSolutionVector xDelta(x);
-        tracerLinearSolver->solve(*A, xDelta, *r);
-        solveTimer.stop();
-
-        // update solution and grid variables
-        Dune::Timer updateTimer;
-        updateTimer.reset();
-        x -= xDelta;
-        tracerGridVariables->update(x);
-        updateTimer.stop();
-
-        // statistics
-        Dune::Timer assembleTimer;
-        const auto elapsedTot = assembleTimer.elapsed() + solveTimer.elapsed() + updateTimer.elapsed();
-        std::cout << "Assemble/solve/update time: "
-                  <<  assembleTimer.elapsed() << "(" << 100*assembleTimer.elapsed()/elapsedTot << "%)/"
-                  <<  solveTimer.elapsed() << "(" << 100*solveTimer.elapsed()/elapsedTot << "%)/"
-                  <<  updateTimer.elapsed() << "(" << 100*updateTimer.elapsed()/elapsedTot << "%)"
-                  <<  std::endl;
+        // explicit update of the tracer solution (no Jacobian matrix and linear solver needed)
+        Dune::Timer tracerTimer;
+        tracerAssembler->explicitUpdate(x);
+        std::cout << "Explicit tracer update took " << tracerTimer.elapsed() << " seconds." << std::endl;
 
         // make the new solution the old solution
         xOld = x;
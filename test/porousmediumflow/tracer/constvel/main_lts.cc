@@ -0,0 +1,185 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*****************************************************************************
+ *   See the file COPYING for full copying permissions.                      *
+ *                                                                           *
+ *   This program is free software: you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by    *
+ *   the Free Software Foundation, either version 3 of the License, or       *
+ *   (at your option) any later version.                                     *
+ *                                                                           *
+ *   This program is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the            *
+ *   GNU General Public License for more details.                            *
+ *                                                                           *
+ *   You should have received a copy of the GNU General Public License       *
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.   *
+ *****************************************************************************/
+/*!
+ * \file
+ * \ingroup TracerTests
+ * \brief Test for the local time stepping with the explicit tracer CC model.
+ *        With a single level, the solution is compared to the one of the explicit assembler.
+ *        With several levels, conservation and boundedness of the tracer are checked.
+ */
+#include <config.h>
+
+#include <cmath>
+#include <vector>
+#include <iostream>
+#include <algorithm>
+
+#include <dune/common/parallel/mpihelper.hh>
+#include <dune/common/timer.hh>
+
+#include <dumux/common/properties.hh>
+#include <dumux/common/parameters.hh>
+#include <dumux/common/dumuxmessage.hh>
+
+#include <dumux/linear/seqsolverbackend.hh>
+#include <dumux/linear/pdesolver.hh>
+#include <dumux/assembly/fvassembler.hh>
+#include <dumux/timestepping/localtimestepping.hh>
+
+#include <dumux/io/grid/gridmanager.hh>
+
+#include "problem.hh"
+
+int main(int argc, char** argv)
+{
+    using namespace Dumux;
+
+    using TypeTag = Properties::TTag::TracerTestTpfa;
+
+    const auto& mpiHelper = Dune::MPIHelper::instance(argc, argv);
+    if (mpiHelper.rank() == 0)
+        DumuxMessage::print(/*firstCall=*/true);
+
+    Parameters::init(argc, argv);
+
+    GridManager<GetPropType<TypeTag, Properties::Grid>> gridManager;
+    gridManager.init();
+    const auto& leafGridView = gridManager.grid().leafGridView();
+
+    using GridGeometry = GetPropType<TypeTag, Properties::GridGeometry>;
+    auto gridGeometry = std::make_shared<GridGeometry>(leafGridView);
+    gridGeometry->update();
+
+    using Problem = GetPropType<TypeTag, Properties::Problem>;
+    auto problem = std::make_shared<Problem>(gridGeometry);
+
+    using SolutionVector = GetPropType<TypeTag, Properties::SolutionVector>;
+    SolutionVector x0(gridGeometry->numDofs());
+    problem->applyInitialSolution(x0);
+
+    using Scalar = GetPropType<TypeTag, Properties::Scalar>;
+    const auto dt = getParam<Scalar>("TimeLoop.DtInitial");
+    const auto numSteps = getParam<int>("TimeLoop.NumSteps", 20);
+    auto timeLoop = std::make_shared<TimeLoop<Scalar>>(0, dt, numSteps*dt);
+
+    // the reference: the explicit assembler with a linear solve per time step
+    using GridVariables = GetPropType<TypeTag, Properties::GridVariables>;
+    auto refGridVariables = std::make_shared<GridVariables>(problem, gridGeometry);
+    auto xRef = x0, xRefOld = x0;
+    refGridVariables->init(xRef);
+
+    using Assembler = FVAssembler<TypeTag, DiffMethod::analytic, /*implicit=*/false>;
+    auto refAssembler = std::make_shared<Assembler>(problem, gridGeometry, refGridVariables, timeLoop, xRefOld);
+    auto linearSolver = std::make_shared<UMFPackBackend>();
+    LinearPDESolver solver(refAssembler, linearSolver);
+    refAssembler->assembleJacobianAndResidual(xRef);
+    solver.reuseMatrix();
+
+    Dune::Timer timer;
+    for (int i = 0; i < numSteps; ++i)
+    {
+        solver.solve(xRef);
+        xRefOld = xRef;
+        refGridVariables->advanceTimeStep();
+    }
+    const auto refTime = timer.elapsed();
+
+    // the local time stepping with a single level
+    auto gridVariables = std::make_shared<GridVariables>(problem, gridGeometry);
+    auto x = x0, xOld = x0;
+    gridVariables->init(x);
+    auto assembler = std::make_shared<Assembler>(problem, gridGeometry, gridVariables, timeLoop, xOld);
+    Experimental::LocalTimeStepping<Assembler> localTimeStepping(assembler);
+
+    const auto numCells = leafGridView.size(0);
+    localTimeStepping.setStableTimeStepSizes(std::vector<Scalar>(numCells, dt));
+    if (localTimeStepping.numLevels() != 1 || localTimeStepping.timeStepSize() != dt)
+        DUNE_THROW(Dune::Exception, "Expected a single level with the time step size " << dt);
+
+    timer.reset();
+    for (int i = 0; i < numSteps; ++i)
+        localTimeStepping.advance(x);
+    const auto ltsTime = timer.elapsed();
+
+    Scalar diff = 0.0, scale = 1e-100;
+    for (std::size_t i = 0; i < x.size(); ++i)
+    {
+        diff = std::max(diff, std::abs(x[i][0] - xRef[i][0]));
+        scale = std::max(scale, std::abs(xRef[i][0]));
+    }
+    std::cout << "Single level: relative difference to the explicit assembler " << diff/scale
+              << " (assembler " << refTime << "s, local time stepping " << ltsTime << "s)" << std::endl;
+    if (!(diff/scale < 1e-8))
+        DUNE_THROW(Dune::Exception, "The local time stepping differs from the explicit assembler");
+
+    // the local time stepping with three levels: a quarter of the time step size in the left half
+    const auto totalMass = [&]
+    {
+        const auto localResidual = assembler->localResidual();
+        Scalar mass = 0.0;
+        auto fvGeometry = localView(*gridGeometry);
+        auto elemVolVars = localView(gridVariables->curGridVolVars());
+        for (const auto& element : elements(leafGridView))
+        {
+            fvGeometry.bindElement(element);
+            elemVolVars.bindElement(element, fvGeometry, x);
+            for (const auto& scv : scvs(fvGeometry))
+                mass += localResidual.computeStorage(*problem, scv, elemVolVars[scv])[0]*scv.volume();
+        }
+        return mass;
+    };
+
+    x = x0;
+    gridVariables->init(x);
+    std::vector<Scalar> stableDt(numCells, dt);
+    for (const auto& element : elements(leafGridView))
+        if (element.geometry().center()[0] < 0.5)
+            stableDt[gridGeometry->elementMapper().index(element)] = 0.25*dt;
+
+    localTimeStepping.setStableTimeStepSizes(stableDt);
+    if (localTimeStepping.numLevels() != 3 || std::abs(localTimeStepping.timeStepSize() - dt) > 1e-12*dt)
+        DUNE_THROW(Dune::Exception, "Expected three levels with the macro time step size " << dt);
+
+    const auto initialMass = totalMass();
+    const auto initialMax = std::max_element(x0.begin(), x0.end(), [](const auto& a, const auto& b){ return a[0] < b[0]; })->operator[](0);
+    std::size_t numCellUpdates = 0;
+    for (int i = 0; i < numSteps; ++i)
+    {
+        localTimeStepping.advance(x);
+        numCellUpdates += localTimeStepping.numCellUpdates();
+    }
+
+    const auto massError = std::abs(totalMass() - initialMass)/initialMass;
+    std::cout << "Three levels: relative change of the tracer mass " << massError << ", "
+              << numCellUpdates << " cell updates (" << 4*numSteps*numCells << " with a global time step size)" << std::endl;
+    if (!(massError < 1e-12))
+        DUNE_THROW(Dune::Exception, "The local time stepping is not conservative");
+
+    for (std::size_t i = 0; i < x.size(); ++i)
+        if (x[i][0] < -1e-12*initialMax || x[i][0] > initialMax*(1.0 + 1e-12))
+            DUNE_THROW(Dune::Exception, "The tracer concentration " << x[i][0] << " in cell " << i << " is out of bounds");
+
+    if (mpiHelper.rank() == 0)
+    {
+        Parameters::print();
+        DumuxMessage::print(/*firstCall=*/false);
+    }
+
+    return 0;
+}
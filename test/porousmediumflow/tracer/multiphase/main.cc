@@ -24,8 +24,12 @@
 #include <config.h>
 
 #include <ctime>
+#include <cmath>
+#include <memory>
 #include <iostream>
+#include <algorithm>
 
+#include <dune/common/exceptions.hh>
 #include <dune/common/parallel/mpihelper.hh>
 #include <dune/common/timer.hh>
 #include <dune/grid/io/file/vtk/vtksequencewriter.hh>
@@ -44,6 +48,10 @@
 
 #include "properties.hh"
 
+#ifndef MATRIXFREE // default to false if not set through CMake
+#define MATRIXFREE false
+#endif
+
 int main(int argc, char** argv)
 {
     using namespace Dumux;
@@ -113,12 +121,25 @@ int main(int argc, char** argv)
     using Assembler = FVAssembler<TypeTag, DiffMethod::numeric, /*implicit=*/false>;
     auto assembler = std::make_shared<Assembler>(problem, gridGeometry, gridVariables, timeLoop, xOld);
 
-    //! the linear solver
+    //! the linear solver (not needed if the explicit update is computed by the assembler)
     using LinearSolver = ExplicitDiagonalSolver;
-    auto linearSolver = std::make_shared<LinearSolver>();
-
-    //! the system solver
-    LinearPDESolver<Assembler, LinearSolver> solver(assembler, linearSolver);
+    using Solver = LinearPDESolver<Assembler, LinearSolver>;
+    std::unique_ptr<Solver> solver;
+    if (!MATRIXFREE)
+        solver = std::make_unique<Solver>(assembler, std::make_shared<LinearSolver>());
+
+    //! the matrix-free update is compared to the matrix-based solve (with its own solution and grid variables)
+    auto xRef = x;
+    auto xOldRef = x;
+    std::shared_ptr<GridVariables> gridVariablesRef;
+    std::unique_ptr<Solver> solverRef;
+    if (MATRIXFREE)
+    {
+        gridVariablesRef = std::make_shared<GridVariables>(problem, gridGeometry);
+        gridVariablesRef->init(xRef);
+        auto assemblerRef = std::make_shared<Assembler>(problem, gridGeometry, gridVariablesRef, timeLoop, xOldRef);
+        solverRef = std::make_unique<Solver>(assemblerRef, std::make_shared<LinearSolver>());
+    }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////
     // run instationary non-linear simulation
@@ -132,7 +153,31 @@ int main(int argc, char** argv)
     while (!timeLoop->finished())
     {
         // assemble & solve
-        solver.solve(x);
+        if (MATRIXFREE)
+        {
+            assembler->explicitUpdate(x);
+
+            solverRef->solve(xRef);
+            xOldRef = xRef;
+            gridVariablesRef->advanceTimeStep();
+
+            Scalar maxDiff = 0.0, maxRef = 0.0;
+            for (std::size_t dofIdx = 0; dofIdx < x.size(); ++dofIdx)
+            {
+                for (std::size_t eqIdx = 0; eqIdx < x[dofIdx].size(); ++eqIdx)
+                {
+                    using std::abs; using std::max;
+                    maxDiff = max(maxDiff, abs(x[dofIdx][eqIdx] - xRef[dofIdx][eqIdx]));
+                    maxRef = max(maxRef, abs(xRef[dofIdx][eqIdx]));
+                }
+            }
+
+            if (maxDiff > 1e-10*maxRef)
+                DUNE_THROW(Dune::Exception, "The matrix-free explicit update deviates from the matrix-based solve by "
+                                             << maxDiff << " (maximum value " << maxRef << ")");
+        }
+        else
+            solver->solve(x);
 
         // make the new solution the old solution
         xOld = x;
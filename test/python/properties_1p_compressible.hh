@@ -0,0 +1,44 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/****************************************************************************
+ *   See the file COPYING for full copying permissions.                      *
+ *                                                                           *
+ *   This program is free software: you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by    *
+ *   the Free Software Foundation, either version 3 of the License, or       *
+ *   (at your option) any later version.                                     *
+ *                                                                           *
+ *   This program is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the            *
+ *   GNU General Public License for more details.                            *
+ *                                                                           *
+ *   You should have received a copy of the GNU General Public License       *
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.   *
+ *****************************************************************************/
+/*!
+ * \file
+ * \brief The properties of the compressible one-phase test driven from Python
+ *        (the grid type coincides with the structured grid created in Python)
+ */
+
+#ifndef DUMUX_TEST_PYTHON_ONEP_COMPRESSIBLE_PROPERTIES_HH
+#define DUMUX_TEST_PYTHON_ONEP_COMPRESSIBLE_PROPERTIES_HH
+
+#include <dune/grid/yaspgrid.hh>
+
+#include <test/porousmediumflow/1p/compressible/stationary/properties.hh>
+
+namespace Dumux::Properties {
+
+namespace TTag {
+struct OnePCompressiblePythonTpfa { using InheritsFrom = std::tuple<OnePCompressibleTpfa>; };
+} // end namespace TTag
+
+template<class TypeTag>
+struct Grid<TypeTag, TTag::OnePCompressiblePythonTpfa>
+{ using type = Dune::YaspGrid<2, Dune::EquidistantOffsetCoordinates<double, 2>>; };
+
+} // end namespace Dumux::Properties
+
+#endif
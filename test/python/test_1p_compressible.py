@@ -0,0 +1,58 @@
+#!/usr/bin/env python3
+
+# Solve the compressible one-phase test problem (defined in C++) driven from Python
+# using the bindings of the grid variables, the assembler, the linear and the Newton solver
+
+import numpy as np
+from dune.grid import structuredGrid
+from dumux.common import TypeTag, Problem, initParameters
+from dumux.discretization import GridGeometry, GridVariables
+from dumux.assembly import FVAssembler
+from dumux.linear import IstlSolverFactoryBackend
+from dumux.nonlinear import NewtonSolver
+
+initParameters(params={
+    "Problem.Name": "test_python_1p_compressible",
+    "SpatialParams.LensLowerLeft": "0.2 0.2",
+    "SpatialParams.LensUpperRight": "0.8 0.8",
+    "SpatialParams.Permeability": "1e-10",
+    "SpatialParams.PermeabilityLens": "1e-12",
+    "LinearSolver.Type": "bicgstabsolver",
+    "LinearSolver.Preconditioner.Type": "ilu",
+    "LinearSolver.Verbosity": "0",
+})
+
+typeTag = TypeTag("OnePCompressiblePythonTpfa", includes=["test/python/properties_1p_compressible.hh"])
+
+gridView = structuredGrid([0, 0], [1, 1], [10, 10])
+gridGeometry = GridGeometry(gridView, typeTag=typeTag)
+gridGeometry.update()
+
+problem = Problem(gridGeometry, typeTag=typeTag)
+gridVariables = GridVariables(problem, typeTag=typeTag)
+
+sol = problem.initialSolution()
+gridVariables.init(sol)
+
+# the NumPy view shares the memory with the solution vector
+solArray = sol.asarray()
+if solArray.shape != (gridGeometry.numDofs(), 1):
+    raise Exception("Unexpected shape of the solution array: {}".format(solArray.shape))
+solArray[:, 0] = 1.0e5
+if np.asarray(sol)[0, 0] != 1.0e5:
+    raise Exception("The NumPy view does not share the memory with the solution vector")
+
+assembler = FVAssembler(problem=problem, gridVariables=gridVariables, typeTag=typeTag)
+linearSolver = IstlSolverFactoryBackend(gridGeometry)
+newton = NewtonSolver(assembler, linearSolver)
+gridVariables.update(sol)
+initialResidualNorm = assembler.residualNorm(sol)
+newton.solve(sol)
+
+# the view observes the solution computed in C++ and the residual is reduced
+assembler.assembleResidual(sol)
+residual = assembler.residual().asarray()
+print("Pressure range: [{}, {}] Pa".format(solArray.min(), solArray.max()))
+print("Residual norm: {} (initial {})".format(np.linalg.norm(residual), initialResidualNorm))
+if np.linalg.norm(residual) > 1e-6*initialResidualNorm:
+    raise Exception("The residual was not reduced by the Newton solver")
@@ -28,6 +28,7 @@
 #include <memory>
 #include <tuple>
 
+#include <cmath>
 #include <iostream>
 #include <iomanip>
 #include <dune/python/pybind11/iostream.h>
@@ -50,6 +51,7 @@ void printProblemTest(const Problem& problem)
     std::size_t numNeumann = 0;
     std::size_t numDirichlet = 0;
     double totalSource = 0;
+    double totalScvSource = 0;
     const auto& gg = problem.gridGeometry();
     for (const auto& element : elements(gg.gridView()))
     {
@@ -66,9 +68,13 @@ void printProblemTest(const Problem& problem)
                 numNeumann += 1;
 
             totalSource += problem.sourceAtPos(scv.center())[0]*scv.volume();
+            totalScvSource += problem.source(element, fvGeometry, std::ignore, scv)[0]*scv.volume();
         }
     }
 
+    if (std::abs(totalSource - totalScvSource) > 1e-10*std::abs(totalSource))
+        DUNE_THROW(Dune::Exception, "Source terms evaluated at positions and per scv differ");
+
     std::cout << "[cpp] Found " << numNeumann << " Neumann faces and " << numDirichlet << " Dirichlet faces" << std::endl;
     std::cout << "[cpp] Total source " << totalSource << std::fixed << std::setprecision(3) << " kg/s" << std::endl;
 }
@@ -20,6 +20,7 @@ def PrintProblemTest(problem):
 from dune.grid import structuredGrid
 from dumux.discretization import GridGeometry
 from dumux.common import BoundaryTypes, FVProblem
+import numpy as np
 
 gridView = structuredGrid([0,0,0],[1,1,1],[3,3,3])
 
@@ -73,3 +74,37 @@ for e in gridView.elements:
 
 print("[python] Found {} Neumann faces and {} Dirichlet faces".format(numNeumann, numDirichlet))
 print("[python] Total source {:.2f} kg/s".format(totalSource))
+
+# the same problem using the vectorized batch interface
+@FVProblem(gridGeometry)
+class BatchProblem:
+    numEq = 2
+    name = "python_batch_problem"
+
+    def boundaryTypesAtPosBatch(self, points):
+        return np.ones((len(points), self.numEq), dtype=bool)
+
+    def dirichletAtPosBatch(self, points):
+        values = np.zeros((len(points), self.numEq))
+        right = points[:, 0] > 0.5
+        values[right] = [0.5, 0.5]
+        values[~right] = [1.0, 0.0]
+        return values
+
+    def sourceAtPosBatch(self, points):
+        return np.stack([points[:, 0], np.zeros(len(points))], axis=1)
+
+    def sourceAtPos(self, globalPos):
+        return [globalPos[0], 0.0]
+
+batchProblem = BatchProblem()
+PrintProblemTest(batchProblem).print()
+
+for e in gridView.elements:
+    fvGeometry = batchProblem.gridGeometry().localView()
+    fvGeometry.bind(e)
+    for scv in fvGeometry.scvs():
+        if batchProblem.boundaryTypes(element=e, scv=scv).isDirichlet() != problem.boundaryTypes(element=e, scv=scv).isDirichlet():
+            raise Exception("Boundary types of the batch problem differ")
+        if np.any(np.array(batchProblem.dirichlet(element=e, scv=scv)) != np.array(problem.dirichlet(element=e, scv=scv))):
+            raise Exception("Dirichlet values of the batch problem differ")
@@ -19,12 +19,17 @@
 #include <dumux/timestepping/timelevel.hh>
 #include <dumux/timestepping/multistagemethods.hh>
 #include <dumux/timestepping/multistagetimestepper.hh>
+#include <dumux/timestepping/stepsizecontroller.hh>
+#include <dumux/common/timeloop.hh>
 
 /*
    This tests the time integration methods by solving the
-   linear ODE du/dt = exp(t), where u is the unknown
-   and t is the time. We use the initial condition u_0 = 1,
-   and thus, the exact solution is u_e = exp(t) - 1.
+   linear ODE du/dt = exp(t) - k*u, where u is the unknown,
+   t is the time and k >= 0 a decay rate. We use the initial
+   condition u_0 = 0, and thus, the exact solution is
+   u_e = (exp(t) - exp(-k*t))/(1 + k). For k = 0, the right hand
+   side does not depend on u, for large k the ODE is stiff and
+   the error controlled time stepping has to reject steps.
  */
 
 namespace Dumux {
@@ -40,6 +45,10 @@ public:
     using Variables = Experimental::Variables<SolutionVector>;
     using StageParams = Experimental::MultiStageParams<Scalar>;
 
+    explicit ScalarAssembler(Scalar decayRate = 0.0)
+    : decayRate_(decayRate)
+    {}
+
     void setLinearSystem() {}
     JacobianMatrix& jacobian() { return jac_; }
     ResidualType& residual() { return res_; }
@@ -51,8 +60,8 @@ public:
         const auto storage = [] (const auto& stageVars)
         { return stageVars.dofs(); };
 
-        const auto source = [] (const auto& stageVars)
-        { using std::exp; return exp(stageVars.timeLevel().current()); };
+        const auto source = [&] (const auto& stageVars)
+        { using std::exp; return exp(stageVars.timeLevel().current()) - decayRate_*stageVars.dofs(); };
 
         for (std::size_t k = 0; k < stageParams_->size(); ++k)
         {
@@ -69,7 +78,14 @@ public:
     void assembleJacobianAndResidual(const Variables& vars)
     {
         assembleResidual(vars);
-        jac_ = 1.0;
+
+        // derivative of the current stage's residual with respect to the current solution
+        const auto curStage = stageParams_->size() - 1;
+        jac_ = 0.0;
+        if (!stageParams_->skipTemporal(curStage))
+            jac_ += stageParams_->temporalWeight(curStage);
+        if (!stageParams_->skipSpatial(curStage))
+            jac_ += stageParams_->spatialWeight(curStage)*decayRate_;
     }
 
     void prepareStage(Variables& variables,
@@ -95,6 +111,7 @@ public:
     }
 
 private:
+    Scalar decayRate_;
     ResidualType res_;
     JacobianMatrix jac_;
     std::vector<Variables> prevStageVariables_;
@@ -117,6 +134,31 @@ public:
     }
 };
 
+/*!
+ * \brief A step size controller counting the rejected steps
+ */
+template<class Scalar>
+class CountingStepSizeController : public Experimental::PIStepSizeController<Scalar>
+{
+    using ParentType = Experimental::PIStepSizeController<Scalar>;
+public:
+    using ParentType::ParentType;
+
+    bool accept(Scalar errorNorm) const
+    {
+        const bool accepted = ParentType::accept(errorNorm);
+        if (!accepted)
+            ++numRejections_;
+        return accepted;
+    }
+
+    std::size_t numRejections() const
+    { return numRejections_; }
+
+private:
+    mutable std::size_t numRejections_ = 0;
+};
+
 } // end namespace Dumux
 
 int main(int argc, char* argv[])
@@ -128,7 +170,9 @@ int main(int argc, char* argv[])
 
     // initialize  parameters
     // TODO Try to remove this once the Newton does not depend on global default parameters anymore (#1003)
-    Parameters::init(argc, argv);
+    Parameters::init(argc, argv, [](Dune::ParameterTree& params){
+        params["NoRejections.TimeStepControl.MaxRejections"] = "2";
+    });
 
     using Assembler = ScalarAssembler;
     using LinearSolver = ScalarLinearSolver;
@@ -143,17 +187,17 @@ int main(int argc, char* argv[])
     using Variables = typename Assembler::Variables;
     using SolutionVector = typename Variables::SolutionVector;
 
-    const auto exact = [] (const Scalar t)
+    const auto exact = [] (const Scalar t, const Scalar decayRate = 0.0)
     {
         using std::exp;
-        return exp(t) - 1.0;
+        return (exp(t) - exp(-decayRate*t))/(1.0 + decayRate);
     };
 
-    const auto computeError = [&] (const Variables& vars)
+    const auto computeError = [&] (const Variables& vars, const Scalar decayRate = 0.0)
     {
         using std::abs;
         const auto time = vars.timeLevel().current();
-        const auto exactSol = exact(time);
+        const auto exactSol = exact(time, decayRate);
         const auto absErr = abs(vars.dofs()-exactSol);
         const auto relErr = absErr/exactSol;
         return std::make_pair(absErr, relErr);
@@ -190,6 +234,90 @@ int main(int argc, char* argv[])
     testIntegration(std::make_shared<ImplicitEuler<Scalar>>(), 5.0083e-03);
     testIntegration(std::make_shared<Theta<Scalar>>(0.5), 8.3333e-06);
     testIntegration(std::make_shared<RungeKuttaExplicitFourthOrder<Scalar>>(), 3.4829e-12);
+    testIntegration(std::make_shared<HeunEuler<Scalar>>(), 8.3333e-06);
+    testIntegration(std::make_shared<BogackiShampine<Scalar>>(), 3.4709e-09);
+    testIntegration(std::make_shared<SDIRKTwo<Scalar>>(), 1.0161e-06);
+
+    // integrate the stiff ODE (du/dt depends on u) until t = 1 with error controlled time step sizes
+    // starting with a too large time step size, such that steps have to be rejected and retried
+    const Scalar decayRate = 100.0;
+    auto stiffAssembler = std::make_shared<Assembler>(decayRate);
+    auto stiffNewtonSolver = std::make_shared<NewtonSolver>(stiffAssembler, linearSolver);
+
+    const auto testAdaptiveIntegration = [&] (auto method, std::size_t maxNumSteps, Scalar maxRelError)
+    {
+        std::cout << "\n-- Adaptive integration with " << method->name() << ":\n\n";
+        SolutionVector x = 0.0;
+        Variables vars(x);
+
+        using TimeStepper = Experimental::MultiStageTimeStepper<NewtonSolver>;
+        TimeStepper timeStepper(stiffNewtonSolver, method);
+        timeStepper.setVerbosity(0);
+        CountingStepSizeController<Scalar> controller(method->embeddedOrder() + 1);
+
+        TimeLoop<Scalar> timeLoop(/*start time*/0.0, /*initial dt*/0.1, /*end time*/1.0, /*verbose*/false);
+        timeLoop.start();
+        while (!timeLoop.finished())
+        {
+            timeStepper.step(vars, timeLoop, controller);
+            timeLoop.advanceTimeStep();
+            timeLoop.setTimeStepSize(timeStepper.suggestedTimeStepSize());
+        }
+
+        const auto [abs, rel] = computeError(vars, decayRate);
+        std::cout << "\n"
+                  << "-- Summary\n"
+                  << "-- ===========================\n"
+                  << "-- Number of steps:   " << timeLoop.timeStepIndex() << "\n"
+                  << "-- Rejected steps:    " << controller.numRejections() << "\n"
+                  << "-- Absolute error:    " << Fmt::format("{:.4e}\n", abs)
+                  << "-- Relative error:    " << Fmt::format("{:.4e}", rel) << std::endl;
+
+        if (rel > maxRelError)
+            DUNE_THROW(Dune::InvalidStateException,
+                       "Error " << rel << " larger than " << maxRelError << " for " << method->name());
+        if (timeLoop.timeStepIndex() > maxNumSteps)
+            DUNE_THROW(Dune::InvalidStateException,
+                       "Adaptive integration took " << timeLoop.timeStepIndex()
+                       << " > " << maxNumSteps << " steps for " << method->name());
+        if (controller.numRejections() == 0)
+            DUNE_THROW(Dune::InvalidStateException,
+                       "Expected rejected steps for the initial time step size for " << method->name());
+
+        return controller.numRejections();
+    };
+
+    // the explicit method is limited by its stability region and keeps rejecting steps
+    const auto numRejectionsExplicit = testAdaptiveIntegration(std::make_shared<BogackiShampine<Scalar>>(), 80, 1e-4);
+    const auto numRejectionsImplicit = testAdaptiveIntegration(std::make_shared<SDIRKTwo<Scalar>>(), 200, 1e-4);
+    if (numRejectionsImplicit >= numRejectionsExplicit)
+        DUNE_THROW(Dune::InvalidStateException,
+                   "Expected less rejected steps for the L-stable implicit method ("
+                   << numRejectionsImplicit << ") than for the explicit method (" << numRejectionsExplicit << ")");
+
+    // a step that is still rejected after the maximum number of rejections throws
+    {
+        std::cout << "\n-- Exceeding the maximum number of rejections:\n\n";
+        SolutionVector x = 0.0;
+        Variables vars(x);
+
+        auto method = std::make_shared<BogackiShampine<Scalar>>();
+        Experimental::MultiStageTimeStepper<NewtonSolver> timeStepper(stiffNewtonSolver, method);
+        CountingStepSizeController<Scalar> controller(method->embeddedOrder() + 1, "NoRejections");
+
+        TimeLoop<Scalar> timeLoop(/*start time*/0.0, /*initial dt*/0.1, /*end time*/1.0, /*verbose*/false);
+        bool thrown = false;
+        try { timeStepper.step(vars, timeLoop, controller); }
+        catch (const NumericalProblem& e) { thrown = true; std::cout << e.what() << std::endl; }
+
+        if (!thrown)
+            DUNE_THROW(Dune::InvalidStateException, "Expected an exception after exceeding the maximum number of rejections");
+        if (controller.numRejections() != controller.maxRejections() + 1)
+            DUNE_THROW(Dune::InvalidStateException,
+                       "Expected " << controller.maxRejections() + 1 << " rejected attempts, got " << controller.numRejections());
+        if (vars.dofs() != 0.0)
+            DUNE_THROW(Dune::InvalidStateException, "The variables were not reset after the rejected attempts");
+    }
 
     return 0;
 }